@@ -97,6 +97,7 @@ public actor AskSession {
     public let embedder: any Embedder
     public let pathGuard: PathGuard
     public let approver: ToolApprover
+    private let indexManifestURL: URL
 
     private var backend: (any LMBackend)?
     private var mcpBridges: [MCPClientBridge] = []
@@ -113,10 +114,9 @@ public actor AskSession {
         self.focusFile = config.focusFile
         self.contextStore = ContextStore(workingDirectory: config.workingDirectory)
         self.registry = ToolRegistry()
-        let indexURL = config.workingDirectory
-            .appendingPathComponent(".context.index")
-            .appendingPathComponent("vectors.json")
-        self.vectorStore = VectorStore(storeURL: indexURL)
+        let indexDirectory = config.workingDirectory.appendingPathComponent(".context.index")
+        self.vectorStore = VectorStore(storeURL: indexDirectory.appendingPathComponent("vectors.json"))
+        self.indexManifestURL = indexDirectory.appendingPathComponent("manifest.json")
         self.embedder = HashingEmbedder()
         self.pathGuard = PathGuard(root: config.workingDirectory)
         self.approver = approver
@@ -1054,12 +1054,26 @@ public actor AskSession {
         try contextStore.load()
     }
 
+    /// Bring the index up to date, re-embedding only files that changed
+    /// since the last run. Returns the total number of indexed chunks.
     public func rebuildIndex() async throws -> Int {
         let indexer = ProjectIndexer(root: config.workingDirectory, embedder: embedder)
-        let chunks = try await indexer.buildIndex()
-        await vectorStore.replaceAll(chunks)
-        try await vectorStore.save()
-        return chunks.count
+        // The manifest is only trusted if it describes what the store holds
+        var previous = IndexManifest.load(from: indexManifestURL)
+        if let manifest = previous, manifest.chunkCount != (await vectorStore.count) {
+            previous = nil
+        }
+
+        let delta = try await indexer.update(from: previous)
+        if delta.isFullRebuild {
+            await vectorStore.replaceAll(delta.chunks)
+            try await vectorStore.save()
+        } else if !delta.isEmpty {
+            await vectorStore.update(replacingPaths: delta.replacedPaths, with: delta.chunks)
+            try await vectorStore.save()
+        }
+        try delta.manifest.save(to: indexManifestURL)
+        return await vectorStore.count
     }
 
     public func search(query: String, k: Int) async throws -> [SearchResult] {
@@ -4,14 +4,20 @@
 // ============================================================
 
 import Foundation
-import Crypto
 
 /// Protocol for embedding text into a fixed-dimension vector.
 public protocol Embedder: Sendable {
     var dimension: Int { get }
+    /// Identifies the vector space. Indexes built under a different
+    /// identifier are discarded instead of being updated incrementally.
+    var identifier: String { get }
     func embed(_ text: String) async throws -> [Float]
 }
 
+extension Embedder {
+    public var identifier: String { "\(type(of: self))-\(dimension)" }
+}
+
 /// A zero-dependency embedder that hashes n-grams into a fixed vector.
 /// Not as good as a real embedding model but works offline with zero setup.
 public struct HashingEmbedder: Embedder, Sendable {
@@ -21,21 +27,37 @@ public struct HashingEmbedder: Embedder, Sendable {
         self.dimension = dimension
     }
 
+    public var identifier: String { "hashing-fnv1a-\(dimension)" }
+
     public func embed(_ text: String) async throws -> [Float] {
-        let tokens = tokenize(text)
         var vector = [Float](repeating: 0, count: dimension)
+        let buckets = UInt64(dimension)
 
-        for i in 0..<tokens.count {
-            // Unigrams
-            let hash1 = stableHash(tokens[i])
-            vector[hash1 % dimension] += 1.0
+        // Tokens are maximal runs of alphanumerics in the lowercased text.
+        // Bigram hashes continue the previous token's hash over " " and
+        // the current token, so no joined strings are built.
+        var token: [UInt8] = []
+        var previousHash: UInt64?
+        func flushToken() {
+            guard !token.isEmpty else { return }
+            let hash = FNV1a.hash(token)
+            vector[Int(hash % buckets)] += 1.0
+            if let previousHash {
+                let bigram = FNV1a.hash(token, seed: FNV1a.hash(Self.space, seed: previousHash))
+                vector[Int(bigram % buckets)] += 0.5
+            }
+            previousHash = hash
+            token.removeAll(keepingCapacity: true)
+        }
 
-            // Bigrams
-            if i + 1 < tokens.count {
-                let hash2 = stableHash(tokens[i] + " " + tokens[i + 1])
-                vector[hash2 % dimension] += 0.5
+        for scalar in text.lowercased().unicodeScalars {
+            if Self.isTokenScalar(scalar) {
+                token.append(contentsOf: scalar.utf8)
+            } else {
+                flushToken()
             }
         }
+        flushToken()
 
         // L2 normalize
         let norm = sqrt(vector.reduce(0) { $0 + $1 * $1 })
@@ -45,15 +67,34 @@ public struct HashingEmbedder: Embedder, Sendable {
         return vector
     }
 
-    private func tokenize(_ text: String) -> [String] {
-        text.lowercased()
-            .components(separatedBy: CharacterSet.alphanumerics.inverted)
-            .filter { !$0.isEmpty }
+    private static let space: [UInt8] = [0x20]
+
+    @inline(__always)
+    private static func isTokenScalar(_ scalar: Unicode.Scalar) -> Bool {
+        switch scalar.value {
+        case 0x30...0x39, 0x61...0x7A: return true
+        case 0..<0x80: return false
+        default: return CharacterSet.alphanumerics.contains(scalar)
+        }
+    }
+}
+
+/// 64-bit FNV-1a: fast, stable across processes (unlike `Hasher`), and
+/// plenty for bucketing features and fingerprinting file contents.
+public enum FNV1a {
+    public static let offsetBasis: UInt64 = 0xcbf29ce484222325
+    static let prime: UInt64 = 0x100000001b3
+
+    @inline(__always)
+    public static func hash<Bytes: Sequence>(_ bytes: Bytes, seed: UInt64 = offsetBasis) -> UInt64 where Bytes.Element == UInt8 {
+        var hash = seed
+        for byte in bytes {
+            hash = (hash ^ UInt64(byte)) &* prime
+        }
+        return hash
     }
 
-    private func stableHash(_ s: String) -> Int {
-        let digest = SHA256.hash(data: Data(s.utf8))
-        let bytes = Array(digest)
-        return abs(Int(bytes[0]) << 24 | Int(bytes[1]) << 16 | Int(bytes[2]) << 8 | Int(bytes[3]))
+    public static func hash(_ data: Data) -> UInt64 {
+        data.withUnsafeBytes { hash($0) }
     }
 }
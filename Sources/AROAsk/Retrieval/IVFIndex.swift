@@ -0,0 +1,257 @@
+// ============================================================
+// IVFIndex.swift
+// AROAsk - inverted-file coarse quantizer for large indexes
+// ============================================================
+//
+// Rows are clustered with spherical k-means into ~sqrt(n) lists. A
+// query scores the centroids first and then only the rows in the
+// `probes` closest lists, so search cost grows with sqrt(n) instead
+// of n. Persisted next to the matrix as `vectors.ivf`:
+//
+//   "AROIVF01" | dimension u32 | listCount u32 |
+//   listCount × dimension Float32 centroids |
+//   (listCount + 1) × u32 list offsets | rowCount × u32 row ids
+
+import Foundation
+
+struct IVFIndex: Sendable {
+    static let magic = Array("AROIVF01".utf8)
+    static let headerSize = 16
+
+    let dimension: Int
+    let listCount: Int
+    /// `listCount × dimension`, each centroid unit length.
+    let centroids: [Float]
+    /// Rows of list `l` are `ids[listOffsets[l]..<listOffsets[l + 1]]`.
+    let listOffsets: [Int]
+    let ids: [UInt32]
+
+    static func suggestedListCount(for rows: Int) -> Int {
+        min(4096, max(1, Int(Double(rows).squareRoot())))
+    }
+
+    /// Whether this index was built for `matrix` (same shape).
+    func matches(_ matrix: VectorMatrix) -> Bool {
+        dimension == matrix.dimension && ids.count == matrix.count
+    }
+
+    // MARK: - Training
+
+    static func train(matrix: VectorMatrix, listCount requested: Int? = nil, iterations: Int = 8) -> IVFIndex {
+        let rowCount = matrix.count
+        let dimension = matrix.dimension
+        let listCount = max(1, min(rowCount, requested ?? suggestedListCount(for: rowCount)))
+
+        // Train on an evenly spaced sample; ~64 rows per list is plenty
+        // for coarse quantization and keeps training off the O(n) path.
+        let sampleCount = min(rowCount, listCount * 64)
+        let sample = (0..<sampleCount).map { $0 * rowCount / sampleCount }
+
+        var centroids = [Float](repeating: 0, count: listCount * dimension)
+        matrix.withRows { rows in
+            for list in 0..<listCount {
+                let row = sample[list * sampleCount / listCount]
+                for d in 0..<dimension {
+                    centroids[list * dimension + d] = rows[row * dimension + d]
+                }
+            }
+        }
+
+        for _ in 0..<iterations {
+            let assignment = nearestLists(of: sample, in: matrix, centroids: centroids, listCount: listCount)
+            var sums = [Float](repeating: 0, count: listCount * dimension)
+            var members = [Int](repeating: 0, count: listCount)
+            matrix.withRows { rows in
+                for (position, row) in sample.enumerated() {
+                    let list = Int(assignment[position])
+                    members[list] += 1
+                    for d in 0..<dimension {
+                        sums[list * dimension + d] += rows[row * dimension + d]
+                    }
+                }
+            }
+            sums.withUnsafeBufferPointer { src in
+                centroids.withUnsafeMutableBufferPointer { dst in
+                    // Empty lists keep their previous centroid
+                    for list in 0..<listCount where members[list] > 0 {
+                        VectorMath.normalize(
+                            src.baseAddress! + list * dimension,
+                            into: dst.baseAddress! + list * dimension,
+                            count: dimension
+                        )
+                    }
+                }
+            }
+        }
+
+        // Assign every row, then lay the lists out contiguously (counting sort).
+        let assignment = nearestLists(of: 0..<rowCount, in: matrix, centroids: centroids, listCount: listCount)
+        var listOffsets = [Int](repeating: 0, count: listCount + 1)
+        for list in assignment {
+            listOffsets[Int(list) + 1] += 1
+        }
+        for list in 0..<listCount {
+            listOffsets[list + 1] += listOffsets[list]
+        }
+        var cursor = listOffsets
+        var ids = [UInt32](repeating: 0, count: rowCount)
+        for (row, list) in assignment.enumerated() {
+            ids[cursor[Int(list)]] = UInt32(row)
+            cursor[Int(list)] += 1
+        }
+
+        return IVFIndex(dimension: dimension, listCount: listCount, centroids: centroids, listOffsets: listOffsets, ids: ids)
+    }
+
+    /// Carry the index over an incremental update without retraining:
+    /// `retained[i]` is the old row now stored at row `i`, and rows from
+    /// `retained.count` on are new and join their nearest existing list.
+    func updated(retaining retained: [Int], in matrix: VectorMatrix) -> IVFIndex {
+        var newRow = [Int](repeating: -1, count: ids.count)
+        for (position, old) in retained.enumerated() {
+            newRow[old] = position
+        }
+        var lists = [[UInt32]](repeating: [], count: listCount)
+        for list in 0..<listCount {
+            for slot in listOffsets[list]..<listOffsets[list + 1] where newRow[Int(ids[slot])] >= 0 {
+                lists[list].append(UInt32(newRow[Int(ids[slot])]))
+            }
+        }
+        let appended = retained.count..<matrix.count
+        let assignment = Self.nearestLists(of: appended, in: matrix, centroids: centroids, listCount: listCount)
+        for (position, list) in assignment.enumerated() {
+            lists[Int(list)].append(UInt32(appended.lowerBound + position))
+        }
+
+        var listOffsets = [0]
+        listOffsets.reserveCapacity(listCount + 1)
+        for list in lists {
+            listOffsets.append(listOffsets[listOffsets.count - 1] + list.count)
+        }
+        return IVFIndex(
+            dimension: dimension,
+            listCount: listCount,
+            centroids: centroids,
+            listOffsets: listOffsets,
+            ids: lists.flatMap { $0 }
+        )
+    }
+
+    private static func nearestLists<Rows: RandomAccessCollection>(
+        of rows: Rows,
+        in matrix: VectorMatrix,
+        centroids: [Float],
+        listCount: Int
+    ) -> [UInt32] where Rows.Element == Int, Rows.Index == Int {
+        let dimension = matrix.dimension
+        var result = [UInt32](repeating: 0, count: rows.count)
+        let ranges = VectorMath.blockRanges(count: rows.count, minimumBlock: 1_024)
+        result.withUnsafeMutableBufferPointer { out in
+            centroids.withUnsafeBufferPointer { centroidBuffer in
+                let centroidBase = centroidBuffer.baseAddress!
+                matrix.withRows { base in
+                    VectorMath.concurrentForEach(ranges) { block in
+                        for position in ranges[block] {
+                            let row = base + rows[rows.startIndex + position] * dimension
+                            var best = 0
+                            var bestScore = -Float.infinity
+                            for list in 0..<listCount {
+                                let score = VectorMath.dot(row, centroidBase + list * dimension, count: dimension)
+                                if score > bestScore {
+                                    bestScore = score
+                                    best = list
+                                }
+                            }
+                            out[position] = UInt32(best)
+                        }
+                    }
+                }
+            }
+        }
+        return result
+    }
+
+    // MARK: - Search
+
+    func search(query: UnsafePointer<Float>, in matrix: VectorMatrix, k: Int, probes: Int) -> [TopKHeap.Entry] {
+        var nearest = TopKHeap(capacity: min(max(1, probes), listCount))
+        centroids.withUnsafeBufferPointer { centroidBuffer in
+            for list in 0..<listCount {
+                let score = VectorMath.dot(query, centroidBuffer.baseAddress! + list * dimension, count: dimension)
+                nearest.offer(score: score, index: list)
+            }
+        }
+
+        var heap = TopKHeap(capacity: k)
+        matrix.withRows { base in
+            for list in nearest.entries {
+                for slot in listOffsets[list.index]..<listOffsets[list.index + 1] {
+                    let row = Int(ids[slot])
+                    heap.offer(score: VectorMath.dot(query, base + row * dimension, count: dimension), index: row)
+                }
+            }
+        }
+        return heap.sorted()
+    }
+
+    // MARK: - Persistence
+
+    init(dimension: Int, listCount: Int, centroids: [Float], listOffsets: [Int], ids: [UInt32]) {
+        self.dimension = dimension
+        self.listCount = listCount
+        self.centroids = centroids
+        self.listOffsets = listOffsets
+        self.ids = ids
+    }
+
+    init(contentsOf url: URL) throws {
+        let data = try Data(contentsOf: url)
+        try IndexFile.validateHeader(data, magic: Self.magic, headerSize: Self.headerSize, url: url)
+        let parsed = data.withUnsafeBytes { raw -> IVFIndex? in
+            let dimension = IndexFile.readUInt32(raw, at: 8)
+            let listCount = IndexFile.readUInt32(raw, at: 12)
+            guard listCount > 0, dimension <= VectorMatrix.maximumDimension else { return nil }
+            let centroidBytes = listCount * dimension * MemoryLayout<Float>.stride
+            let offsetsStart = Self.headerSize + centroidBytes
+            let idsStart = offsetsStart + (listCount + 1) * 4
+            guard raw.count >= idsStart else { return nil }
+
+            var centroids = [Float](repeating: 0, count: listCount * dimension)
+            centroids.withUnsafeMutableBytes { dst in
+                dst.copyMemory(from: UnsafeRawBufferPointer(rebasing: raw[Self.headerSize..<offsetsStart]))
+            }
+            let listOffsets = (0...listCount).map { IndexFile.readUInt32(raw, at: offsetsStart + $0 * 4) }
+            let rowCount = listOffsets[listCount]
+            guard listOffsets[0] == 0,
+                  zip(listOffsets, listOffsets.dropFirst()).allSatisfy({ $0 <= $1 }),
+                  raw.count == idsStart + rowCount * 4 else { return nil }
+            let ids = (0..<rowCount).map { UInt32(IndexFile.readUInt32(raw, at: idsStart + $0 * 4)) }
+            return IVFIndex(dimension: dimension, listCount: listCount, centroids: centroids, listOffsets: listOffsets, ids: ids)
+        }
+        guard let parsed else {
+            throw VectorIndexError.invalidFile("\(url.lastPathComponent) is truncated")
+        }
+        self = parsed
+    }
+
+    func encoded() -> Data {
+        let offsetsStart = Self.headerSize + centroids.count * MemoryLayout<Float>.stride
+        let idsStart = offsetsStart + (listCount + 1) * 4
+        var data = Data(count: idsStart + ids.count * 4)
+        data.withUnsafeMutableBytes { raw in
+            raw.copyBytes(from: Self.magic)
+            IndexFile.write(dimension, asUInt32: raw, at: 8)
+            IndexFile.write(listCount, asUInt32: raw, at: 12)
+            centroids.withUnsafeBytes { src in
+                UnsafeMutableRawBufferPointer(rebasing: raw[Self.headerSize..<offsetsStart]).copyMemory(from: src)
+            }
+            for (list, offset) in listOffsets.enumerated() {
+                IndexFile.write(offset, asUInt32: raw, at: offsetsStart + list * 4)
+            }
+            for (slot, row) in ids.enumerated() {
+                IndexFile.write(Int(row), asUInt32: raw, at: idsStart + slot * 4)
+            }
+        }
+        return data
+    }
+}
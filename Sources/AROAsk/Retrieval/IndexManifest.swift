@@ -0,0 +1,52 @@
+// ============================================================
+// IndexManifest.swift
+// AROAsk - per-file fingerprints for incremental indexing
+// ============================================================
+
+import Foundation
+
+/// What the last index build saw for every file, stored next to the
+/// vectors as `manifest.json`. A file whose size and modification time
+/// match is not read again; one whose content hash matches is not
+/// re-embedded.
+public struct IndexManifest: Codable, Sendable {
+    public struct FileEntry: Codable, Sendable, Equatable {
+        public var modified: Double
+        public var size: Int
+        /// FNV-1a of the file bytes, hex encoded.
+        public var contentHash: String
+        public var chunkCount: Int
+    }
+
+    /// `Embedder.identifier` the vectors were produced with.
+    public var embedder: String
+    public var chunkSize: Int
+    public var files: [String: FileEntry]
+
+    public init(embedder: String, chunkSize: Int, files: [String: FileEntry] = [:]) {
+        self.embedder = embedder
+        self.chunkSize = chunkSize
+        self.files = files
+    }
+
+    public var chunkCount: Int {
+        files.values.reduce(0) { $0 + $1.chunkCount }
+    }
+
+    /// Returns nil when the manifest is missing or unreadable, which
+    /// callers treat as "rebuild everything".
+    public static func load(from url: URL) -> IndexManifest? {
+        guard let data = try? Data(contentsOf: url) else { return nil }
+        return try? JSONDecoder().decode(IndexManifest.self, from: data)
+    }
+
+    public func save(to url: URL) throws {
+        try FileManager.default.createDirectory(
+            at: url.deletingLastPathComponent(),
+            withIntermediateDirectories: true
+        )
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.sortedKeys]
+        try encoder.encode(self).write(to: url, options: .atomic)
+    }
+}
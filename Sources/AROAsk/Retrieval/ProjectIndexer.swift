@@ -5,45 +5,181 @@
 
 import Foundation
 
+/// Result of diffing the project against a previous manifest.
+public struct IndexDelta: Sendable {
+    /// Chunks of every added or changed file (all files on a full rebuild).
+    public var chunks: [IndexChunk]
+    /// Paths whose old chunks must be dropped: changed and deleted files.
+    public var replacedPaths: Set<String>
+    /// Manifest describing the tree after applying this delta.
+    public var manifest: IndexManifest
+    /// True when no usable previous manifest existed.
+    public var isFullRebuild: Bool
+
+    public var isEmpty: Bool { chunks.isEmpty && replacedPaths.isEmpty }
+}
+
 /// Walks the working directory, splits files into chunks, and embeds them.
 public struct ProjectIndexer: Sendable {
     public let root: URL
     public let embedder: any Embedder
     private let chunkSize: Int
     private let extensions: Set<String>
+    private let concurrency: Int
 
     public init(
         root: URL,
         embedder: any Embedder,
         chunkSize: Int = 40,
-        extensions: Set<String> = ["aro", "md", "swift", "yaml", "json", "toml", "py", "rs", "c"]
+        extensions: Set<String> = ["aro", "md", "swift", "yaml", "json", "toml", "py", "rs", "c"],
+        concurrency: Int = ProcessInfo.processInfo.activeProcessorCount
     ) {
         self.root = root
         self.embedder = embedder
         self.chunkSize = chunkSize
         self.extensions = extensions
+        self.concurrency = max(1, concurrency)
     }
 
     public func buildIndex() async throws -> [IndexChunk] {
+        try await update(from: nil).chunks
+    }
+
+    /// Re-chunk and re-embed only the files that changed since `previous`.
+    /// Files are read and embedded in parallel; a manifest built with a
+    /// different embedder or chunk size is ignored.
+    public func update(from previous: IndexManifest?) async throws -> IndexDelta {
+        let baseline = previous.flatMap {
+            $0.embedder == embedder.identifier && $0.chunkSize == chunkSize ? $0 : nil
+        }
+        var manifest = IndexManifest(embedder: embedder.identifier, chunkSize: chunkSize)
+        var pending: [SourceFile] = []
+
+        for file in walk() {
+            if let entry = baseline?.files[file.path],
+               entry.modified == file.modified, entry.size == file.size {
+                manifest.files[file.path] = entry
+            } else {
+                pending.append(file)
+            }
+        }
+
+        let outcomes = try await process(pending, baseline: baseline)
         var chunks: [IndexChunk] = []
-        let fm = FileManager.default
-        guard let enumerator = fm.enumerator(at: root, includingPropertiesForKeys: [.isRegularFileKey]) else {
+        var replacedPaths = Set<String>()
+        for (file, outcome) in zip(pending, outcomes) {
+            guard let outcome else { continue }
+            manifest.files[file.path] = outcome.entry
+            if let fileChunks = outcome.chunks {
+                chunks.append(contentsOf: fileChunks)
+                replacedPaths.insert(file.path)
+            }
+        }
+        if let baseline {
+            for path in baseline.files.keys where manifest.files[path] == nil {
+                replacedPaths.insert(path)
+            }
+        }
+
+        return IndexDelta(
+            chunks: chunks,
+            replacedPaths: replacedPaths,
+            manifest: manifest,
+            isFullRebuild: baseline == nil
+        )
+    }
+
+    // MARK: - Walking
+
+    private struct SourceFile: Sendable {
+        let url: URL
+        let path: String
+        let modified: Double
+        let size: Int
+    }
+
+    private func walk() -> [SourceFile] {
+        let keys: [URLResourceKey] = [.isRegularFileKey, .isDirectoryKey, .contentModificationDateKey, .fileSizeKey]
+        guard let enumerator = FileManager.default.enumerator(at: root, includingPropertiesForKeys: keys) else {
             return []
         }
 
+        var files: [SourceFile] = []
         while let item = enumerator.nextObject() as? URL {
+            let values = try? item.resourceValues(forKeys: Set(keys))
             // Skip hidden dirs and common noise
+            if values?.isDirectory == true {
+                let name = item.lastPathComponent
+                if name.hasPrefix(".") || name == "node_modules" {
+                    enumerator.skipDescendants()
+                }
+                continue
+            }
             let components = item.pathComponents
             if components.contains(where: { $0.hasPrefix(".") || $0 == "node_modules" || $0 == ".build" }) {
                 continue
             }
             guard extensions.contains(item.pathExtension) else { continue }
-            guard let isFile = try? item.resourceValues(forKeys: [.isRegularFileKey]).isRegularFile, isFile else { continue }
-            guard let data = try? Data(contentsOf: item),
-                  let text = String(data: data, encoding: .utf8) else { continue }
+            guard let values, values.isRegularFile == true else { continue }
+
+            files.append(SourceFile(
+                url: item,
+                path: item.path.replacingOccurrences(of: root.path + "/", with: ""),
+                modified: values.contentModificationDate?.timeIntervalSince1970 ?? 0,
+                size: values.fileSize ?? 0
+            ))
+        }
+        return files
+    }
+
+    // MARK: - Embedding
 
-            let relativePath = item.path.replacingOccurrences(of: root.path + "/", with: "")
-            let lines = text.split(separator: "\n", omittingEmptySubsequences: false).map(String.init)
+    private struct FileOutcome: Sendable {
+        let entry: IndexManifest.FileEntry
+        /// nil when the content is unchanged and the stored chunks stay valid.
+        let chunks: [IndexChunk]?
+    }
+
+    /// Process files with at most `concurrency` in flight; results keep input order.
+    private func process(_ files: [SourceFile], baseline: IndexManifest?) async throws -> [FileOutcome?] {
+        guard !files.isEmpty else { return [] }
+        var outcomes = [FileOutcome?](repeating: nil, count: files.count)
+        try await withThrowingTaskGroup(of: (Int, FileOutcome?).self) { group in
+            var next = 0
+            func submit() {
+                let index = next
+                let file = files[index]
+                let previous = baseline?.files[file.path]
+                group.addTask { (index, try await self.indexFile(file, previous: previous)) }
+                next += 1
+            }
+            while next < min(concurrency, files.count) {
+                submit()
+            }
+            while let finished = try await group.next() {
+                outcomes[finished.0] = finished.1
+                if next < files.count {
+                    submit()
+                }
+            }
+        }
+        return outcomes
+    }
+
+    private func indexFile(_ file: SourceFile, previous: IndexManifest.FileEntry?) async throws -> FileOutcome? {
+        guard let data = try? Data(contentsOf: file.url) else { return nil }
+        let contentHash = String(FNV1a.hash(data), radix: 16)
+        if let previous, previous.contentHash == contentHash {
+            // Touched but identical: refresh the stat fields only
+            var entry = previous
+            entry.modified = file.modified
+            entry.size = file.size
+            return FileOutcome(entry: entry, chunks: nil)
+        }
+
+        var chunks: [IndexChunk] = []
+        if let text = String(data: data, encoding: .utf8) {
+            let lines = text.split(separator: "\n", omittingEmptySubsequences: false)
 
             // Split into overlapping chunks
             var start = 0
@@ -52,7 +188,7 @@ public struct ProjectIndexer: Sendable {
                 let chunkText = lines[start..<end].joined(separator: "\n")
                 let vector = try await embedder.embed(chunkText)
                 chunks.append(IndexChunk(
-                    path: relativePath,
+                    path: file.path,
                     startLine: start + 1,
                     endLine: end,
                     text: chunkText,
@@ -61,6 +197,13 @@ public struct ProjectIndexer: Sendable {
                 start += chunkSize / 2  // 50% overlap
             }
         }
-        return chunks
+
+        let entry = IndexManifest.FileEntry(
+            modified: file.modified,
+            size: file.size,
+            contentHash: contentHash,
+            chunkCount: chunks.count
+        )
+        return FileOutcome(entry: entry, chunks: chunks)
     }
 }
@@ -0,0 +1,459 @@
+// ============================================================
+// VectorIndexFormat.swift
+// AROAsk - binary vector matrix, chunk metadata, SIMD scoring
+// ============================================================
+//
+// On-disk layout of the project index (all integers little-endian):
+//
+//   vectors.f32   "AROVEC01" | dimension u32 | count u32 |
+//                 count × dimension Float32, each row unit length
+//   chunks.meta   "AROMETA1" | count u32 | reserved u32 |
+//                 (count + 1) × u64 absolute record offsets |
+//                 records: startLine u32, endLine u32, pathLen u32,
+//                          textLen u32, path bytes, text bytes
+//
+// Both files are memory-mapped on load, so opening a multi-GB index
+// costs a page-table setup rather than a JSON decode, and search only
+// touches the metadata of the k chunks it returns.
+
+import Foundation
+
+/// Errors raised while reading the binary index files.
+public enum VectorIndexError: Error, CustomStringConvertible {
+    case invalidFile(String)
+    case mismatchedIndex(String)
+
+    public var description: String {
+        switch self {
+        case .invalidFile(let detail): return "Invalid vector index file: \(detail)"
+        case .mismatchedIndex(let detail): return "Vector index files do not match: \(detail)"
+        }
+    }
+}
+
+// MARK: - Binary helpers
+
+enum IndexFile {
+    static func validateHeader(_ data: Data, magic: [UInt8], headerSize: Int, url: URL) throws {
+        guard data.count >= headerSize, data.prefix(magic.count).elementsEqual(magic) else {
+            throw VectorIndexError.invalidFile(url.lastPathComponent)
+        }
+    }
+
+    @inline(__always)
+    static func readUInt32(_ raw: UnsafeRawBufferPointer, at offset: Int) -> Int {
+        Int(UInt32(littleEndian: raw.loadUnaligned(fromByteOffset: offset, as: UInt32.self)))
+    }
+
+    @inline(__always)
+    static func readUInt64(_ raw: UnsafeRawBufferPointer, at offset: Int) -> Int {
+        Int(UInt64(littleEndian: raw.loadUnaligned(fromByteOffset: offset, as: UInt64.self)))
+    }
+
+    @inline(__always)
+    static func write(_ value: Int, asUInt32 raw: UnsafeMutableRawBufferPointer, at offset: Int) {
+        raw.storeBytes(of: UInt32(truncatingIfNeeded: value).littleEndian, toByteOffset: offset, as: UInt32.self)
+    }
+
+    @inline(__always)
+    static func write(_ value: Int, asUInt64 raw: UnsafeMutableRawBufferPointer, at offset: Int) {
+        raw.storeBytes(of: UInt64(value).littleEndian, toByteOffset: offset, as: UInt64.self)
+    }
+}
+
+// MARK: - Vector math
+
+enum VectorMath {
+    /// Dot product of two `count`-element vectors using 8-wide SIMD lanes.
+    @inline(__always)
+    static func dot(_ a: UnsafePointer<Float>, _ b: UnsafePointer<Float>, count: Int) -> Float {
+        let ra = UnsafeRawPointer(a), rb = UnsafeRawPointer(b)
+        let stride = MemoryLayout<Float>.stride
+        var acc0 = SIMD8<Float>(), acc1 = SIMD8<Float>()
+        var i = 0
+        while i &+ 16 <= count {
+            acc0 += ra.loadUnaligned(fromByteOffset: i &* stride, as: SIMD8<Float>.self)
+                * rb.loadUnaligned(fromByteOffset: i &* stride, as: SIMD8<Float>.self)
+            acc1 += ra.loadUnaligned(fromByteOffset: (i &+ 8) &* stride, as: SIMD8<Float>.self)
+                * rb.loadUnaligned(fromByteOffset: (i &+ 8) &* stride, as: SIMD8<Float>.self)
+            i &+= 16
+        }
+        if i &+ 8 <= count {
+            acc0 += ra.loadUnaligned(fromByteOffset: i &* stride, as: SIMD8<Float>.self)
+                * rb.loadUnaligned(fromByteOffset: i &* stride, as: SIMD8<Float>.self)
+            i &+= 8
+        }
+        var sum = (acc0 + acc1).sum()
+        while i < count {
+            sum += a[i] * b[i]
+            i &+= 1
+        }
+        return sum
+    }
+
+    /// Write `source` scaled to unit length into `dest`. Zero vectors stay zero.
+    static func normalize(_ source: UnsafePointer<Float>, into dest: UnsafeMutablePointer<Float>, count: Int) {
+        let norm = dot(source, source, count: count).squareRoot()
+        let scale: Float = norm > 0 ? 1 / norm : 0
+        for i in 0..<count {
+            dest[i] = source[i] * scale
+        }
+    }
+
+    static func normalized(_ vector: [Float]) -> [Float] {
+        var result = [Float](repeating: 0, count: vector.count)
+        vector.withUnsafeBufferPointer { src in
+            result.withUnsafeMutableBufferPointer { dst in
+                guard let s = src.baseAddress, let d = dst.baseAddress else { return }
+                normalize(s, into: d, count: vector.count)
+            }
+        }
+        return result
+    }
+
+    /// Split `count` rows into contiguous blocks for `concurrentForEach`.
+    /// Small inputs get a single block so they never pay for a dispatch.
+    static func blockRanges(count: Int, minimumBlock: Int) -> [Range<Int>] {
+        guard count > 0 else { return [] }
+        let blocks = max(1, min(ProcessInfo.processInfo.activeProcessorCount * 2, count / max(1, minimumBlock)))
+        return (0..<blocks).map { b in (b * count / blocks)..<((b + 1) * count / blocks) }
+    }
+
+    /// Run `body` once per block index, in parallel when there is more than one block.
+    static func concurrentForEach(_ ranges: [Range<Int>], _ body: (Int) -> Void) {
+        if ranges.count == 1 {
+            body(0)
+        } else if ranges.count > 1 {
+            DispatchQueue.concurrentPerform(iterations: ranges.count, execute: body)
+        }
+    }
+}
+
+// MARK: - Bounded top-k
+
+/// Fixed-capacity min-heap keeping the `capacity` best-scoring rows.
+/// Ties are broken towards the lower row index so results are stable.
+struct TopKHeap {
+    struct Entry {
+        var score: Float
+        var index: Int
+    }
+
+    let capacity: Int
+    private(set) var entries: [Entry] = []
+
+    init(capacity: Int) {
+        self.capacity = max(0, capacity)
+        entries.reserveCapacity(self.capacity)
+    }
+
+    @inline(__always)
+    private static func isWorse(_ a: Entry, _ b: Entry) -> Bool {
+        a.score < b.score || (a.score == b.score && a.index > b.index)
+    }
+
+    @inline(__always)
+    mutating func offer(score: Float, index: Int) {
+        let candidate = Entry(score: score, index: index)
+        if entries.count < capacity {
+            entries.append(candidate)
+            siftUp(entries.count - 1)
+        } else if capacity > 0 && Self.isWorse(entries[0], candidate) {
+            entries[0] = candidate
+            siftDown(0)
+        }
+    }
+
+    mutating func merge(_ other: TopKHeap) {
+        for entry in other.entries {
+            offer(score: entry.score, index: entry.index)
+        }
+    }
+
+    /// Entries best-first.
+    func sorted() -> [Entry] {
+        entries.sorted { Self.isWorse($1, $0) }
+    }
+
+    private mutating func siftUp(_ start: Int) {
+        var child = start
+        while child > 0 {
+            let parent = (child - 1) / 2
+            guard Self.isWorse(entries[child], entries[parent]) else { return }
+            entries.swapAt(child, parent)
+            child = parent
+        }
+    }
+
+    private mutating func siftDown(_ start: Int) {
+        var parent = start
+        while true {
+            let left = 2 * parent + 1
+            guard left < entries.count else { return }
+            var worst = left
+            let right = left + 1
+            if right < entries.count && Self.isWorse(entries[right], entries[left]) {
+                worst = right
+            }
+            guard Self.isWorse(entries[worst], entries[parent]) else { return }
+            entries.swapAt(worst, parent)
+            parent = worst
+        }
+    }
+}
+
+// MARK: - Vector matrix
+
+/// Row-major Float32 matrix of unit-length vectors, either built in
+/// memory or memory-mapped from `vectors.f32`.
+struct VectorMatrix: Sendable {
+    static let magic = Array("AROVEC01".utf8)
+    static let headerSize = 16
+    /// Rows per parallel block for a flat scan.
+    static let scanBlock = 16_384
+    /// Upper bound accepted when reading headers from disk.
+    static let maximumDimension = 1 << 16
+
+    let storage: Data
+    let dimension: Int
+    let count: Int
+
+    static let empty = VectorMatrix(vectors: [[Float]](), dimension: 0)
+
+    /// Build a matrix from raw vectors, normalizing each row.
+    init<Vectors: Collection>(vectors: Vectors, dimension: Int) where Vectors.Element == [Float] {
+        self.init(retaining: [], of: nil, appending: vectors, dimension: dimension)
+    }
+
+    /// Copy the `retained` rows of `source` (already unit length) and
+    /// append `vectors`, normalizing only the new rows.
+    init<Vectors: Collection>(
+        retaining retained: [Int],
+        of source: VectorMatrix?,
+        appending vectors: Vectors,
+        dimension: Int
+    ) where Vectors.Element == [Float] {
+        let rowCount = retained.count + vectors.count
+        let rowBytes = dimension * MemoryLayout<Float>.stride
+        var data = Data(count: Self.headerSize + rowCount * rowBytes)
+        data.withUnsafeMutableBytes { raw in
+            raw.copyBytes(from: Self.magic)
+            IndexFile.write(dimension, asUInt32: raw, at: 8)
+            IndexFile.write(rowCount, asUInt32: raw, at: 12)
+            let rows = raw.baseAddress!.advanced(by: Self.headerSize).assumingMemoryBound(to: Float.self)
+            if let source, !retained.isEmpty {
+                source.withRows { sourceRows in
+                    for (i, row) in retained.enumerated() {
+                        (rows + i * dimension).update(from: sourceRows + row * dimension, count: dimension)
+                    }
+                }
+            }
+            for (i, vector) in vectors.enumerated() {
+                vector.withUnsafeBufferPointer { src in
+                    guard let s = src.baseAddress else { return }
+                    VectorMath.normalize(s, into: rows + (retained.count + i) * dimension, count: dimension)
+                }
+            }
+        }
+        self.storage = data
+        self.dimension = dimension
+        self.count = rowCount
+    }
+
+    init(contentsOf url: URL) throws {
+        let data = try Data(contentsOf: url, options: .alwaysMapped)
+        try IndexFile.validateHeader(data, magic: Self.magic, headerSize: Self.headerSize, url: url)
+        let (dimension, count) = data.withUnsafeBytes { raw in
+            (IndexFile.readUInt32(raw, at: 8), IndexFile.readUInt32(raw, at: 12))
+        }
+        guard dimension <= Self.maximumDimension,
+              data.count == Self.headerSize + dimension * count * MemoryLayout<Float>.stride else {
+            throw VectorIndexError.invalidFile("\(url.lastPathComponent) is truncated")
+        }
+        self.storage = data
+        self.dimension = dimension
+        self.count = count
+    }
+
+    func withRows<R>(_ body: (UnsafePointer<Float>) throws -> R) rethrows -> R {
+        try storage.withUnsafeBytes { raw in
+            try body(raw.baseAddress!.advanced(by: Self.headerSize).assumingMemoryBound(to: Float.self))
+        }
+    }
+
+    func vector(at index: Int) -> [Float] {
+        withRows { Array(UnsafeBufferPointer(start: $0 + index * dimension, count: dimension)) }
+    }
+
+    /// Exhaustive scan: one bounded heap per block, merged at the end.
+    func search(query: UnsafePointer<Float>, k: Int) -> [TopKHeap.Entry] {
+        let ranges = VectorMath.blockRanges(count: count, minimumBlock: Self.scanBlock)
+        var heaps = [TopKHeap](repeating: TopKHeap(capacity: k), count: ranges.count)
+        let dimension = self.dimension
+        heaps.withUnsafeMutableBufferPointer { slots in
+            withRows { base in
+                VectorMath.concurrentForEach(ranges) { block in
+                    var heap = TopKHeap(capacity: k)
+                    for row in ranges[block] {
+                        heap.offer(score: VectorMath.dot(query, base + row * dimension, count: dimension), index: row)
+                    }
+                    slots[block] = heap
+                }
+            }
+        }
+        var merged = TopKHeap(capacity: k)
+        for heap in heaps {
+            merged.merge(heap)
+        }
+        return merged.sorted()
+    }
+}
+
+// MARK: - Chunk metadata
+
+/// Path, line range and text of every chunk, addressable by row index
+/// without decoding the rest of the file. Loading checks only the header
+/// and the ends of the offset table; each record's offsets and lengths
+/// are checked when it is read, and a damaged record reads as nil.
+struct ChunkMetadataTable: Sendable {
+    static let magic = Array("AROMETA1".utf8)
+    static let headerSize = 16
+    private static let recordHeaderSize = 16
+
+    let storage: Data
+    let count: Int
+
+    static let empty = ChunkMetadataTable(chunks: [])
+
+    init(chunks: [IndexChunk]) {
+        self.init(retaining: [], of: nil, appending: chunks)
+    }
+
+    /// Copy the `retained` records of `source` byte-for-byte and append
+    /// records for `chunks`.
+    init(retaining retained: [Int], of source: ChunkMetadataTable?, appending chunks: [IndexChunk]) {
+        let paths = chunks.map { Array($0.path.utf8) }
+        let texts = chunks.map { Array($0.text.utf8) }
+        let rowCount = retained.count + chunks.count
+        let recordsStart = Self.headerSize + (rowCount + 1) * 8
+        var size = recordsStart
+        if let source {
+            for row in retained {
+                size += source.recordRange(at: row).count
+            }
+        }
+        for i in chunks.indices {
+            size += Self.recordHeaderSize + paths[i].count + texts[i].count
+        }
+
+        var data = Data(count: size)
+        data.withUnsafeMutableBytes { raw in
+            raw.copyBytes(from: Self.magic)
+            IndexFile.write(rowCount, asUInt32: raw, at: 8)
+            var offset = recordsStart
+            if let source {
+                source.storage.withUnsafeBytes { sourceRaw in
+                    for (i, row) in retained.enumerated() {
+                        let range = source.recordRange(at: row)
+                        IndexFile.write(offset, asUInt64: raw, at: Self.headerSize + i * 8)
+                        UnsafeMutableRawBufferPointer(rebasing: raw[offset..<(offset + range.count)])
+                            .copyMemory(from: UnsafeRawBufferPointer(rebasing: sourceRaw[range]))
+                        offset += range.count
+                    }
+                }
+            }
+            for (i, chunk) in chunks.enumerated() {
+                IndexFile.write(offset, asUInt64: raw, at: Self.headerSize + (retained.count + i) * 8)
+                IndexFile.write(chunk.startLine, asUInt32: raw, at: offset)
+                IndexFile.write(chunk.endLine, asUInt32: raw, at: offset + 4)
+                IndexFile.write(paths[i].count, asUInt32: raw, at: offset + 8)
+                IndexFile.write(texts[i].count, asUInt32: raw, at: offset + 12)
+                offset += Self.recordHeaderSize
+                UnsafeMutableRawBufferPointer(rebasing: raw[offset..<(offset + paths[i].count)]).copyBytes(from: paths[i])
+                offset += paths[i].count
+                UnsafeMutableRawBufferPointer(rebasing: raw[offset..<(offset + texts[i].count)]).copyBytes(from: texts[i])
+                offset += texts[i].count
+            }
+            IndexFile.write(offset, asUInt64: raw, at: Self.headerSize + rowCount * 8)
+        }
+        self.storage = data
+        self.count = rowCount
+    }
+
+    init(contentsOf url: URL) throws {
+        let data = try Data(contentsOf: url, options: .alwaysMapped)
+        try IndexFile.validateHeader(data, magic: Self.magic, headerSize: Self.headerSize, url: url)
+        let count = data.withUnsafeBytes { IndexFile.readUInt32($0, at: 8) }
+        let recordsStart = Self.headerSize + (count + 1) * 8
+        let valid = data.count >= recordsStart && data.withUnsafeBytes { raw in
+            Self.readOffset(raw, at: Self.headerSize) == UInt64(recordsStart)
+                && Self.readOffset(raw, at: Self.headerSize + count * 8) == UInt64(raw.count)
+        }
+        guard valid else {
+            throw VectorIndexError.invalidFile("\(url.lastPathComponent) has inconsistent record offsets")
+        }
+        self.storage = data
+        self.count = count
+    }
+
+    private var recordsStart: Int {
+        Self.headerSize + (count + 1) * 8
+    }
+
+    private static func readOffset(_ raw: UnsafeRawBufferPointer, at offset: Int) -> UInt64 {
+        UInt64(littleEndian: raw.loadUnaligned(fromByteOffset: offset, as: UInt64.self))
+    }
+
+    /// Whether record `index` lies inside the file and its lengths add up
+    func isReadable(at index: Int) -> Bool {
+        record(at: index) != nil
+    }
+
+    /// Offset, path length and text length of record `index`, or nil when
+    /// the record is damaged
+    private func record(at index: Int) -> (offset: Int, pathLength: Int, textLength: Int)? {
+        guard index >= 0, index < count else { return nil }
+        let recordsStart = UInt64(self.recordsStart)
+        return storage.withUnsafeBytes { raw in
+            let start = Self.readOffset(raw, at: Self.headerSize + index * 8)
+            let end = Self.readOffset(raw, at: Self.headerSize + (index + 1) * 8)
+            guard start >= recordsStart, start <= end, end <= UInt64(raw.count),
+                  end - start >= UInt64(Self.recordHeaderSize) else { return nil }
+            let offset = Int(start)
+            let pathLength = IndexFile.readUInt32(raw, at: offset + 8)
+            let textLength = IndexFile.readUInt32(raw, at: offset + 12)
+            guard Int(end - start) == Self.recordHeaderSize + pathLength + textLength else { return nil }
+            return (offset, pathLength, textLength)
+        }
+    }
+
+    /// Byte range of record `index`, which must be readable
+    private func recordRange(at index: Int) -> Range<Int> {
+        storage.withUnsafeBytes { raw in
+            IndexFile.readUInt64(raw, at: Self.headerSize + index * 8)..<IndexFile.readUInt64(raw, at: Self.headerSize + (index + 1) * 8)
+        }
+    }
+
+    func path(at index: Int) -> String? {
+        guard let record = record(at: index) else { return nil }
+        return storage.withUnsafeBytes { raw in
+            let pathStart = record.offset + Self.recordHeaderSize
+            return String(decoding: UnsafeRawBufferPointer(rebasing: raw[pathStart..<(pathStart + record.pathLength)]), as: UTF8.self)
+        }
+    }
+
+    func chunk(at index: Int, vector: [Float]) -> IndexChunk? {
+        guard let record = record(at: index) else { return nil }
+        return storage.withUnsafeBytes { raw in
+            let pathStart = record.offset + Self.recordHeaderSize
+            let textStart = pathStart + record.pathLength
+            return IndexChunk(
+                path: String(decoding: UnsafeRawBufferPointer(rebasing: raw[pathStart..<textStart]), as: UTF8.self),
+                startLine: IndexFile.readUInt32(raw, at: record.offset),
+                endLine: IndexFile.readUInt32(raw, at: record.offset + 4),
+                text: String(decoding: UnsafeRawBufferPointer(rebasing: raw[textStart..<(textStart + record.textLength)]), as: UTF8.self),
+                vector: vector
+            )
+        }
+    }
+}
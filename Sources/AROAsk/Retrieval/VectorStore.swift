@@ -1,6 +1,6 @@
 // ============================================================
 // VectorStore.swift
-// AROAsk - flat-file vector store for project search
+// AROAsk - memory-mapped vector store for project search
 // ============================================================
 
 import Foundation
@@ -20,54 +20,143 @@ public struct SearchResult: Sendable {
     public var score: Float
 }
 
-/// Flat JSON vector store persisted to disk.
+/// Vector store persisted as a binary Float32 matrix (`vectors.f32`)
+/// plus a chunk metadata side file (`chunks.meta`), both memory-mapped
+/// on load. Rows are normalized when stored, so cosine similarity is a
+/// single SIMD dot product per chunk and the top k are kept in a
+/// bounded heap. Indexes of `ivfThreshold` chunks or more also carry an
+/// IVF coarse quantizer (`vectors.ivf`) so search only scans the lists
+/// nearest to the query.
 public actor VectorStore {
+    /// Chunk count from which `replaceAll` trains an IVF index.
+    public static let defaultIVFThreshold = 200_000
+
+    /// Legacy flat JSON index; read once for migration, removed on save.
     private let storeURL: URL
-    private var chunks: [IndexChunk] = []
+    private let matrixURL: URL
+    private let metadataURL: URL
+    private let ivfURL: URL
+    private let ivfThreshold: Int
+    private let probes: Int
+
+    private var matrix = VectorMatrix.empty
+    private var metadata = ChunkMetadataTable.empty
+    private var ivf: IVFIndex?
 
-    public init(storeURL: URL) {
+    /// - Parameters:
+    ///   - storeURL: Location of the legacy `vectors.json`; the binary
+    ///     files are kept in the same directory.
+    ///   - ivfThreshold: Minimum chunk count for building an IVF index.
+    ///   - probes: Number of IVF lists scanned per query.
+    public init(storeURL: URL, ivfThreshold: Int = VectorStore.defaultIVFThreshold, probes: Int = 16) {
+        let directory = storeURL.deletingLastPathComponent()
         self.storeURL = storeURL
+        self.matrixURL = directory.appendingPathComponent("vectors.f32")
+        self.metadataURL = directory.appendingPathComponent("chunks.meta")
+        self.ivfURL = directory.appendingPathComponent("vectors.ivf")
+        self.ivfThreshold = ivfThreshold
+        self.probes = probes
     }
 
     public func load() throws {
-        guard FileManager.default.fileExists(atPath: storeURL.path) else { return }
+        let fm = FileManager.default
+        if fm.fileExists(atPath: matrixURL.path) {
+            let loadedMatrix = try VectorMatrix(contentsOf: matrixURL)
+            let loadedMetadata = try ChunkMetadataTable(contentsOf: metadataURL)
+            guard loadedMetadata.count == loadedMatrix.count else {
+                throw VectorIndexError.mismatchedIndex(
+                    "\(loadedMatrix.count) vectors but \(loadedMetadata.count) chunks"
+                )
+            }
+            matrix = loadedMatrix
+            metadata = loadedMetadata
+            // A missing or stale IVF file only costs speed: fall back to a flat scan
+            if let index = try? IVFIndex(contentsOf: ivfURL), index.matches(loadedMatrix) {
+                ivf = index
+            } else {
+                ivf = nil
+            }
+            return
+        }
+
+        guard fm.fileExists(atPath: storeURL.path) else { return }
         let data = try Data(contentsOf: storeURL)
-        chunks = try JSONDecoder().decode([IndexChunk].self, from: data)
+        replaceAll(try JSONDecoder().decode([IndexChunk].self, from: data))
     }
 
     public func save() throws {
-        try FileManager.default.createDirectory(
+        let fm = FileManager.default
+        try fm.createDirectory(
             at: storeURL.deletingLastPathComponent(),
             withIntermediateDirectories: true
         )
-        let data = try JSONEncoder().encode(chunks)
-        try data.write(to: storeURL)
+        // Atomic writes replace the files by rename, so a mapping held
+        // by a concurrent reader keeps seeing the previous index.
+        try metadata.storage.write(to: metadataURL, options: .atomic)
+        if let ivf {
+            try ivf.encoded().write(to: ivfURL, options: .atomic)
+        } else if fm.fileExists(atPath: ivfURL.path) {
+            try fm.removeItem(at: ivfURL)
+        }
+        try matrix.storage.write(to: matrixURL, options: .atomic)
+        if fm.fileExists(atPath: storeURL.path) {
+            try fm.removeItem(at: storeURL)
+        }
     }
 
     public func replaceAll(_ newChunks: [IndexChunk]) {
-        chunks = newChunks
+        let dimension = newChunks.first?.vector.count ?? 0
+        let usable = newChunks.filter { $0.vector.count == dimension }
+        matrix = VectorMatrix(vectors: usable.lazy.map(\.vector), dimension: dimension)
+        metadata = ChunkMetadataTable(chunks: usable)
+        ivf = usable.count >= ivfThreshold && dimension > 0 ? IVFIndex.train(matrix: matrix) : nil
     }
 
-    public func search(query: [Float], k: Int) -> [SearchResult] {
-        chunks.map { chunk in
-            SearchResult(chunk: chunk, score: cosineSimilarity(query, chunk.vector))
+    /// Drop every chunk whose path is in `paths` and append `newChunks`.
+    /// Unchanged rows are copied as-is and an existing IVF index is
+    /// carried over, so the cost scales with the size of the change.
+    public func update(replacingPaths paths: Set<String>, with newChunks: [IndexChunk]) {
+        guard matrix.count > 0 else {
+            replaceAll(newChunks)
+            return
         }
-        .sorted { $0.score > $1.score }
-        .prefix(k)
-        .map { $0 }
-    }
+        let dimension = matrix.dimension
+        // Damaged metadata records are dropped along with their vectors
+        let retained = paths.isEmpty
+            ? (0..<metadata.count).filter(metadata.isReadable)
+            : (0..<metadata.count).filter { metadata.path(at: $0).map { !paths.contains($0) } ?? false }
+        let usable = newChunks.filter { $0.vector.count == dimension }
+        let previous = matrix
+        matrix = VectorMatrix(retaining: retained, of: previous, appending: usable.lazy.map(\.vector), dimension: dimension)
+        metadata = ChunkMetadataTable(retaining: retained, of: metadata, appending: usable)
 
-    public var count: Int { chunks.count }
+        if matrix.count < ivfThreshold || dimension == 0 {
+            ivf = nil
+        } else if let ivf, ivf.matches(previous) {
+            self.ivf = ivf.updated(retaining: retained, in: matrix)
+        } else {
+            ivf = IVFIndex.train(matrix: matrix)
+        }
+    }
 
-    private func cosineSimilarity(_ a: [Float], _ b: [Float]) -> Float {
-        guard a.count == b.count else { return 0 }
-        var dot: Float = 0, normA: Float = 0, normB: Float = 0
-        for i in 0..<a.count {
-            dot += a[i] * b[i]
-            normA += a[i] * a[i]
-            normB += b[i] * b[i]
+    public func search(query: [Float], k: Int) -> [SearchResult] {
+        guard k > 0, matrix.count > 0, matrix.dimension > 0, query.count == matrix.dimension else { return [] }
+        let normalizedQuery = VectorMath.normalized(query)
+        let hits = normalizedQuery.withUnsafeBufferPointer { buffer in
+            if let ivf {
+                return ivf.search(query: buffer.baseAddress!, in: matrix, k: k, probes: probes)
+            }
+            return matrix.search(query: buffer.baseAddress!, k: k)
+        }
+        return hits.compactMap { hit in
+            metadata.chunk(at: hit.index, vector: matrix.vector(at: hit.index)).map {
+                SearchResult(chunk: $0, score: hit.score)
+            }
         }
-        let denom = sqrt(normA) * sqrt(normB)
-        return denom > 0 ? dot / denom : 0
     }
+
+    public var count: Int { matrix.count }
+
+    /// Whether searches go through the IVF index rather than a flat scan.
+    public var usesIVF: Bool { ivf != nil }
 }
@@ -18,12 +18,18 @@
 // each ARO feature set becomes an LLVM function with a `DISubprogram`
 // pointing at its `.aro` source location, so lldb backtraces report
 // file + line of the function entry.
+//
+// `Transforms/PassBuilder.h` and `Error.h` give the optimizer
+// (`LLVMOptimizationPipeline`) `LLVMRunPasses` for running the new
+// pass manager's pipelines over a generated module.
 
 #ifndef AROC_DEBUG_INFO_H
 #define AROC_DEBUG_INFO_H
 
 #include <llvm-c/Core.h>
 #include <llvm-c/DebugInfo.h>
+#include <llvm-c/Error.h>
+#include <llvm-c/Transforms/PassBuilder.h>
 #include <llvm-c/Types.h>
 
 #endif // AROC_DEBUG_INFO_H
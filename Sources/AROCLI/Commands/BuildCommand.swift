@@ -206,7 +206,6 @@ struct BuildCommand: AsyncParsableCommand {
             .standardizedFileURL
         let intermediateBaseName = binaryPath.deletingPathExtension().lastPathComponent
         let llPath = buildDir.appendingPathComponent("\(intermediateBaseName).ll")
-        let objectPath = buildDir.appendingPathComponent("\(intermediateBaseName).o").path
 
         AROLogger.debug("Binary path: \(binaryPath.path)", subsystem: "build")
 
@@ -302,75 +301,88 @@ struct BuildCommand: AsyncParsableCommand {
         print("Use 'aro run' to execute ARO programs in interpreter mode instead.")
         throw ExitCode.failure
         #else
-        let llvmResult: LLVMCodeGenerationResult
-
-        do {
-            let codeGenerator = LLVMCodeGenerator()
-            llvmResult = try codeGenerator.generate(
-                program: mergedProgram,
-                openAPISpecJSON: openAPISpecJSON,
-                templatesJSON: templatesJSON,
-                embeddedPlugins: embeddedPlugins.isEmpty ? nil : embeddedPlugins,
-                staticPlugins: staticPluginIRInfos.isEmpty ? nil : staticPluginIRInfos,
-                pythonPlugins: pythonPluginIRInfos.isEmpty ? nil : pythonPluginIRInfos
-            )
-            AROLogger.debug("LLVM IR generated successfully", subsystem: "build")
-        } catch {
-            AROLogger.error("LLVM generation failed: \(error)", subsystem: "build")
-            print("Code generation error: \(error)")
-            throw ExitCode.failure
-        }
+        // Release mode enables all optimizations
+        let effectiveOptimize = optimize || release
+        let effectiveSize = size || release
+        let effectiveStrip = strip || release
 
-        if verbose {
-            print("  LLVM module generated")
-        }
+        // The level drives both the IR pass pipeline and llc. llc only
+        // supports O0-O3, use O2 for both speed and size optimization
+        // (size optimization is applied during linking stage with -Os)
+        let optLevel: LLVMEmitter.OptimizationLevel = (effectiveOptimize || effectiveSize) ? .o2 : .none
 
-        // Write LLVM IR text if requested
+        // Write LLVM IR text if requested. The whole program goes into
+        // one module so the file can be read and compiled on its own.
         if emitLLVM {
             do {
+                let llvmResult = try LLVMCodeGenerator(optimizationLevel: optLevel).generate(
+                    program: mergedProgram,
+                    openAPISpecJSON: openAPISpecJSON,
+                    templatesJSON: templatesJSON,
+                    embeddedPlugins: embeddedPlugins.isEmpty ? nil : embeddedPlugins,
+                    staticPlugins: staticPluginIRInfos.isEmpty ? nil : staticPluginIRInfos,
+                    pythonPlugins: pythonPluginIRInfos.isEmpty ? nil : pythonPluginIRInfos
+                )
+                AROLogger.debug("LLVM IR generated successfully", subsystem: "build")
                 try llvmResult.irText.write(toFile: llPath.path, atomically: true, encoding: .utf8)
                 print("LLVM IR written to: \(llPath.path)")
             } catch {
-                print("Error writing LLVM IR: \(error)")
+                AROLogger.error("LLVM generation failed: \(error)", subsystem: "build")
+                print("Code generation error: \(error)")
                 throw ExitCode.failure
             }
             return
         }
 
-        // Write LLVM IR to file for llc
+        // One module per feature set plus main, so unchanged feature
+        // sets reuse their object from the previous build
+        let llvmUnits: [LLVMCodeGenerationUnit]
+
         do {
-            try llvmResult.irText.write(toFile: llPath.path, atomically: true, encoding: .utf8)
-            if verbose {
-                print("  LLVM IR written: \(llPath.lastPathComponent)")
-            }
+            let codeGenerator = LLVMCodeGenerator(optimizationLevel: optLevel)
+            llvmUnits = try codeGenerator.generateModules(
+                program: mergedProgram,
+                openAPISpecJSON: openAPISpecJSON,
+                templatesJSON: templatesJSON,
+                embeddedPlugins: embeddedPlugins.isEmpty ? nil : embeddedPlugins,
+                staticPlugins: staticPluginIRInfos.isEmpty ? nil : staticPluginIRInfos,
+                pythonPlugins: pythonPluginIRInfos.isEmpty ? nil : pythonPluginIRInfos
+            )
+            AROLogger.debug("LLVM IR generated successfully (\(llvmUnits.count) modules)", subsystem: "build")
         } catch {
-            print("Error writing LLVM IR: \(error)")
+            AROLogger.error("LLVM generation failed: \(error)", subsystem: "build")
+            print("Code generation error: \(error)")
             throw ExitCode.failure
         }
 
-        // Compile LLVM IR to object file using llc
         if verbose {
-            print("Emitting object file...")
+            print("  \(llvmUnits.count) LLVM modules generated")
         }
 
-        // Release mode enables all optimizations
-        let effectiveOptimize = optimize || release
-        let effectiveSize = size || release
-        let effectiveStrip = strip || release
+        // Compile changed modules to object files using llc
+        if verbose {
+            print("Emitting object files...")
+        }
 
-        let emitter = LLVMEmitter()
-        // llc only supports O0-O3, use O2 for both speed and size optimization
-        // (size optimization is applied during linking stage with -Os)
-        let optLevel: LLVMEmitter.OptimizationLevel = (effectiveOptimize || effectiveSize) ? .o2 : .none
+        let objectCache = LLVMObjectCache(
+            directory: buildDir.appendingPathComponent("aro-cache").path,
+            optimize: optLevel
+        )
+        let programObjects: [String]
 
         do {
-            try emitter.emitObject(irPath: llPath.path, to: objectPath, optimize: optLevel)
+            let cached = try objectCache.objects(for: llvmUnits, keepIntermediate: keepIntermediate)
+            programObjects = cached.objectPaths
+            AROLogger.debug("Compiled \(cached.compiledCount) of \(llvmUnits.count) modules, evicted \(cached.evictedCount) stale objects", subsystem: "build")
             if verbose {
-                print("  Object file created")
+                print("  \(cached.compiledCount) of \(llvmUnits.count) object files compiled, \(llvmUnits.count - cached.compiledCount) cached")
             }
+        } catch let error as LLVMObjectCache.CompileError {
+            print("LLVM emission error: \(error)")
+            print("LLVM IR at: \(error.irPath) for debugging")
+            throw ExitCode.failure
         } catch {
             print("LLVM emission error: \(error)")
-            print("LLVM IR at: \(llPath.path) for debugging")
             throw ExitCode.failure
         }
 
@@ -400,7 +412,7 @@ struct BuildCommand: AsyncParsableCommand {
         }
 
         AROLogger.debug("Starting linker", subsystem: "build")
-        AROLogger.debug("Object file: \(objectPath)", subsystem: "build")
+        AROLogger.debug("Object files: \(programObjects.count)", subsystem: "build")
         AROLogger.debug("Output path: \(binaryPath.path)", subsystem: "build")
 
         AROLogger.debug("Creating CCompiler with runtime: \(runtimeLibPath)", subsystem: "build")
@@ -426,13 +438,13 @@ struct BuildCommand: AsyncParsableCommand {
         )
 
         AROLogger.debug("LinkOptions created", subsystem: "build")
-        AROLogger.debug("About to call linker.link() with objectFiles: [\(objectPath)], outputPath: \(binaryPath.path)", subsystem: "build")
+        AROLogger.debug("About to call linker.link() with \(programObjects.count) program objects, outputPath: \(binaryPath.path)", subsystem: "build")
 
         do {
             AROLogger.debug("Calling linker.link()...", subsystem: "build")
 
             // Collect all object files: main program + statically-linked plugins + Python lib
-            var allObjectFiles = [objectPath]
+            var allObjectFiles = programObjects
             for pluginInfo in staticPluginInfos {
                 allObjectFiles.append(contentsOf: pluginInfo.objectFiles)
             }
@@ -498,12 +510,10 @@ struct BuildCommand: AsyncParsableCommand {
         }
         #endif
 
-        // Cleanup intermediate files
-        if !keepIntermediate {
-            try? FileManager.default.removeItem(at: llPath)
-            try? FileManager.default.removeItem(atPath: objectPath)
-        } else if verbose {
-            print("  Intermediate files kept at: \(buildDir.path)")
+        // Object files stay in the cache for the next build; the cache
+        // only writes .ll files for compiled modules when asked to keep them
+        if keepIntermediate && verbose {
+            print("  Intermediate files kept at: \(objectCache.directory)")
         }
 
         // Compile legacy plugins/ if present (ARO-0031: plugins are compiled during build, not at runtime)
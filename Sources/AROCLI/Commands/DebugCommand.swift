@@ -449,8 +449,12 @@ final class CLIDebugFrontend: DebugFrontend, @unchecked Sendable {
                     let lhs = String(arg[..<ifRange.lowerBound]).trimmingCharacters(in: .whitespaces)
                     let pred = String(arg[ifRange.upperBound...]).trimmingCharacters(in: .whitespaces)
                     if let line = Int(lhs) {
-                        await controller.addBreakpoint(.conditionalLocation(file: pause.file, line: line, predicate: pred))
-                        print("conditional breakpoint at \(pause.file.isEmpty ? "*" : pause.file):\(line) if \(pred)")
+                        do {
+                            try await controller.addConditionalBreakpoint(file: pause.file, line: line, condition: pred)
+                            print("conditional breakpoint at \(pause.file.isEmpty ? "*" : pause.file):\(line) if \(pred)")
+                        } catch {
+                            print("invalid condition (\(error))")
+                        }
                     } else {
                         print("conditional breakpoints require a line number")
                     }
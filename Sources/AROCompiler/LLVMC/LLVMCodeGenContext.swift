@@ -119,9 +119,14 @@ public final class LLVMCodeGenContext {
 
     // MARK: - Initialization
 
+    /// Prefix for module-level symbols this context invents (loop body
+    /// functions), so separately generated modules can be linked together
+    public let symbolPrefix: String
+
     /// Creates a new code generation context
-    public init(moduleName: String = "aro_program") {
+    public init(moduleName: String = "aro_program", symbolPrefix: String = "") {
         self.module = Module(moduleName)
+        self.symbolPrefix = symbolPrefix
     }
 
     // MARK: - String Constants
@@ -187,7 +192,7 @@ public final class LLVMCodeGenContext {
 
     /// Generates a unique loop body function name
     public func uniqueLoopBodyName() -> String {
-        let name = "aro_loop_body_\(loopBodyCounter)"
+        let name = "aro_loop_body_\(symbolPrefix)\(loopBodyCounter)"
         loopBodyCounter += 1
         return name
     }
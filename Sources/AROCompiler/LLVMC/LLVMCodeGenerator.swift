@@ -22,6 +22,20 @@ public struct LLVMCodeGenerationResult {
     }
 }
 
+/// One module of a split build (see `LLVMCodeGenerator.generateModules`)
+public struct LLVMCodeGenerationUnit: Sendable {
+    /// Module name: the feature set function it defines, or "aro_main"
+    public let name: String
+
+    /// The module's LLVM IR text
+    public let irText: String
+
+    public init(name: String, irText: String) {
+        self.name = name
+        self.irText = irText
+    }
+}
+
 /// Metadata for a statically-linked plugin passed to LLVM IR generation.
 /// The object files are linked separately; the code generator only needs
 /// the plugin name, YAML, and which symbols exist.
@@ -82,9 +96,15 @@ public final class LLVMCodeGenerator {
     /// Stack of break target blocks for nested loops (top = innermost loop)
     private var breakBlockStack: [BasicBlock] = []
 
+    /// IR-level optimization applied to every module before its text
+    /// is returned (`.none` leaves the IR as generated)
+    private let optimizationLevel: LLVMEmitter.OptimizationLevel
+
     // MARK: - Initialization
 
-    public init() {}
+    public init(optimizationLevel: LLVMEmitter.OptimizationLevel = .none) {
+        self.optimizationLevel = optimizationLevel
+    }
 
     // MARK: - Main Entry Point
 
@@ -109,10 +129,96 @@ public final class LLVMCodeGenerator {
         pythonBundle: PythonBundleIRInfo? = nil,
         sourceFilename: String? = nil
     ) throws -> LLVMCodeGenerationResult {
-        // Initialize components
-        ctx = LLVMCodeGenContext(moduleName: "aro_program")
+        beginModule(named: "aro_program", symbolPrefix: "", sourceFilename: sourceFilename)
+
+        // Create global runtime variable
+        createGlobalRuntime()
+
+        // Validate entry point
+        try validateEntryPoint(program)
+
+        // Collect and emit string constants
+        let stringCollector = StringConstantCollector(context: ctx)
+        stringCollector.collect(from: program, openAPISpecJSON: openAPISpecJSON, templatesJSON: templatesJSON, embeddedPlugins: embeddedPlugins, staticPlugins: staticPlugins, pythonPlugins: pythonPlugins)
+
+        // Generate feature set functions
+        for analyzedFS in program.featureSets {
+            generateFeatureSet(analyzedFS)
+        }
+
+        // Generate main function
+        generateMainFunction(program: program, openAPISpecJSON: openAPISpecJSON, templatesJSON: templatesJSON, embeddedPlugins: embeddedPlugins, staticPlugins: staticPlugins, pythonPlugins: pythonPlugins, pythonBundle: pythonBundle)
+
+        return LLVMCodeGenerationResult(irText: try finishModule())
+    }
+
+    /// Generates the program as separately compiled modules: one per
+    /// feature set, plus a main module with `main`, the runtime global and
+    /// the embedded resources, which declares the feature set functions.
+    ///
+    /// A feature set module's IR depends only on that feature set, so an
+    /// unchanged feature set produces the same text on every build and
+    /// its object file can be reused. Feature sets that share a function
+    /// name (e.g. duplicate handlers) stay in one module, as they would
+    /// in the single-module build. Parameters match `generate`.
+    /// - Returns: The feature set modules in program order, then main
+    public func generateModules(
+        program: AnalyzedProgram,
+        openAPISpecJSON: String? = nil,
+        templatesJSON: String? = nil,
+        embeddedPlugins: [(name: String, yaml: String, base64Library: String)]? = nil,
+        staticPlugins: [StaticPluginIRInfo]? = nil,
+        pythonPlugins: [EmbeddedPythonPluginIRInfo]? = nil,
+        pythonBundle: PythonBundleIRInfo? = nil,
+        sourceFilename: String? = nil
+    ) throws -> [LLVMCodeGenerationUnit] {
+        try validateEntryPoint(program)
+
+        var groups: [(functionName: String, featureSets: [AnalyzedFeatureSet])] = []
+        var groupIndex: [String: Int] = [:]
+        for analyzedFS in program.featureSets {
+            let funcName = functionName(for: analyzedFS.featureSet)
+            if let index = groupIndex[funcName] {
+                groups[index].featureSets.append(analyzedFS)
+            } else {
+                groupIndex[funcName] = groups.count
+                groups.append((funcName, [analyzedFS]))
+            }
+        }
+
+        var units: [LLVMCodeGenerationUnit] = []
+        units.reserveCapacity(groups.count + 1)
+        for group in groups {
+            // Loop bodies are named after the module so they stay unique
+            // when the objects are linked together
+            beginModule(named: group.functionName, symbolPrefix: "\(group.functionName)_", sourceFilename: sourceFilename)
+            for analyzedFS in group.featureSets {
+                generateFeatureSet(analyzedFS)
+            }
+            units.append(LLVMCodeGenerationUnit(name: group.functionName, irText: try finishModule()))
+        }
+
+        // String constants are created on first use here rather than
+        // collected up front, so statement text doesn't leak into main
+        beginModule(named: "aro_main", symbolPrefix: "", sourceFilename: sourceFilename)
+        createGlobalRuntime()
+        for group in groups {
+            _ = ctx.module.declareFunction(group.functionName, types.featureSetFunctionType)
+        }
+        generateMainFunction(program: program, openAPISpecJSON: openAPISpecJSON, templatesJSON: templatesJSON, embeddedPlugins: embeddedPlugins, staticPlugins: staticPlugins, pythonPlugins: pythonPlugins, pythonBundle: pythonBundle)
+        units.append(LLVMCodeGenerationUnit(name: "aro_main", irText: try finishModule()))
+
+        return units
+    }
+
+    /// Start a fresh module with its own context, type mapper, external
+    /// declarations and debug info
+    private func beginModule(named name: String, symbolPrefix: String, sourceFilename: String?) {
+        ctx = LLVMCodeGenContext(moduleName: name, symbolPrefix: symbolPrefix)
         types = LLVMTypeMapper(context: ctx)
         externals = LLVMExternalDeclEmitter(context: ctx, types: types)
+        globalRuntime = nil
+        breakBlockStack = []
 
         // Issue #231 — DWARF emitter. Function-level debug info: each
         // feature set gets a DISubprogram. lldb backtraces report
@@ -132,25 +238,11 @@ public final class LLVMCodeGenerator {
 
         // Declare external functions
         externals.declareAllExternals()
+    }
 
-        // Create global runtime variable
-        createGlobalRuntime()
-
-        // Validate entry point
-        try validateEntryPoint(program)
-
-        // Collect and emit string constants
-        let stringCollector = StringConstantCollector(context: ctx)
-        stringCollector.collect(from: program, openAPISpecJSON: openAPISpecJSON, templatesJSON: templatesJSON, embeddedPlugins: embeddedPlugins, staticPlugins: staticPlugins, pythonPlugins: pythonPlugins)
-
-        // Generate feature set functions
-        for analyzedFS in program.featureSets {
-            generateFeatureSet(analyzedFS)
-        }
-
-        // Generate main function
-        generateMainFunction(program: program, openAPISpecJSON: openAPISpecJSON, templatesJSON: templatesJSON, embeddedPlugins: embeddedPlugins, staticPlugins: staticPlugins, pythonPlugins: pythonPlugins, pythonBundle: pythonBundle)
-
+    /// Check for recorded errors, finalize debug info, verify the
+    /// module and return its IR text
+    private func finishModule() throws -> String {
         // Fail explicitly if any errors were recorded during generation
         if ctx.hasErrors {
             let messages = ctx.errors.map(\.description).joined(separator: "\n")
@@ -161,17 +253,18 @@ public final class LLVMCodeGenerator {
 
         // Issue #231 — flush pending DI metadata before module
         // verification reads it. Must run exactly once; subsequent
-        // passes through `generate()` create a fresh emitter above.
+        // modules create a fresh emitter in `beginModule`.
         debugInfo?.finalize()
         debugInfo = nil
 
         // Verify module
         try verifyModule()
 
-        // Get IR text
-        let irText = ctx.module.description
+        // Run the IR passes for the requested level
+        try LLVMOptimizationPipeline(level: optimizationLevel).run(on: ctx.module)
 
-        return LLVMCodeGenerationResult(irText: irText)
+        // Get IR text
+        return ctx.module.description
     }
 
     // MARK: - Module Setup
@@ -230,16 +323,7 @@ public final class LLVMCodeGenerator {
 
     private func generateFeatureSet(_ analyzed: AnalyzedFeatureSet) {
         let fs = analyzed.featureSet
-        // Use unique function name for Application-Start/End to support module imports
-        // and avoid collisions between Success/Error variants
-        let funcName: String
-        if fs.name == "Application-Start" {
-            funcName = applicationStartFunctionName(fs.businessActivity)
-        } else if fs.name == "Application-End" {
-            funcName = applicationEndFunctionName(fs.businessActivity)
-        } else {
-            funcName = featureSetFunctionName(fs.name)
-        }
+        let funcName = functionName(for: fs)
 
         // Create function
         let funcType = types.featureSetFunctionType
@@ -340,6 +424,18 @@ public final class LLVMCodeGenerator {
         ctx.module.insertReturn(ctx.ptrType.null, at: ctx.insertionPoint)
     }
 
+    /// Symbol of a feature set's function. Application-Start/End get the
+    /// business activity in their name to support module imports and to
+    /// avoid collisions between Success/Error variants.
+    private func functionName(for fs: FeatureSet) -> String {
+        if fs.name == "Application-Start" {
+            return applicationStartFunctionName(fs.businessActivity)
+        } else if fs.name == "Application-End" {
+            return applicationEndFunctionName(fs.businessActivity)
+        }
+        return featureSetFunctionName(fs.name)
+    }
+
     private func featureSetFunctionName(_ name: String) -> String {
         let sanitized = name
             .lowercased()
@@ -6,6 +6,7 @@
 #if !os(Windows)
 import SwiftyLLVM
 import AROParser
+import AROCDebugInfo
 
 /// Declares external functions from the ARO runtime bridge
 public final class LLVMExternalDeclEmitter {
@@ -109,6 +110,39 @@ public final class LLVMExternalDeclEmitter {
         declareCollectionOperations()
         declareAllActionFunctions()
         declareStandardLibrary()
+        addBridgeAttributes()
+    }
+
+    // MARK: - Bridge Attributes
+
+    /// Give the runtime bridge declarations attributes the optimizer can
+    /// use. Every bridge function is `nounwind`: they are `@_cdecl` Swift
+    /// functions, and Swift errors never unwind through them. None is
+    /// marked `memory(read)`: even the queries take locks or retain and
+    /// release their arguments. Plugin symbols are declared later and
+    /// keep no attributes.
+    private func addBridgeAttributes() {
+        let moduleRef = unsafeBitCast(ctx.module.llvm, to: LLVMModuleRef.self)
+        guard let contextRef = LLVMGetModuleContext(moduleRef) else { return }
+
+        let nounwind = LLVMCreateEnumAttribute(contextRef, Self.attributeKind("nounwind"), 0)
+
+        var function = LLVMGetFirstFunction(moduleRef)
+        while let current = function {
+            function = LLVMGetNextFunction(current)
+            guard LLVMIsDeclaration(current) != 0 else { continue }
+
+            var length = 0
+            guard let cName = LLVMGetValueName2(current, &length),
+                  String(cString: cName).hasPrefix("aro_") else { continue }
+
+            // LLVMAttributeFunctionIndex is ~0U
+            LLVMAddAttributeToFunction(current, LLVMAttributeIndex.max, nounwind)
+        }
+    }
+
+    private static func attributeKind(_ name: String) -> UInt32 {
+        LLVMGetEnumAttributeKindForName(name, name.utf8.count)
     }
 
     // MARK: - Runtime Lifecycle
@@ -0,0 +1,52 @@
+// ============================================================
+// LLVMOptimizationPipeline.swift
+// ARO Compiler - IR Optimization Passes
+// ============================================================
+
+#if !os(Windows)
+import Foundation
+import SwiftyLLVM
+import AROCDebugInfo
+
+/// Runs LLVM's standard optimization pipeline over a generated module.
+///
+/// `LLVMEmitter` passes the optimization level to llc, which only
+/// controls code generation. The IR-level passes (SROA, inlining, GVN,
+/// LICM, ...) run here, in process, through the new pass manager's
+/// `default<On>` pipelines, so the IR handed to llc is already
+/// optimized. At `.none` the module is left untouched.
+struct LLVMOptimizationPipeline {
+    let level: LLVMEmitter.OptimizationLevel
+
+    /// Pass pipeline for `LLVMRunPasses`, or nil when nothing should run
+    var passes: String? {
+        switch level {
+        case .none: return nil
+        case .o1: return "default<O1>"
+        case .o2: return "default<O2>"
+        case .o3: return "default<O3>"
+        }
+    }
+
+    /// Optimize `module` in place
+    func run(on module: SwiftyLLVM.Module) throws {
+        guard let passes else { return }
+
+        let moduleRef = unsafeBitCast(module.llvm, to: LLVMModuleRef.self)
+        guard let options = LLVMCreatePassBuilderOptions() else {
+            throw LLVMCodeGenError.llvmInternalError(message: "Could not create pass builder options")
+        }
+        defer { LLVMDisposePassBuilderOptions(options) }
+
+        // No target machine: the passes fall back to generic cost
+        // models, and llc still does target-specific codegen afterwards
+        if let error = LLVMRunPasses(moduleRef, passes, nil, options) {
+            let cMessage = LLVMGetErrorMessage(error)
+            let message = cMessage.map { String(cString: $0) } ?? "unknown error"
+            LLVMDisposeErrorMessage(cMessage)
+            throw LLVMCodeGenError.llvmInternalError(message: "Optimization pipeline \(passes) failed: \(message)")
+        }
+    }
+}
+
+#endif
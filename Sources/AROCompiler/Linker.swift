@@ -93,6 +93,19 @@ public final class LLVMEmitter {
         #endif
     }
 
+    /// Path and LLVM version of the tool `emitObject` runs. Objects built
+    /// by different compilers differ, so `LLVMObjectCache` keys on this.
+    public func compilerIdentity() throws -> String {
+        #if os(Windows)
+        let path = try findClang()
+        #elseif os(macOS)
+        let path = "/usr/bin/clang"
+        #else
+        let path = try findLLC()
+        #endif
+        return "\(path) \(getLLVMVersion(path) ?? "unknown")"
+    }
+
     // MARK: - Private Methods
 
     private func findLLC() throws -> String {
@@ -178,8 +191,13 @@ public final class LLVMEmitter {
 
     /// Get LLVM major version from llc
     private func getLLVMMajorVersion(_ llcPath: String) -> Int? {
+        getLLVMVersion(llcPath).flatMap { Int($0.prefix { $0 != "." }) }
+    }
+
+    /// Get the full LLVM version, e.g. "20.1.8", from llc or clang
+    private func getLLVMVersion(_ toolPath: String) -> String? {
         let process = Process()
-        process.executableURL = URL(fileURLWithPath: llcPath)
+        process.executableURL = URL(fileURLWithPath: toolPath)
         process.arguments = ["--version"]
 
         let pipe = Pipe()
@@ -192,11 +210,11 @@ public final class LLVMEmitter {
             let data = pipe.fileHandleForReading.readDataToEndOfFile()
             if let output = String(data: data, encoding: .utf8) {
                 // Look for version pattern like "LLVM version 14.0.0" or "version 20.1.8"
-                let pattern = #"version (\d+)\."#
+                let pattern = #"version (\d+(?:\.\d+)+)"#
                 if let regex = try? NSRegularExpression(pattern: pattern, options: []),
                    let match = regex.firstMatch(in: output, options: [], range: NSRange(output.startIndex..., in: output)),
                    let range = Range(match.range(at: 1), in: output) {
-                    return Int(output[range])
+                    return String(output[range])
                 }
             }
         } catch {}
@@ -0,0 +1,281 @@
+// ============================================================
+// ObjectCache.swift
+// AROCompiler - Content-Addressed Object File Cache
+// ============================================================
+
+import Foundation
+
+/// Compiles the modules of a split build (`LLVMCodeGenerator.generateModules`)
+/// to object files, reusing objects from earlier builds.
+///
+/// Each object is stored as `<key>.o`, where the key hashes the module's
+/// IR text together with everything else that affects the object: the
+/// optimization level, the host platform, the compiler's path and LLVM
+/// version, and any extra flags. A module whose key is already in the
+/// cache is not compiled again; the others are compiled in parallel.
+///
+/// Every build refreshes the modification date of the objects it uses.
+/// After a successful build, objects no build has used for `retention`
+/// (a week by default) are removed, so the directory doesn't grow with
+/// every edit. Objects another project or optimization level still uses
+/// are never that old, so builds sharing a cache directory don't evict
+/// each other's objects.
+///
+/// ```swift
+/// let cache = LLVMObjectCache(directory: ".build/aro-cache", optimize: .o2)
+/// let result = try cache.objects(for: units)
+/// try linker.link(objectFiles: result.objectPaths, ...)
+/// ```
+public final class LLVMObjectCache {
+    // MARK: - Types
+
+    /// Compiles the IR file at the first path to an object at the second
+    public typealias Compile = @Sendable (_ irPath: String, _ outputPath: String) throws -> Void
+
+    /// Objects for a list of modules
+    public struct Result: Sendable {
+        /// One object per module, in module order
+        public let objectPaths: [String]
+
+        /// Number of modules that were compiled rather than reused
+        public let compiledCount: Int
+
+        /// Number of stale objects removed from the cache
+        public let evictedCount: Int
+    }
+
+    /// A module failed to compile. The IR is left at `irPath`.
+    public struct CompileError: Error, CustomStringConvertible {
+        public let module: String
+        public let irPath: String
+        public let underlying: Error
+
+        public var description: String {
+            "\(module): \(underlying)"
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Bump when the layout or meaning of cached objects changes
+    static let formatVersion = "1"
+
+    /// How long an object no build uses is kept: one week
+    public static let defaultRetention: TimeInterval = 7 * 24 * 60 * 60
+
+    /// Cache directory, created on first use
+    public let directory: String
+
+    private let optimize: LLVMEmitter.OptimizationLevel
+    private let compiler: String
+    private let flags: [String]
+    private let retention: TimeInterval
+    private let compile: Compile
+
+    // MARK: - Initialization
+
+    /// - Parameters:
+    ///   - directory: Where objects are kept, e.g. `.build/aro-cache`
+    ///   - optimize: Optimization level passed to the default compiler
+    ///   - compiler: Path and version of the compiler; part of the key.
+    ///     Defaults to `LLVMEmitter.compilerIdentity()` when `compile` is
+    ///     nil, and to nothing for a custom `compile`.
+    ///   - flags: Other settings that change the objects; part of the key
+    ///   - retention: How long an object no build uses is kept; 0 evicts
+    ///     everything the current build doesn't reference
+    ///   - compile: Compiler to run on misses (defaults to `LLVMEmitter`)
+    public init(
+        directory: String,
+        optimize: LLVMEmitter.OptimizationLevel = .none,
+        compiler: String? = nil,
+        flags: [String] = [],
+        retention: TimeInterval = LLVMObjectCache.defaultRetention,
+        compile: Compile? = nil
+    ) {
+        self.directory = directory
+        self.optimize = optimize
+        if let compiler {
+            self.compiler = compiler
+        } else if compile == nil {
+            // A missing compiler fails on the first miss instead
+            self.compiler = (try? LLVMEmitter().compilerIdentity()) ?? "unknown"
+        } else {
+            self.compiler = ""
+        }
+        self.flags = flags
+        self.retention = retention
+        self.compile = compile ?? { irPath, outputPath in
+            try LLVMEmitter().emitObject(irPath: irPath, to: outputPath, optimize: optimize)
+        }
+    }
+
+    // MARK: - Lookup
+
+    /// Cache key of a module: 128 bits of FNV-1a over the settings and IR
+    public func key(for irText: String) -> String {
+        var settings = [Self.formatVersion, optimize.rawValue, Self.platform, compiler]
+        settings.append(contentsOf: flags)
+        let header = Array(settings.joined(separator: "\u{0}").utf8) + [0]
+
+        var low = FNV1a.offsetBasis
+        var high = FNV1a.alternateBasis
+        low = FNV1a.hash(header, seed: low)
+        high = FNV1a.hash(header, seed: high)
+        var ir = irText
+        ir.withUTF8 { bytes in
+            low = FNV1a.hash(bytes, seed: low)
+            high = FNV1a.hash(bytes, seed: high)
+        }
+        return Self.hex(high) + Self.hex(low)
+    }
+
+    /// Return an object for every module, compiling only those that
+    /// aren't cached
+    /// - Parameters:
+    ///   - units: Modules to compile
+    ///   - keepIntermediate: Keep the `.ll` written for each compiled module
+    public func objects(for units: [LLVMCodeGenerationUnit], keepIntermediate: Bool = false) throws -> Result {
+        let fileManager = FileManager.default
+        try fileManager.createDirectory(atPath: directory, withIntermediateDirectories: true)
+
+        let objectPaths = units.map { path(for: key(for: $0.irText), extension: "o") }
+
+        // Identical modules share a key; compile each key once. Hits are
+        // marked as used before anything else, so a build running
+        // alongside doesn't evict them
+        let now = Date()
+        var misses: [Int] = []
+        var pending = Set<String>()
+        for (index, objectPath) in objectPaths.enumerated() where pending.insert(objectPath).inserted {
+            if (try? fileManager.setAttributes([.modificationDate: now], ofItemAtPath: objectPath)) == nil {
+                misses.append(index)
+            }
+        }
+
+        let failures = FailureList()
+        let compile = self.compile
+        DispatchQueue.concurrentPerform(iterations: misses.count) { i in
+            let unit = units[misses[i]]
+            let objectPath = objectPaths[misses[i]]
+            let base = String(objectPath.dropLast(2))
+            let irPath = base + ".ll"
+            // Compile beside the final name, then rename, so an
+            // interrupted build never leaves a truncated object behind
+            let partialPath = base + ".\(UUID().uuidString).o"
+            do {
+                try unit.irText.write(toFile: irPath, atomically: false, encoding: .utf8)
+                try compile(irPath, partialPath)
+                if (try? FileManager.default.moveItem(atPath: partialPath, toPath: objectPath)) == nil {
+                    // Another build stored the same object first
+                    try? FileManager.default.removeItem(atPath: partialPath)
+                    guard FileManager.default.fileExists(atPath: objectPath) else {
+                        throw LinkerError.compilationFailed("Could not store \(objectPath)")
+                    }
+                }
+                if !keepIntermediate {
+                    try? FileManager.default.removeItem(atPath: irPath)
+                }
+            } catch {
+                try? FileManager.default.removeItem(atPath: partialPath)
+                failures.append(i, CompileError(module: unit.name, irPath: irPath, underlying: error))
+            }
+        }
+
+        if let failure = failures.first {
+            throw failure
+        }
+        let evicted = removeObjects(except: Set(objectPaths))
+        return Result(objectPaths: objectPaths, compiledCount: misses.count, evictedCount: evicted)
+    }
+
+    // MARK: - Private Methods
+
+    /// Remove cached objects not in `referenced` that no build has used
+    /// for `retention`. Only `<key>.o` files are touched: IR kept for
+    /// debugging and the partial objects of a build running alongside stay.
+    private func removeObjects(except referenced: Set<String>) -> Int {
+        let fileManager = FileManager.default
+        guard let files = try? fileManager.contentsOfDirectory(atPath: directory) else { return 0 }
+        let cutoff = Date().addingTimeInterval(-retention)
+        var removed = 0
+        for file in files where Self.isObjectName(file) {
+            let objectPath = (directory as NSString).appendingPathComponent(file)
+            guard !referenced.contains(objectPath),
+                  let used = (try? fileManager.attributesOfItem(atPath: objectPath))?[.modificationDate] as? Date,
+                  used <= cutoff else { continue }
+            if (try? fileManager.removeItem(atPath: objectPath)) != nil {
+                removed += 1
+            }
+        }
+        return removed
+    }
+
+    /// Whether `file` is named like a cached object: 32 hex digits and `.o`
+    private static func isObjectName(_ file: String) -> Bool {
+        let utf8 = file.utf8
+        return utf8.count == 34 && file.hasSuffix(".o")
+            && utf8.prefix(32).allSatisfy { (UInt8(ascii: "0")...UInt8(ascii: "9")).contains($0) || (UInt8(ascii: "a")...UInt8(ascii: "f")).contains($0) }
+    }
+
+    private func path(for key: String, extension ext: String) -> String {
+        (directory as NSString).appendingPathComponent("\(key).\(ext)")
+    }
+
+    private static var platform: String {
+        #if os(macOS)
+        let system = "macos"
+        #elseif os(Linux)
+        let system = "linux"
+        #elseif os(Windows)
+        let system = "windows"
+        #else
+        let system = "unknown"
+        #endif
+        #if arch(arm64)
+        return system + "-arm64"
+        #elseif arch(x86_64)
+        return system + "-x86_64"
+        #else
+        return system
+        #endif
+    }
+
+    private static func hex(_ value: UInt64) -> String {
+        let digits = String(value, radix: 16)
+        return String(repeating: "0", count: 16 - digits.count) + digits
+    }
+}
+
+/// Compile errors collected from parallel workers, reported in module order
+private final class FailureList: @unchecked Sendable {
+    private let lock = NSLock()
+    private var failures: [(index: Int, error: LLVMObjectCache.CompileError)] = []
+
+    func append(_ index: Int, _ error: LLVMObjectCache.CompileError) {
+        lock.lock()
+        defer { lock.unlock() }
+        failures.append((index, error))
+    }
+
+    var first: LLVMObjectCache.CompileError? {
+        lock.lock()
+        defer { lock.unlock() }
+        return failures.min { $0.index < $1.index }?.error
+    }
+}
+
+/// 64-bit FNV-1a, run twice with different offset bases for a 128-bit key
+enum FNV1a {
+    static let offsetBasis: UInt64 = 0xcbf29ce484222325
+    static let alternateBasis: UInt64 = 0x6c62272e07bb0142
+    static let prime: UInt64 = 0x100000001b3
+
+    @inline(__always)
+    static func hash<Bytes: Sequence>(_ bytes: Bytes, seed: UInt64) -> UInt64 where Bytes.Element == UInt8 {
+        var hash = seed
+        for byte in bytes {
+            hash = (hash ^ UInt64(byte)) &* prime
+        }
+        return hash
+    }
+}
@@ -108,6 +108,9 @@ public struct AnalyzedFeatureSet: Sendable {
     public let aggregationFusions: [AggregationFusionGroup]  // Groups of fusible reduces
     public let streamConsumers: [StreamConsumerInfo]          // Multi-consumer streams
 
+    /// Statement dependencies derived from `dataFlows`, for parallel execution
+    public let dependencyGraph: StatementDependencyGraph
+
     public init(
         featureSet: FeatureSet,
         symbolTable: SymbolTable,
@@ -124,6 +127,10 @@ public struct AnalyzedFeatureSet: Sendable {
         self.exports = exports
         self.aggregationFusions = aggregationFusions
         self.streamConsumers = streamConsumers
+        self.dependencyGraph = StatementDependencyGraph(
+            statements: featureSet.statements,
+            dataFlows: dataFlows
+        )
     }
 }
 
@@ -0,0 +1,155 @@
+// ============================================================
+// StatementDependencyGraph.swift
+// ARO Parser - Statement dependency DAG for parallel execution
+// ============================================================
+//
+// Built once per feature set from the data-flow results. An edge
+// j → i means statement i must observe statement j's completion:
+// i reads what j writes, writes what j reads or writes, or one of
+// the two is a barrier. Only independent I/O calls (Request, Fetch,
+// Call, Invoke, Read) are reorderable; every other statement —
+// Log, Emit, Return, Store, control flow, computations — is a
+// barrier, so the observable order of side effects is unchanged.
+// A Request is reorderable only when it is known to be a GET: a
+// POST/PUT/DELETE, or a method the analyzer cannot see (a config map
+// held in a variable), keeps its place.
+//
+// The runtime consumes `parallelBatches`: maximal runs of adjacent
+// reorderable statements with no edges between them. A run executes
+// concurrently and costs the slowest call instead of the sum. Call and
+// Invoke are batched by name only; whether a service method is free of
+// side effects is known at runtime, so the executor still runs a call to
+// a method its service does not declare read-only on its own, in order.
+
+import Foundation
+
+/// Dependency DAG over the top-level statements of a feature set
+public struct StatementDependencyGraph: Sendable, Equatable {
+    /// I/O-bound verbs whose statements may run concurrently with each other
+    public static let concurrentVerbs: Set<String> = ["request", "fetch", "call", "invoke", "read"]
+
+    /// For each statement, the indices of the earlier statements it depends on
+    public let predecessors: [[Int]]
+
+    /// Index ranges of statements that can execute concurrently (each has 2+ statements)
+    public let parallelBatches: [Range<Int>]
+
+    public init(statements: [Statement], dataFlows: [DataFlowInfo]) {
+        let accesses = zip(statements, dataFlows).map { statement, flow in
+            Access(statement: statement, flow: flow)
+        }
+
+        var predecessors: [[Int]] = []
+        predecessors.reserveCapacity(accesses.count)
+        for (i, access) in accesses.enumerated() {
+            var edges: [Int] = []
+            for j in 0..<i where !accesses[j].isReorderable(with: access) {
+                edges.append(j)
+            }
+            predecessors.append(edges)
+        }
+        self.predecessors = predecessors
+
+        // Grow each run while the next statement is independent of every
+        // statement already in it
+        var batches: [Range<Int>] = []
+        var start = 0
+        while start < accesses.count {
+            var end = start + 1
+            if accesses[start].isConcurrent {
+                while end < accesses.count,
+                      accesses[end].isConcurrent,
+                      !predecessors[end].contains(where: { $0 >= start }) {
+                    end += 1
+                }
+            }
+            if end - start > 1 {
+                batches.append(start..<end)
+            }
+            start = end
+        }
+        self.parallelBatches = batches
+    }
+
+    /// An empty graph (no statements)
+    public static let empty = StatementDependencyGraph(statements: [], dataFlows: [])
+
+    // MARK: - Access Sets
+
+    private struct Access {
+        let reads: Set<String>
+        let writes: Set<String>
+        let isConcurrent: Bool
+
+        init(statement: Statement, flow: DataFlowInfo) {
+            var reads = flow.inputs
+            var concurrent = false
+            if let aro = statement as? AROStatement {
+                // Specifiers and qualifiers may name variables that the
+                // data-flow pass does not record as inputs
+                reads.formUnion(aro.object.noun.specifiers)
+                reads.formUnion(aro.result.specifiers)
+                if let annotation = aro.object.noun.typeAnnotation {
+                    reads.insert(annotation)
+                }
+                let verb = aro.action.verb.lowercased()
+                concurrent = StatementDependencyGraph.concurrentVerbs.contains(verb)
+                    && flow.sideEffects.isEmpty
+                    && !flow.outputs.isEmpty
+                    && (verb != "request" || Self.isGetRequest(aro))
+            }
+            self.reads = reads
+            self.writes = flow.outputs
+            self.isConcurrent = concurrent
+        }
+
+        /// True when a Request statement is known to issue a GET (or HEAD).
+        /// Mirrors RequestAction: a `method` in the config map wins, else
+        /// the preposition decides (`to` posts, `via` names the method).
+        private static func isGetRequest(_ statement: AROStatement) -> Bool {
+            // Config sources in the order RequestAction looks them up
+            var configs: [any Expression] = []
+            if case .expression(let expression) = statement.valueSource {
+                configs.append(expression)
+            }
+            if let withClause = statement.rangeModifiers.withClause {
+                configs.append(withClause)
+            }
+            for config in configs {
+                // Any other expression may evaluate to a map with a method
+                guard let map = config as? MapLiteralExpression else { return false }
+                if let method = map.entries.first(where: { $0.key == "method" }) {
+                    guard let literal = method.value as? LiteralExpression,
+                          case .string(let name) = literal.value else { return false }
+                    return isReadOnlyMethod(name)
+                }
+            }
+            if case .literal(.object(let entries)) = statement.valueSource,
+               let method = entries.first(where: { $0.0 == "method" })?.1 {
+                guard case .string(let name) = method else { return false }
+                return isReadOnlyMethod(name)
+            }
+
+            switch statement.object.preposition {
+            case .to:
+                return false
+            case .via:
+                return isReadOnlyMethod(statement.object.noun.specifiers.first ?? "GET")
+            default:
+                return true
+            }
+        }
+
+        private static func isReadOnlyMethod(_ method: String) -> Bool {
+            ["GET", "HEAD"].contains(method.uppercased())
+        }
+
+        /// True when `self` (earlier) and `later` may run in either order
+        func isReorderable(with later: Access) -> Bool {
+            isConcurrent && later.isConcurrent
+                && writes.isDisjoint(with: later.reads)
+                && writes.isDisjoint(with: later.writes)
+                && reads.isDisjoint(with: later.writes)
+        }
+    }
+}
@@ -53,26 +53,14 @@ public struct CallAction: ActionImplementation {
 
         // Parse service and method from object
         // Format: <service: method> or <service-name: method-name>
-        let serviceName: String
-        let methodName: String
-
-        if !object.specifiers.isEmpty {
-            // Service name is the base, method is the first specifier
-            serviceName = object.base
-            methodName = object.specifiers[0]
-        } else {
-            // Try to split base on common separators
-            let parts = object.base.split(separator: "-", maxSplits: 1).map(String.init)
-            if parts.count == 2 {
-                serviceName = parts[0]
-                methodName = parts[1]
-            } else {
-                throw ActionError.invalidInput(
-                    "Call action requires service and method: <service: method>",
-                    received: object.base
-                )
-            }
+        guard let target = Self.serviceAndMethod(base: object.base, specifiers: object.specifiers) else {
+            throw ActionError.invalidInput(
+                "Call action requires service and method: <service: method>",
+                received: object.base
+            )
         }
+        let serviceName = target.service
+        let methodName = target.method
 
         // Build arguments from result specifiers and literal value
         var args: [String: any Sendable] = [:]
@@ -124,6 +112,19 @@ public struct CallAction: ActionImplementation {
         // This prevents "Cannot rebind immutable variable" errors
         return callResult
     }
+
+    /// The service and method a call object names: the base and its first
+    /// specifier, or the base split at its first "-"
+    static func serviceAndMethod(base: String, specifiers: [String]) -> (service: String, method: String)? {
+        if let method = specifiers.first {
+            // Service name is the base, method is the first specifier
+            return (base, method)
+        }
+        // Try to split base on common separators
+        let parts = base.split(separator: "-", maxSplits: 1).map(String.init)
+        guard parts.count == 2 else { return nil }
+        return (parts[0], parts[1])
+    }
 }
 
 // MARK: - Action Error Extension
@@ -358,7 +358,7 @@ public struct ComputeAction: SynchronousAction {
     /// - Lists: Elements in both, preserving duplicates up to minimum count
     /// - Strings: Characters in both, preserving order from first string
     /// - Objects: Keys with matching values (deep recursive)
-    private func computeIntersect(_ a: any Sendable, with b: any Sendable) throws -> any Sendable {
+    func computeIntersect(_ a: any Sendable, with b: any Sendable) throws -> any Sendable {
         // Arrays - multiset intersection
         if let arrA = a as? [any Sendable], let arrB = b as? [any Sendable] {
             return multisetIntersect(arrA, arrB)
@@ -393,7 +393,7 @@ public struct ComputeAction: SynchronousAction {
     /// - Lists: Elements in A but not in B, with multiset subtraction
     /// - Strings: Characters in A but not in B, preserving order
     /// - Objects: Keys/values in A that are not matching in B
-    private func computeDifference(_ a: any Sendable, minus b: any Sendable) throws -> any Sendable {
+    func computeDifference(_ a: any Sendable, minus b: any Sendable) throws -> any Sendable {
         // Arrays - multiset difference
         if let arrA = a as? [any Sendable], let arrB = b as? [any Sendable] {
             return multisetDifference(arrA, arrB)
@@ -429,17 +429,16 @@ public struct ComputeAction: SynchronousAction {
     /// - Lists: All unique elements from both (A wins for duplicates)
     /// - Strings: All unique characters from both, preserving order from A
     /// - Objects: Merge keys (A wins for conflicts)
-    private func computeUnion(_ a: any Sendable, with b: any Sendable) throws -> any Sendable {
+    func computeUnion(_ a: any Sendable, with b: any Sendable) throws -> any Sendable {
         // Arrays - deduplicated union
         if let arrA = a as? [any Sendable], let arrB = b as? [any Sendable] {
             var result = arrA
-            var seen = Set(arrA.map { hashKey(for: $0) })
-            for item in arrB {
-                let key = hashKey(for: item)
-                if !seen.contains(key) {
-                    seen.insert(key)
-                    result.append(item)
-                }
+            var seen = Set<SetOperationKey>(minimumCapacity: arrA.count + arrB.count)
+            for item in arrA {
+                seen.insert(SetOperationKey(item))
+            }
+            for item in arrB where seen.insert(SetOperationKey(item)).inserted {
+                result.append(item)
             }
             return result
         }
@@ -481,15 +480,11 @@ public struct ComputeAction: SynchronousAction {
 
     /// Multiset intersection: elements in both, preserving duplicates up to min count
     private func multisetIntersect(_ a: [any Sendable], _ b: [any Sendable]) -> [any Sendable] {
-        var bCounts: [String: Int] = [:]
-        for item in b {
-            let key = hashKey(for: item)
-            bCounts[key, default: 0] += 1
-        }
+        var bCounts = multisetCounts(b)
 
         var result: [any Sendable] = []
         for item in a {
-            let key = hashKey(for: item)
+            let key = SetOperationKey(item)
             if let count = bCounts[key], count > 0 {
                 result.append(item)
                 bCounts[key] = count - 1
@@ -500,15 +495,11 @@ public struct ComputeAction: SynchronousAction {
 
     /// Multiset difference: elements in A minus occurrences in B
     private func multisetDifference(_ a: [any Sendable], _ b: [any Sendable]) -> [any Sendable] {
-        var bCounts: [String: Int] = [:]
-        for item in b {
-            let key = hashKey(for: item)
-            bCounts[key, default: 0] += 1
-        }
+        var bCounts = multisetCounts(b)
 
         var result: [any Sendable] = []
         for item in a {
-            let key = hashKey(for: item)
+            let key = SetOperationKey(item)
             if let count = bCounts[key], count > 0 {
                 bCounts[key] = count - 1
             } else {
@@ -597,20 +588,14 @@ public struct ComputeAction: SynchronousAction {
         return counts
     }
 
-    /// Create a hash key for any Sendable value (for multiset counting)
-    private func hashKey(for value: any Sendable) -> String {
-        if let dict = value as? [String: any Sendable] {
-            // Sort keys for consistent hashing
-            let sorted = dict.keys.sorted().map { key -> String in
-                let v = dict[key]!
-                return "\(key):\(hashKey(for: v))"
-            }
-            return "{\(sorted.joined(separator: ","))}"
+    /// Occurrence count of each element, keyed by its rendered value
+    private func multisetCounts(_ items: [any Sendable]) -> [SetOperationKey: Int] {
+        var counts: [SetOperationKey: Int] = [:]
+        counts.reserveCapacity(items.count)
+        for item in items {
+            counts[SetOperationKey(item), default: 0] += 1
         }
-        if let arr = value as? [any Sendable] {
-            return "[\(arr.map { hashKey(for: $0) }.joined(separator: ","))]"
-        }
-        return String(describing: value)
+        return counts
     }
 
     /// Strict equality check for two values
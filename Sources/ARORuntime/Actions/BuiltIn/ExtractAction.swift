@@ -82,7 +82,10 @@ public struct ExtractAction: SynchronousAction {
                 )
             }
 
-            if let schema = registry.schema(named: schemaName) {
+            if let compiled = registry.compiledSchema(named: schemaName) {
+                // Validate and coerce with the validator compiled at registry build time
+                return try compiled.validate(resolvedSource, schemaName: schemaName)
+            } else if let schema = registry.schema(named: schemaName) {
                 // Validate and coerce the resolved source against the schema
                 let validated = try SchemaBinding.validateAgainstSchema(
                     value: resolvedSource,
@@ -979,4 +982,8 @@ public protocol FileSystemService: Sendable {
     func copy(source: String, destination: String) async throws
     func move(source: String, destination: String) async throws
     func append(path: String, content: String) async throws
+
+    // Streaming writes: records are formatted and flushed incrementally
+    func write(path: String, records: AROStream<any Sendable>, format: FileFormat,
+               variableName: String, options: [String: any Sendable], append: Bool) async throws
 }
@@ -629,6 +629,9 @@ public struct MoveResult: Sendable, Equatable {
 /// <Append> the <log-line> to the <file: "./logs/app.log">.
 /// <Append> the <entry> to the <file: "./data.txt"> with "\nNew line".
 /// ```
+///
+/// A stream source (e.g. filtered rows) is appended one record per line
+/// in the file's format; CSV appends to a non-empty file omit the header.
 public struct AppendAction: ActionImplementation {
     public static let role: ActionRole = .response
     public static let verbs: Set<String> = ["append"]
@@ -643,6 +646,36 @@ public struct AppendAction: ActionImplementation {
     ) async throws -> any Sendable {
         try validatePreposition(object.preposition)
 
+        // Get file path from specifiers or base
+        let path = try context.resolveString(
+            base: object.base,
+            specifiers: object.specifiers,
+            excluding: ["file"],
+            field: "a file path",
+            action: "Append"
+        )
+
+        // Get file service
+        guard let fileService = context.service(FileSystemService.self) else {
+            throw ActionError.missingService("FileSystemService")
+        }
+
+        // A stream source is appended record by record in the format of
+        // the file (CSV rows, JSON lines, SQL inserts, log lines)
+        if context.resolveAny("_literal_") == nil, context.resolveAny("_expression_") == nil,
+           let records = AnyStreamingValue.lazyStream(from: context.resolveAny(result.base)) {
+            let format = FileFormat.detect(from: path)
+            if FormatSerializer.canStream(format, continuing: true) {
+                try await fileService.write(path: path, records: records, format: format,
+                                            variableName: result.base, options: [:], append: true)
+            } else {
+                let values = try await records.collect()
+                let content = FormatSerializer.serialize(values, format: format, variableName: result.base)
+                try await fileService.append(path: path, content: content)
+            }
+            return AppendResult(path: path, success: true)
+        }
+
         // Get content to append
         // Priority: with clause literal, result variable, result base
         let content: String
@@ -666,20 +699,6 @@ public struct AppendAction: ActionImplementation {
             content = ""
         }
 
-        // Get file path from specifiers or base
-        let path = try context.resolveString(
-            base: object.base,
-            specifiers: object.specifiers,
-            excluding: ["file"],
-            field: "a file path",
-            action: "Append"
-        )
-
-        // Get file service
-        guard let fileService = context.service(FileSystemService.self) else {
-            throw ActionError.missingService("FileSystemService")
-        }
-
         // Append to file
         try await fileService.append(path: path, content: content)
 
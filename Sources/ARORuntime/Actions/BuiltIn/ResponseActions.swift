@@ -714,6 +714,9 @@ public struct StoreAction: ActionImplementation {
 /// - .txt: key=value format
 /// - .sql: INSERT statements
 /// - .obj/unknown: Binary (pass-through)
+///
+/// A stream (lazy) source is written record by record for CSV, TSV,
+/// JSON, JSONL, SQL and log files instead of being materialized.
 public struct WriteAction: ActionImplementation {
     public static let role: ActionRole = .response
     public static let verbs: Set<String> = ["write"]
@@ -781,6 +784,26 @@ public struct WriteAction: ActionImplementation {
             if let encoding = configDict["encoding"] as? String {
                 formatOptions["encoding"] = encoding
             }
+            if let batch = configDict["batch"] as? Int {
+                formatOptions["batch"] = batch
+            }
+        }
+
+        // Streams are formatted record by record straight into the file;
+        // formats without a streaming writer are materialized first
+        if !isRaw, let records = AnyStreamingValue.lazyStream(from: context.resolveAny(result.base)) {
+            guard let fileService = context.service(FileSystemService.self) else {
+                throw ActionError.missingService("FileSystemService")
+            }
+            if FormatSerializer.canStream(format) {
+                try await fileService.write(path: path, records: records, format: format,
+                                            variableName: result.base, options: formatOptions, append: false)
+            } else {
+                let values = try await records.collect()
+                let content = FormatSerializer.serialize(values, format: format, variableName: result.base, options: formatOptions)
+                try await fileService.write(path: path, content: content)
+            }
+            return WriteResult(path: path, success: true)
         }
 
         // Get data to write - prefer resolveAny to get structured data,
@@ -1182,23 +1205,62 @@ public struct NotificationSentEvent: RuntimeEvent {
 
 /// A custom domain event emitted by ARO code
 /// The eventType is dynamically set based on the event name in the ARO statement
+///
+/// The event is a single reference to immutable storage, so it fits in an
+/// existential's inline buffer: publishing it and handing it to every
+/// subscriber only retains that storage instead of boxing a copy per hop.
 public struct DomainEvent: RuntimeEvent {
-    /// The event type (e.g., "UserCreated", "OrderPlaced")
-    public let domainEventType: String
+    private final class Storage: Sendable {
+        let domainEventType: String
+        let timestamp: Date
+        let payload: EventPayload
+        let handlerFrames = EventFrameCache()
+
+        init(domainEventType: String, timestamp: Date, payload: EventPayload) {
+            self.domainEventType = domainEventType
+            self.timestamp = timestamp
+            self.payload = payload
+        }
+    }
+
+    private let storage: Storage
 
     /// Static event type for routing - uses "domain.*" prefix
     public static var eventType: String { "domain" }
 
+    /// The event type (e.g., "UserCreated", "OrderPlaced")
+    public var domainEventType: String { storage.domainEventType }
+
     /// Timestamp when the event occurred
-    public let timestamp: Date
+    public var timestamp: Date { storage.timestamp }
 
     /// The payload data attached to the event
-    public let payload: [String: any Sendable]
+    public var payload: [String: any Sendable] { storage.payload.values }
+
+    /// The payload as shared storage, for binding into handler contexts
+    public var sharedPayload: EventPayload { storage.payload }
+
+    /// Frames shared by every handler context of this event
+    var handlerFrames: EventFrameCache { storage.handlerFrames }
 
     public init(eventType: String, payload: [String: any Sendable]) {
-        self.domainEventType = eventType
-        self.timestamp = Date()
-        self.payload = payload
+        self.init(eventType: eventType, sharedPayload: payload.isEmpty ? .empty : EventPayload(payload))
+    }
+
+    public init(eventType: String, sharedPayload: EventPayload) {
+        self.storage = Storage(domainEventType: eventType, timestamp: Date(), payload: sharedPayload)
+    }
+}
+
+extension DomainEvent: CustomReflectable {
+    /// Reflects the logical fields rather than the storage reference, so
+    /// reflection-based recording keeps seeing type, timestamp and payload.
+    public var customMirror: Mirror {
+        Mirror(self, children: [
+            "domainEventType": domainEventType,
+            "timestamp": timestamp,
+            "payload": payload,
+        ])
     }
 }
 
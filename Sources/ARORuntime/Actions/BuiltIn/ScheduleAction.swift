@@ -8,8 +8,8 @@ import AROParser
 
 /// Schedules a periodic domain event emission at a fixed interval.
 ///
-/// The Schedule action starts a background timer that emits a named
-/// `DomainEvent` on every tick. Any feature set declared as
+/// The Schedule action adds a periodic timer to `TimerWheel.shared`
+/// that emits a named `DomainEvent` on every tick. Any feature set declared as
 /// `(Name: tick-name Handler)` will be triggered on each tick.
 ///
 /// The application keeps running (Keepalive stays in service mode) as
@@ -100,25 +100,59 @@ public struct ScheduleAction: ActionImplementation {
         // (waits for SIGINT/SIGTERM rather than the 2-second idle exit)
         await EventBus.shared.registerEventSource()
 
-        // Start the timer in a detached task (not tied to the current feature set)
-        let timerTask = Task.detached {
-            while !Task.isCancelled {
-                try? await Task.sleep(nanoseconds: UInt64(intervalSeconds * 1_000_000_000))
-                guard !Task.isCancelled else { break }
-                // DomainEvent payload: {} (empty — the event name itself is the trigger signal)
-                EventBus.shared.publish(DomainEvent(eventType: eventName, payload: [:]))
-            }
+        // Fire from the runtime's timer wheel (not tied to the current feature
+        // set). A late tick emits one event and the schedule keeps its phase.
+        let intervalNanoseconds = UInt64(max(0, intervalSeconds) * 1_000_000_000)
+        let timer = TimerWheel.shared.schedule(
+            after: intervalNanoseconds,
+            every: intervalNanoseconds,
+            catchUp: .fireOnce
+        ) {
+            // DomainEvent payload: {} (empty — the event name itself is the trigger signal)
+            EventBus.shared.publish(DomainEvent(eventType: eventName, payload: [:]))
         }
 
-        // Watch for shutdown and cancel the timer when it arrives
-        Task.detached {
-            await ShutdownCoordinator.shared.waitForShutdown()
-            timerTask.cancel()
-            await EventBus.shared.unregisterEventSource()
-        }
+        // Cancel the timer when shutdown arrives
+        ScheduledTimers.shared.add(timer)
 
         let intervalInt = Int(intervalSeconds)
         context.bind(result.base, value: intervalInt)
         return intervalInt
     }
 }
+
+// MARK: - Scheduled Timers
+
+/// Timers started by `Schedule`. One watcher task per shutdown cancels
+/// all of them, rather than one waiting task per timer.
+private final class ScheduledTimers: @unchecked Sendable {
+    static let shared = ScheduledTimers()
+
+    private let lock = NSLock()
+    private var handles: [TimerHandle] = []
+    private var isWatching = false
+
+    func add(_ handle: TimerHandle) {
+        let startWatcher: Bool = lock.withLock {
+            handles.append(handle)
+            defer { isWatching = true }
+            return !isWatching
+        }
+        guard startWatcher else { return }
+
+        Task.detached {
+            await ShutdownCoordinator.shared.waitForShutdown()
+            let cancelled: [TimerHandle] = self.lock.withLock {
+                defer {
+                    self.handles = []
+                    self.isWatching = false
+                }
+                return self.handles
+            }
+            for handle in cancelled {
+                TimerWheel.shared.cancel(handle)
+                await EventBus.shared.unregisterEventSource()
+            }
+        }
+    }
+}
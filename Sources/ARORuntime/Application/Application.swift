@@ -273,8 +273,8 @@ public final class Application: @unchecked Sendable {
         }
 
         // Start event recording if requested
-        if recordPath != nil {
-            await eventRecorder.startRecording()
+        if let recordPath {
+            try await startRecording(to: recordPath)
         }
 
         // Run the application
@@ -325,8 +325,8 @@ public final class Application: @unchecked Sendable {
         }
 
         // Start event recording if requested
-        if recordPath != nil {
-            await eventRecorder.startRecording()
+        if let recordPath {
+            try await startRecording(to: recordPath)
         }
 
         // Run the application with keepalive
@@ -463,12 +463,11 @@ public final class Application: @unchecked Sendable {
                 // Validate response body against OpenAPI response schema (ARO-0180)
                 if let body = httpResponse.body,
                    let bodyJSON = try? JSONSerialization.jsonObject(with: body) {
-                    let components = self.routeRegistry?.spec.components
                     if let violationMessage = SchemaBinding.validateResponseBody(
                         bodyJSON,
                         forStatusCode: httpResponse.statusCode,
                         operation: match.operation,
-                        components: components
+                        compiled: match.responseSchemas
                     ) {
                         let operationId = match.operationId
                         print("[CONTRACT VIOLATION] Response for operation '\(operationId)' (status \(httpResponse.statusCode)) does not match schema: \(violationMessage)")
@@ -649,7 +648,7 @@ public final class Application: @unchecked Sendable {
         let executor = FeatureSetExecutor(
             actionRegistry: .shared,
             eventBus: .shared,
-            globalSymbols: await runtime.globalSymbols
+            globalSymbols: runtime.globalSymbols
         )
 
         return try await executor.execute(analyzedFeatureSet, context: context)
@@ -955,9 +954,29 @@ public final class Application: @unchecked Sendable {
 
     // MARK: - Event Recording and Replay
 
-    /// Replay events from a JSON file
+    /// Replay events from a binary event log or a JSON file
     private func replayEvents(from path: String) async throws {
         let replayer = EventReplayer(eventBus: .shared)
+
+        // Binary logs replay straight from the mapped file instead of
+        // being decoded into an EventRecording first
+        let data = try Data(contentsOf: URL(fileURLWithPath: path), options: .alwaysMapped)
+        if EventLogFormat.hasMagic(data) {
+            let log = try EventLogReader(path: path)
+            if config.verbose {
+                print("Replaying events from \(path)")
+                print("Recording: \(log.applicationName)")
+                print("Recorded at: \(log.startedAt)")
+                print()
+            }
+            let count = await replayer.replayFast(log)
+            if config.verbose {
+                print("Event replay completed (\(count) events)")
+                print()
+            }
+            return
+        }
+
         let recording = try await replayer.loadFromFile(path)
 
         if config.verbose {
@@ -976,12 +995,24 @@ public final class Application: @unchecked Sendable {
         }
     }
 
-    /// Save recorded events to a JSON file
+    /// Start recording events. `.aroevents` paths stream a binary
+    /// event log to disk as events happen; anything else keeps the
+    /// in-memory recording that is saved as JSON on shutdown.
+    private func startRecording(to path: String) async throws {
+        if EventLogFormat.isBinaryLogPath(path) {
+            try await eventRecorder.startRecording(streamingTo: path, applicationName: "ARO Application")
+        } else {
+            await eventRecorder.startRecording()
+        }
+    }
+
+    /// Save recorded events to a JSON file (or finish a streamed binary log)
     private func saveRecording(to path: String) async throws {
-        let events = await eventRecorder.stopRecording()
+        let recordedCount = await eventRecorder.eventCount
+        _ = await eventRecorder.stopRecording()
 
         if config.verbose {
-            print("\nRecorded \(events.count) events")
+            print("\nRecorded \(recordedCount) events")
             print("Saving to: \(path)")
         }
 
@@ -21,6 +21,11 @@
 // Thread-safety: safe for any number of concurrent force() callers,
 // including from C pthreads. Uses DispatchGroup for fan-out — group.wait()
 // blocks all waiters until the Task signals completion exactly once.
+//
+// With `ARO_ACTION_EXECUTOR=work-stealing` the Task runs on the bounded
+// `WorkStealingExecutor` instead. Force points then avoid blocking: a
+// body that hasn't started is claimed and run inline on the forcing
+// thread, and a forcing worker runs other queued jobs while it waits.
 
 import Foundation
 
@@ -83,27 +88,61 @@ public final class AROFuture: @unchecked Sendable {
     /// so the Task body doesn't need to capture self.
     private let storage: ResultStorage
 
-    /// Create a future that runs `work` on the action task executor
-    /// (GCD-backed, elastic), separate from Swift's cooperative pool.
-    public init(
+    /// The body, kept so force() can run it inline when it hasn't started.
+    /// Only set for futures on the work-stealing executor.
+    private let inlineWork: (@Sendable () async throws -> any Sendable)?
+
+    /// Create a future that runs `work` on the action executor selected by
+    /// `ActionExecutorKind.selected`: the elastic GCD-backed executor by
+    /// default, separate from Swift's cooperative pool.
+    public convenience init(
+        bindingName: String,
+        sourceLocation: String? = nil,
+        priority: TaskPriority? = nil,
+        _ work: @Sendable @escaping () async throws -> any Sendable
+    ) {
+        self.init(
+            bindingName: bindingName,
+            sourceLocation: sourceLocation,
+            priority: priority,
+            pool: ActionExecutorKind.selected == .workStealing ? WorkStealingExecutor.shared : nil,
+            work
+        )
+    }
+
+    /// Create a future on `pool`, or on `ActionTaskExecutor` when nil.
+    init(
         bindingName: String,
         sourceLocation: String? = nil,
         priority: TaskPriority? = nil,
+        pool: WorkStealingExecutor?,
         _ work: @Sendable @escaping () async throws -> any Sendable
     ) {
         self.bindingName = bindingName
         self.sourceLocation = sourceLocation
         let storage = ResultStorage()
         self.storage = storage
-        self.task = Task(executorPreference: ActionTaskExecutor.shared, priority: priority) {
-            do {
-                let value = try await work()
-                storage.complete(.success(value))
-                return value
-            } catch {
-                storage.complete(.failure(error))
-                throw error
+
+        guard let pool else {
+            self.inlineWork = nil
+            self.task = Task(executorPreference: ActionTaskExecutor.shared, priority: priority) {
+                try await storage.run(work)
             }
+            return
+        }
+
+        self.inlineWork = work
+        self.task = Task(executorPreference: pool, priority: priority) {
+            // A forcing thread got here first and is running the body
+            guard storage.claim() else {
+                return try await storage.result()
+            }
+            // Dropped before it started: don't do the work at all
+            if Task.isCancelled {
+                storage.complete(.failure(CancellationError()))
+                throw CancellationError()
+            }
+            return try await storage.run(work)
         }
     }
 
@@ -116,6 +155,7 @@ public final class AROFuture: @unchecked Sendable {
         storage.complete(.success(value))
         self.storage = storage
         self.task = nil
+        self.inlineWork = nil
     }
 
     deinit {
@@ -134,6 +174,9 @@ public final class AROFuture: @unchecked Sendable {
     /// almost-deadlocks before they become hangs — invaluable on Linux
     /// where blocked-pthread stacks are unhelpful.
     public func force() throws -> any Sendable {
+        if let work = inlineWork, storage.claim() {
+            InlineTaskExecutor.run(work, into: storage)
+        }
         let budget = ForceDiagnostics.effectiveBudget
         guard budget > 0, !storage.isResolved else {
             return try storage.wait()
@@ -175,28 +218,82 @@ private final class ResultStorage: @unchecked Sendable {
     private let group = DispatchGroup()
     private var _result: Result<any Sendable, Error>?
     private var _isComplete = false
+    private var _isClaimed = false
+    private var waiters: [CheckedContinuation<any Sendable, Error>] = []
 
     init() {
         group.enter()
     }
 
+    /// First caller wins the right to run the body (task or forcer)
+    func claim() -> Bool {
+        lock.withLock {
+            guard !_isClaimed else { return false }
+            _isClaimed = true
+            return true
+        }
+    }
+
+    /// Run `work` and record its outcome
+    func run(_ work: @Sendable () async throws -> any Sendable) async throws -> any Sendable {
+        do {
+            let value = try await work()
+            complete(.success(value))
+            return value
+        } catch {
+            complete(.failure(error))
+            throw error
+        }
+    }
+
+    /// Suspend (without blocking a thread) until the result is available
+    func result() async throws -> any Sendable {
+        try await withCheckedThrowingContinuation { continuation in
+            let ready: Result<any Sendable, Error>? = lock.withLock {
+                if let r = _result { return r }
+                waiters.append(continuation)
+                return nil
+            }
+            if let ready {
+                continuation.resume(with: ready)
+            }
+        }
+    }
+
     var isResolved: Bool {
         lock.withLock { _isComplete }
     }
 
     func complete(_ result: Result<any Sendable, Error>) {
-        let shouldLeave: Bool = lock.withLock {
-            guard !_isComplete else { return false }
+        let resumed: [CheckedContinuation<any Sendable, Error>]? = lock.withLock {
+            guard !_isComplete else { return nil }
             _result = result
             _isComplete = true
-            return true
+            defer { waiters.removeAll() }
+            return waiters
         }
-        if shouldLeave {
+        if let resumed {
             group.leave()
+            for continuation in resumed {
+                continuation.resume(with: result)
+            }
+        }
+    }
+
+    /// On a work-stealing worker, keep running queued jobs instead of
+    /// parking the thread until the result arrives or `deadline` passes.
+    /// A no-op on any other thread.
+    private func helpWhileWaiting(until deadline: DispatchTime) {
+        guard let pool = WorkStealingExecutor.currentWorkerExecutor else { return }
+        while !isResolved && DispatchTime.now() < deadline {
+            if !pool.runQueuedJobOnCurrentWorker() {
+                _ = group.wait(timeout: min(.now() + .milliseconds(1), deadline))
+            }
         }
     }
 
     func wait() throws -> any Sendable {
+        helpWhileWaiting(until: .distantFuture)
         group.wait()
         return try lock.withLock {
             guard let r = _result else {
@@ -215,6 +312,7 @@ private final class ResultStorage: @unchecked Sendable {
         sourceLocation: String?
     ) throws -> any Sendable {
         let timeout = DispatchTime.now() + budget
+        helpWhileWaiting(until: timeout)
         if group.wait(timeout: timeout) == .timedOut {
             let location = sourceLocation.map { " at \($0)" } ?? ""
             let msg = "[AROFuture] Slow force: '\(bindingName)'\(location) — waited >\(String(format: "%.2f", budget))s, still pending\n"
@@ -222,6 +320,7 @@ private final class ResultStorage: @unchecked Sendable {
             // Continue waiting indefinitely — the warning is informational,
             // not a deadline. A real deadlock will hang here, but the
             // warning above is the diagnostic the operator needs.
+            helpWhileWaiting(until: .distantFuture)
             group.wait()
         }
         return try lock.withLock {
@@ -233,6 +332,58 @@ private final class ResultStorage: @unchecked Sendable {
     }
 }
 
+// MARK: - InlineTaskExecutor
+
+/// Runs a claimed future body on the forcing thread.
+///
+/// The body is started as a Task that prefers this executor, and the
+/// forcing thread drains its jobs until the result is recorded: every
+/// resumption after an `await` is enqueued here and executed by the
+/// thread that is waiting for it anyway.
+private final class InlineTaskExecutor: TaskExecutor, @unchecked Sendable {
+    private let condition = NSCondition()
+    private var jobs: [UnownedJob] = []
+
+    static func run(_ work: @Sendable @escaping () async throws -> any Sendable, into storage: ResultStorage) {
+        let executor = InlineTaskExecutor()
+        Task(executorPreference: executor) {
+            try await storage.run(work)
+        }
+        executor.drain(until: storage)
+    }
+
+    func enqueue(_ job: consuming ExecutorJob) {
+        let unowned = UnownedJob(job)
+        condition.lock()
+        jobs.append(unowned)
+        condition.signal()
+        condition.unlock()
+    }
+
+    func asUnownedTaskExecutor() -> UnownedTaskExecutor {
+        UnownedTaskExecutor(ordinary: self)
+    }
+
+    private func drain(until storage: ResultStorage) {
+        let unownedExecutor = asUnownedTaskExecutor()
+        while !storage.isResolved {
+            condition.lock()
+            while jobs.isEmpty && !storage.isResolved {
+                // Completion normally happens in a job run below; the
+                // timeout covers a body that finishes on another executor.
+                _ = condition.wait(until: Date().addingTimeInterval(0.01))
+            }
+            let batch = jobs
+            jobs.removeAll()
+            condition.unlock()
+
+            for job in batch {
+                job.runSynchronously(on: unownedExecutor)
+            }
+        }
+    }
+}
+
 // MARK: - Errors
 
 public enum AROFutureError: Error, CustomStringConvertible {
@@ -202,22 +202,15 @@ private func executeAction(
         let externalName = resultDesc.base
         let internalName = objectDesc.base
         if let value = ctxHandle.context.resolveAny(internalName) {
-            let runtime = ctxHandle.runtime.runtime
-            let businessActivity = ctxHandle.context.businessActivity
-            let featureSetName = ctxHandle.context.featureSetName
-            let executionId = ctxHandle.context.executionId
-
-            // Store in globalSymbols asynchronously
-            Task { @Sendable in
-                let globalSymbols = await runtime.globalSymbols
-                await globalSymbols.publish(
-                    name: externalName,
-                    value: value,
-                    fromFeatureSet: featureSetName,
-                    businessActivity: businessActivity,
-                    executionId: executionId
-                )
-            }
+            // Publishing swaps in a new symbol snapshot synchronously, so the
+            // symbol is visible before the next statement runs
+            ctxHandle.runtime.runtime.globalSymbols.publish(
+                name: externalName,
+                value: value,
+                fromFeatureSet: ctxHandle.context.featureSetName,
+                businessActivity: ctxHandle.context.businessActivity,
+                executionId: ctxHandle.context.executionId
+            )
         }
     }
 
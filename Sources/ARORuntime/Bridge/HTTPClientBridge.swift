@@ -121,34 +121,19 @@ public func aro_http_request_execute(_ requestPtr: UnsafeMutableRawPointer?) ->
 
     Task { [handle, resultHolder] in
         do {
-            guard let url = URL(string: handle.url) else {
-                semaphore.signal()
-                return
-            }
-
-            var request = URLRequest(url: url)
-            request.httpMethod = handle.method
-
-            for (name, value) in handle.headers {
-                request.setValue(value, forHTTPHeaderField: name)
-            }
-
-            if let body = handle.body {
-                request.httpBody = body
-            }
-
-            let (data, response) = try await URLSession.shared.data(for: request)
+            // Same client (and therefore the same cache / request
+            // coalescing pipeline) the interpreter's Request action uses
+            let response = try await URLSessionHTTPClient.shared.execute(
+                method: handle.method,
+                url: handle.url,
+                headers: handle.headers,
+                body: handle.body
+            )
 
             let resp = HTTPResponseHandle()
-            if let httpResponse = response as? HTTPURLResponse {
-                resp.statusCode = httpResponse.statusCode
-                for (key, value) in httpResponse.allHeaderFields {
-                    if let k = key as? String, let v = value as? String {
-                        resp.headers[k] = v
-                    }
-                }
-            }
-            resp.body = data
+            resp.statusCode = response.statusCode
+            resp.headers = response.headers
+            resp.body = response.body
             resultHolder.response = resp
         } catch {
             print("[ARO] HTTP request error: \(error)")
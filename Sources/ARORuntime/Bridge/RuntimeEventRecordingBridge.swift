@@ -65,9 +65,9 @@ public func aro_runtime_register_handler(
                 // Binding the plain key last lets it override "event" if the payload
                 // itself contains an "event" key (e.g. socket.disconnected).
                 contextHandle.context.bind("event", value: event.payload)
-                for (key, value) in event.payload {
-                    contextHandle.context.bind("event:\(key)", value: value)
-                    contextHandle.context.bind(key, value: value)
+                for binding in event.sharedPayload.bindings {
+                    contextHandle.context.bind(binding.qualifiedName, value: binding.value)
+                    contextHandle.context.bind(binding.key, value: binding.value)
                 }
 
                 // Bind terminal capabilities so ARO handler code can use <terminal: columns>
@@ -92,7 +92,7 @@ public func aro_runtime_register_handler(
 
                 // Emit FeatureSetCompletedEvent for metrics tracking
                 let duration = Date().timeIntervalSince(startTime) * 1000
-                runtimeHandle.runtime.eventBus.publish(FeatureSetCompletedEvent(
+                runtimeHandle.runtime.eventBus.publish(ifObserved: FeatureSetCompletedEvent(
                     featureSetName: handlerName,
                     businessActivity: eventTypeStr,
                     executionId: contextHandle.context.executionId,
@@ -374,7 +374,7 @@ public func aro_register_repository_observer_with_guard(
 
                 // Emit FeatureSetCompletedEvent for metrics tracking
                 let duration = Date().timeIntervalSince(startTime) * 1000
-                runtimeHandle.runtime.eventBus.publish(FeatureSetCompletedEvent(
+                runtimeHandle.runtime.eventBus.publish(ifObserved: FeatureSetCompletedEvent(
                     featureSetName: observerName,
                     businessActivity: "\(repositoryName) Observer",
                     executionId: contextHandle.context.executionId,
@@ -463,8 +463,8 @@ public func aro_runtime_register_state_transition_handler(
 
                 // Bind event payload — handlers extract with: Extract the <x> from the <event: x>
                 contextHandle.context.bind("event", value: event.payload)
-                for (k, v) in event.payload {
-                    contextHandle.context.bind("event:\(k)", value: v)
+                for binding in event.sharedPayload.bindings {
+                    contextHandle.context.bind(binding.qualifiedName, value: binding.value)
                 }
 
                 bindTerminalToContext(contextHandle)
@@ -483,7 +483,7 @@ public func aro_runtime_register_state_transition_handler(
                 let result = handlerFunc(contextPtr)
 
                 let duration = Date().timeIntervalSince(Date()) * 1000
-                runtimeHandle.runtime.eventBus.publish(FeatureSetCompletedEvent(
+                runtimeHandle.runtime.eventBus.publish(ifObserved: FeatureSetCompletedEvent(
                     featureSetName: handlerName,
                     businessActivity: "StateTransition Handler",
                     executionId: contextHandle.context.executionId,
@@ -571,11 +571,11 @@ public func aro_runtime_register_notification_handler(
 
                 // Bind event payload — handler extracts with: Extract the <user> from the <event: user>
                 contextHandle.context.bind("event", value: event.payload)
-                for (k, v) in event.payload {
-                    contextHandle.context.bind("event:\(k)", value: v)
+                for binding in event.sharedPayload.bindings {
+                    contextHandle.context.bind(binding.qualifiedName, value: binding.value)
                     // Also bind directly so feature-set-level when guards can evaluate payload fields
                     // e.g. `(Handler: NotificationSent Handler) when <age> >= 16` needs `age` in context
-                    contextHandle.context.bind(k, value: v)
+                    contextHandle.context.bind(binding.key, value: binding.value)
                 }
 
                 bindTerminalToContext(contextHandle)
@@ -594,7 +594,7 @@ public func aro_runtime_register_notification_handler(
                 let result = handlerFunc(contextPtr)
 
                 let duration = Date().timeIntervalSince(Date()) * 1000
-                runtimeHandle.runtime.eventBus.publish(FeatureSetCompletedEvent(
+                runtimeHandle.runtime.eventBus.publish(ifObserved: FeatureSetCompletedEvent(
                     featureSetName: handlerName,
                     businessActivity: "NotificationSent Handler",
                     executionId: contextHandle.context.executionId,
@@ -197,33 +197,31 @@ public func aro_context_bind_published_variables(
     let businessActivity = businessActivityPtr.map { String(cString: $0) } ?? ""
     let runtime = contextHandle.runtime.runtime
 
-    // This must be async, so we need to run it synchronously using a semaphore
-    let semaphore = DispatchSemaphore(value: 0)
-
     // Explicitly capture values to avoid data race warnings
     let context = contextHandle.context
     let terminalService = contextHandle.terminalService
 
-    Task { @Sendable in
-        let globalSymbols = await runtime.globalSymbols
-        let allSymbols = await globalSymbols.allSymbols()
-
-        for (name, entry) in allSymbols {
-            // Skip if already bound
-            if context.resolveAny(name) != nil {
-                continue
-            }
+    // Published symbols are read from the current snapshot without hopping
+    for (name, entry) in runtime.globalSymbols.allSymbols() {
+        // Skip if already bound
+        if context.resolveAny(name) != nil {
+            continue
+        }
 
-            // Only bind if business activity matches (or both are empty)
-            if !entry.businessActivity.isEmpty && !businessActivity.isEmpty &&
-               entry.businessActivity == businessActivity {
-                context.bind(name, value: entry.value)
-            } else if entry.businessActivity.isEmpty || businessActivity.isEmpty {
-                // If either is empty, bind it (framework/external variables)
-                context.bind(name, value: entry.value)
-            }
+        // Only bind if business activity matches (or both are empty)
+        if !entry.businessActivity.isEmpty && !businessActivity.isEmpty &&
+           entry.businessActivity == businessActivity {
+            context.bind(name, value: entry.value)
+        } else if entry.businessActivity.isEmpty || businessActivity.isEmpty {
+            // If either is empty, bind it (framework/external variables)
+            context.bind(name, value: entry.value)
         }
+    }
 
+    // Terminal detection is async, so we run it synchronously using a semaphore
+    let semaphore = DispatchSemaphore(value: 0)
+
+    Task { @Sendable in
         // Bind terminal capabilities dict so ARO code can use <terminal: columns> etc.
         let terminalDict: [String: any Sendable]
         if let ts = terminalService {
@@ -0,0 +1,252 @@
+// ============================================================
+// WorkStealingExecutor.swift
+// ARORuntime - Bounded work-stealing executor for AROFuture
+// ============================================================
+//
+// Alternative to `ActionTaskExecutor` (GCD's elastic global queue).
+// Under load spikes the elastic queue answers every blocked force
+// point with another thread, so a burst of futures can leave hundreds
+// of pthreads parked on DispatchGroups. This executor keeps a fixed
+// set of workers, roughly one per core, and avoids the deadlock the
+// elastic queue was protecting against in two ways:
+//
+//   - Forcing a future whose body has not started yet runs the body
+//     inline on the forcing thread (see AROFuture.force), so a blocked
+//     consumer is never waiting on a job that sits in a queue.
+//   - A worker that forces a future which is already running does not
+//     park: it keeps executing queued jobs until the result arrives.
+//
+// Each worker owns a deque. Jobs enqueued from a worker go to the back
+// of its own deque and are popped LIFO by their owner (cache-warm);
+// idle workers steal FIFO from the front of other deques. Jobs enqueued
+// from outside the pool go to a shared injection deque.
+//
+// Selected with `ARO_ACTION_EXECUTOR=work-stealing`; the worker count
+// defaults to the active core count and can be set with
+// `ARO_ACTION_WORKERS`.
+
+import Foundation
+
+// MARK: - Executor Selection
+
+/// Which executor `AROFuture` runs action work on.
+public enum ActionExecutorKind: Sendable {
+    /// `ActionTaskExecutor`: GCD's elastic global queue (default)
+    case elastic
+    /// `WorkStealingExecutor.shared`: fixed workers with work stealing
+    case workStealing
+
+    /// Read once from `ARO_ACTION_EXECUTOR` ("elastic" or "work-stealing").
+    public static let selected: ActionExecutorKind = {
+        switch ProcessInfo.processInfo.environment["ARO_ACTION_EXECUTOR"]?.lowercased() {
+        case "work-stealing", "workstealing", "bounded":
+            return .workStealing
+        default:
+            return .elastic
+        }
+    }()
+}
+
+// MARK: - WorkStealingExecutor
+
+/// TaskExecutor with a fixed worker count and per-worker work-stealing deques.
+@available(macOS 15.0, *)
+public final class WorkStealingExecutor: TaskExecutor, @unchecked Sendable {
+    public static let shared: WorkStealingExecutor = {
+        let configured = ProcessInfo.processInfo.environment["ARO_ACTION_WORKERS"].flatMap(Int.init)
+        return WorkStealingExecutor(workerCount: configured ?? ProcessInfo.processInfo.activeProcessorCount)
+    }()
+
+    public let workerCount: Int
+
+    private let deques: [JobDeque]
+    private let injection = JobDeque()
+
+    /// Parks idle workers. `idleWorkers` and `isShutDown` are guarded by it.
+    private let parking = NSCondition()
+    private var idleWorkers = 0
+    private var isShutDown = false
+
+    public init(workerCount: Int) {
+        self.workerCount = max(1, workerCount)
+        self.deques = (0..<self.workerCount).map { _ in JobDeque() }
+        for index in 0..<self.workerCount {
+            let thread = WorkerThread(executor: self, index: index)
+            thread.name = "aro.action-worker.\(index)"
+            thread.start()
+        }
+    }
+
+    public func enqueue(_ job: consuming ExecutorJob) {
+        let unowned = UnownedJob(job)
+        if let worker = WorkerThread.current(in: self) {
+            deques[worker].push(unowned)
+        } else {
+            injection.push(unowned)
+        }
+
+        // Pushing happens before taking the parking lock, and a worker only
+        // parks after re-checking the deques under that lock, so a wakeup
+        // can't be lost between its last scan and its wait.
+        parking.lock()
+        if idleWorkers > 0 {
+            parking.signal()
+        }
+        parking.unlock()
+    }
+
+    public func asUnownedTaskExecutor() -> UnownedTaskExecutor {
+        UnownedTaskExecutor(ordinary: self)
+    }
+
+    /// Stop the workers once their queues are drained. The shared
+    /// executor lives for the whole process; this is for dedicated
+    /// instances (tests, embedders).
+    public func shutdown() {
+        parking.lock()
+        isShutDown = true
+        parking.broadcast()
+        parking.unlock()
+    }
+
+    // MARK: - Helping
+
+    /// Run one queued job on the current thread if it is one of this
+    /// executor's workers. Returns false when the thread is not a worker
+    /// or there is nothing to run.
+    func runQueuedJobOnCurrentWorker() -> Bool {
+        guard let index = WorkerThread.current(in: self), let job = nextJob(for: index) else {
+            return false
+        }
+        job.runSynchronously(on: asUnownedTaskExecutor())
+        return true
+    }
+
+    /// The executor whose worker is running the current thread, if any
+    static var currentWorkerExecutor: WorkStealingExecutor? {
+        (Thread.current as? WorkerThread)?.executor
+    }
+
+    // MARK: - Workers
+
+    fileprivate func runWorker(_ index: Int) {
+        let unownedExecutor = asUnownedTaskExecutor()
+        while true {
+            if let job = nextJob(for: index) {
+                job.runSynchronously(on: unownedExecutor)
+                continue
+            }
+
+            parking.lock()
+            if hasQueuedJobs {
+                parking.unlock()
+                continue
+            }
+            if isShutDown {
+                parking.unlock()
+                return
+            }
+            idleWorkers += 1
+            parking.wait()
+            idleWorkers -= 1
+            parking.unlock()
+        }
+    }
+
+    /// Own deque first (LIFO), then the injection queue, then steal from
+    /// the other workers starting with the next one over.
+    private func nextJob(for index: Int) -> UnownedJob? {
+        if let job = deques[index].popBack() {
+            return job
+        }
+        if let job = injection.popFront() {
+            return job
+        }
+        for offset in 1..<workerCount {
+            if let job = deques[(index + offset) % workerCount].popFront() {
+                return job
+            }
+        }
+        return nil
+    }
+
+    private var hasQueuedJobs: Bool {
+        !injection.isEmpty || deques.contains { !$0.isEmpty }
+    }
+}
+
+// MARK: - Worker Thread
+
+@available(macOS 15.0, *)
+private final class WorkerThread: Thread {
+    // Strong: a worker keeps its executor alive until shutdown
+    let executor: WorkStealingExecutor
+    let index: Int
+
+    init(executor: WorkStealingExecutor, index: Int) {
+        self.executor = executor
+        self.index = index
+        super.init()
+    }
+
+    override func main() {
+        executor.runWorker(index)
+    }
+
+    /// Worker index of the current thread within `executor`, if any
+    static func current(in executor: WorkStealingExecutor) -> Int? {
+        guard let worker = Thread.current as? WorkerThread, worker.executor === executor else {
+            return nil
+        }
+        return worker.index
+    }
+}
+
+// MARK: - Job Deque
+
+/// Lock-protected double-ended job queue. The owner pushes and pops at
+/// the back; thieves and the injection path take from the front.
+private final class JobDeque: @unchecked Sendable {
+    private let lock = NSLock()
+    private var jobs: [UnownedJob] = []
+    private var head = 0
+
+    var isEmpty: Bool {
+        lock.withLock { head == jobs.count }
+    }
+
+    func push(_ job: UnownedJob) {
+        lock.withLock { jobs.append(job) }
+    }
+
+    func popBack() -> UnownedJob? {
+        lock.withLock {
+            guard head < jobs.count else { return nil }
+            let job = jobs.removeLast()
+            resetIfDrained()
+            return job
+        }
+    }
+
+    func popFront() -> UnownedJob? {
+        lock.withLock {
+            guard head < jobs.count else { return nil }
+            let job = jobs[head]
+            head += 1
+            resetIfDrained()
+            // Reclaim the consumed prefix once it dominates the buffer
+            if head > 64 && head * 2 > jobs.count {
+                jobs.removeFirst(head)
+                head = 0
+            }
+            return job
+        }
+    }
+
+    private func resetIfDrained() {
+        if head == jobs.count {
+            jobs.removeAll(keepingCapacity: true)
+            head = 0
+        }
+    }
+}
@@ -26,13 +26,11 @@ public actor ExecutionEngine {
     private let eventBus: EventBus
 
     /// Global symbol registry for published variables
-    private let globalSymbols: GlobalSymbolStorage
+    private nonisolated let globalSymbols: GlobalSymbolStorage
 
     /// Public accessor for global symbols (needed for HTTP handlers)
-    public var sharedGlobalSymbols: GlobalSymbolStorage {
-        get async {
-            return globalSymbols
-        }
+    public nonisolated var sharedGlobalSymbols: GlobalSymbolStorage {
+        return globalSymbols
     }
 
     /// Service registry for dependency injection
@@ -551,6 +549,53 @@ public actor ExecutionEngine {
         // Bind event-specific data using the provided closure
         bindEventData(handlerContext, event)
 
+        await runHandler(
+            analyzedFS,
+            in: handlerContext,
+            actionRegistry: actionRegistry,
+            eventBus: eventBus,
+            globalSymbols: globalSymbols,
+            services: services
+        )
+    }
+
+    /// Event handler executor for events that carry a shared payload frame.
+    /// The frame already holds `event` and `event:<key>`, so the handler
+    /// context binds only the handler's own locals.
+    private static func executeHandler(
+        _ analyzedFS: AnalyzedFeatureSet,
+        eventFrame: RuntimeContext,
+        actionRegistry: ActionRegistry,
+        eventBus: EventBus,
+        globalSymbols: GlobalSymbolStorage,
+        services: ServiceRegistry
+    ) async {
+        let handlerContext = RuntimeContext(
+            featureSetName: analyzedFS.featureSet.name,
+            businessActivity: analyzedFS.featureSet.businessActivity,
+            eventBus: eventBus,
+            parent: eventFrame
+        )
+
+        await runHandler(
+            analyzedFS,
+            in: handlerContext,
+            actionRegistry: actionRegistry,
+            eventBus: eventBus,
+            globalSymbols: globalSymbols,
+            services: services
+        )
+    }
+
+    /// Evaluate the when-guard and run the handler in a prepared context
+    private static func runHandler(
+        _ analyzedFS: AnalyzedFeatureSet,
+        in handlerContext: RuntimeContext,
+        actionRegistry: ActionRegistry,
+        eventBus: EventBus,
+        globalSymbols: GlobalSymbolStorage,
+        services: ServiceRegistry
+    ) async {
         // Copy services from base context
         await services.registerAll(in: handlerContext)
 
@@ -602,23 +647,17 @@ public actor ExecutionEngine {
         globalSymbols: GlobalSymbolStorage,
         services: ServiceRegistry
     ) async {
+        // "event" and the payload keys are bound once per event in a frame
+        // shared by every handler of this event type
+        let eventFrame = event.handlerFrames.frame(over: baseContext) { event.sharedPayload }
         await executeHandler(
             analyzedFS,
-            baseContext: baseContext,
-            event: event,
+            eventFrame: eventFrame,
             actionRegistry: actionRegistry,
             eventBus: eventBus,
             globalSymbols: globalSymbols,
             services: services
-        ) { context, event in
-            // Bind event payload to context as "event" with nested access
-            context.bind("event", value: event.payload)
-
-            // Also bind payload keys directly for convenience
-            for (key, value) in event.payload {
-                context.bind("event:\(key)", value: value)
-            }
-        }
+        )
     }
 
     /// Execute a repository observer feature set (static version to avoid actor deadlock)
@@ -631,42 +670,16 @@ public actor ExecutionEngine {
         globalSymbols: GlobalSymbolStorage,
         services: ServiceRegistry
     ) async {
+        // The observer payload is built once per change and shared by every observer
+        let eventFrame = event.handlerFrames.frame(over: baseContext) { EventPayload(event.payload) }
         await executeHandler(
             analyzedFS,
-            baseContext: baseContext,
-            event: event,
+            eventFrame: eventFrame,
             actionRegistry: actionRegistry,
             eventBus: eventBus,
             globalSymbols: globalSymbols,
             services: services
-        ) { context, event in
-            // Build event payload for the observer
-            var eventPayload: [String: any Sendable] = [
-                "repositoryName": event.repositoryName,
-                "changeType": event.changeType.rawValue,
-                "timestamp": event.timestamp
-            ]
-
-            if let entityId = event.entityId {
-                eventPayload["entityId"] = entityId
-            }
-
-            if let newValue = event.newValue {
-                eventPayload["newValue"] = newValue
-            }
-
-            if let oldValue = event.oldValue {
-                eventPayload["oldValue"] = oldValue
-            }
-
-            // Bind event payload to context as "event" with nested access
-            context.bind("event", value: eventPayload)
-
-            // Also bind event keys directly for convenience
-            for (key, value) in eventPayload {
-                context.bind("event:\(key)", value: value)
-            }
-        }
+        )
     }
 
     /// Register notification event handlers for feature sets with "NotificationSent Handler" business activity
@@ -1094,26 +1107,12 @@ public actor ExecutionEngine {
 
                     await ExecutionEngine.executeHandler(
                         analyzedFS,
-                        baseContext: baseContext,
-                        event: event,
+                        eventFrame: event.handlerFrames.frame(over: baseContext) { EventPayload(event.payload) },
                         actionRegistry: capturedActionRegistry,
                         eventBus: capturedEventBus,
                         globalSymbols: capturedGlobalSymbols,
                         services: capturedServices
-                    ) { context, event in
-                        var eventPayload: [String: any Sendable] = [
-                            "timestamp": event.timestamp,
-                            "repositoryName": event.repositoryName,
-                            "changeType": event.changeType.rawValue
-                        ]
-                        if let entityId = event.entityId { eventPayload["entityId"] = entityId }
-                        if let newValue = event.newValue { eventPayload["newValue"] = newValue }
-                        if let oldValue = event.oldValue { eventPayload["oldValue"] = oldValue }
-                        context.bind("event", value: eventPayload)
-                        for (key, value) in eventPayload {
-                            context.bind("event:\(key)", value: value)
-                        }
-                    }
+                    )
                 }
             }
         }
@@ -1432,7 +1431,6 @@ public struct PublishedSymbol: Sendable {
 }
 
 /// Thread-safe storage for published symbols with business activity enforcement.
-/// Converted to actor for Swift 6.2 concurrency safety (Issue #2).
 ///
 /// Symbols are scoped to their publishing execution. When `evict(executionId:)`
 /// is called after a feature set completes, its symbols are removed unless a
@@ -1440,15 +1438,121 @@ public struct PublishedSymbol: Sendable {
 /// Application-lifecycle feature sets (Application-Start / Application-End) are
 /// intentionally excluded from eviction so their symbols persist for the entire
 /// process lifetime.
-public actor GlobalSymbolStorage {
-    private var symbols: [String: PublishedSymbol] = [:]
+///
+/// Reads are read-copy-update: the symbol table is an immutable, versioned
+/// `Snapshot`, and a reader only retains the current snapshot under a lock
+/// held for one pointer load. Writers are serialized among themselves, build
+/// the next version off to the side, and swap it in. Request handlers reading
+/// published configuration therefore never queue behind each other or behind
+/// an actor, and a caller doing several lookups can take one `snapshot()` and
+/// see a consistent table.
+///
+/// The price is on the write side. A snapshot is split into
+/// `Snapshot.shardCount` dictionaries by name hash, and a write copies the
+/// one shard it touches plus the shard array, so a publish or eviction costs
+/// O(N / shardCount + shardCount) instead of O(1). That keeps a run that
+/// publishes thousands of symbols far from quadratic, but a workload that
+/// publishes far more often than it reads is better served by a plain locked
+/// dictionary.
+public final class GlobalSymbolStorage: @unchecked Sendable {
+    /// One immutable version of the published symbol table. Iterating it
+    /// walks the shards in place, so binding every published symbol never
+    /// copies the table.
+    public final class Snapshot: Sequence, Sendable {
+        /// Number of independently copied dictionaries per snapshot
+        static let shardCount = 64
+
+        /// Incremented by every publish or eviction that changed the table
+        public let version: UInt64
+        /// Number of symbols across all shards
+        public let count: Int
+        let shards: [[String: PublishedSymbol]]
+
+        init(version: UInt64, shards: [[String: PublishedSymbol]], count: Int) {
+            self.version = version
+            self.shards = shards
+            self.count = count
+        }
+
+        static let empty = Snapshot(
+            version: 0,
+            shards: Array(repeating: [:], count: shardCount),
+            count: 0
+        )
+
+        static func shard(for name: String) -> Int {
+            name.hashValue & (shardCount - 1)
+        }
+
+        /// The entry published under `name`, regardless of business activity
+        public subscript(name: String) -> PublishedSymbol? {
+            shards[Self.shard(for: name)][name]
+        }
+
+        public var isEmpty: Bool { count == 0 }
+
+        public var underestimatedCount: Int { count }
+
+        public func makeIterator() -> Iterator {
+            Iterator(shards: shards)
+        }
+
+        /// Yields `(name, entry)` pairs shard by shard, in no particular order
+        public struct Iterator: IteratorProtocol {
+            let shards: [[String: PublishedSymbol]]
+            private var shard = 0
+            private var entries: Dictionary<String, PublishedSymbol>.Iterator?
+
+            init(shards: [[String: PublishedSymbol]]) {
+                self.shards = shards
+            }
+
+            public mutating func next() -> (name: String, entry: PublishedSymbol)? {
+                while true {
+                    if let element = entries?.next() {
+                        return (element.key, element.value)
+                    }
+                    guard shard < shards.count else { return nil }
+                    entries = shards[shard].makeIterator()
+                    shard += 1
+                }
+            }
+        }
+
+        /// Resolve a symbol, or nil if it is missing or belongs to another business activity
+        public func resolveAny(_ name: String, forBusinessActivity activity: String) -> (any Sendable)? {
+            guard let entry = self[name], !entry.isDenied(to: activity) else { return nil }
+            return entry.value
+        }
+    }
+
+    /// Guards only the `current` pointer; held for a load or a swap
+    private let snapshotLock = NSLock()
+    nonisolated(unsafe) private var current = Snapshot.empty
+
+    /// Serializes writers so each builds on the latest version
+    private let writeLock = NSLock()
 
-    /// Reverse index: executionId → symbol names it owns.
+    /// Reverse index: executionId → symbol names it owns. Writer-only state.
     /// Enables O(1) bulk eviction without scanning the entire symbol table.
-    private var executionIndex: [String: Set<String>] = [:]
+    nonisolated(unsafe) private var executionIndex: [String: Set<String>] = [:]
 
     public init() {}
 
+    /// The current version of the symbol table
+    public func snapshot() -> Snapshot {
+        snapshotLock.lock()
+        defer { snapshotLock.unlock() }
+        return current
+    }
+
+    private func install(_ shards: [[String: PublishedSymbol]], count: Int, after previous: Snapshot) {
+        let next = Snapshot(version: previous.version &+ 1, shards: shards, count: count)
+        snapshotLock.lock()
+        current = next
+        snapshotLock.unlock()
+    }
+
     // MARK: - Write
 
     /// Store a published symbol with its business activity and execution owner.
@@ -1459,18 +1563,26 @@ public actor GlobalSymbolStorage {
         businessActivity: String,
         executionId: String
     ) {
+        writeLock.lock()
+        defer { writeLock.unlock() }
+
+        let previous = snapshot()
+        let index = Snapshot.shard(for: name)
+        var shards = previous.shards
+        let existing = shards[index][name]
         // If a previous entry exists under the same name, remove it from the
         // old execution's index to keep the index clean.
-        if let existing = symbols[name], existing.executionId != executionId {
+        if let existing, existing.executionId != executionId {
             executionIndex[existing.executionId]?.remove(name)
         }
-        symbols[name] = PublishedSymbol(
+        shards[index][name] = PublishedSymbol(
             value: value,
             featureSet: fromFeatureSet,
             businessActivity: businessActivity,
             executionId: executionId
         )
         executionIndex[executionId, default: []].insert(name)
+        install(shards, count: previous.count + (existing == nil ? 1 : 0), after: previous)
     }
 
     /// Remove all symbols published by a specific execution.
@@ -1479,12 +1591,20 @@ public actor GlobalSymbolStorage {
     /// a symbol that was overwritten by a newer invocation: the stored
     /// `executionId` is checked before deleting.
     public func evict(executionId: String) {
+        writeLock.lock()
+        defer { writeLock.unlock() }
+
         guard let names = executionIndex.removeValue(forKey: executionId) else { return }
-        for name in names {
-            if symbols[name]?.executionId == executionId {
-                symbols.removeValue(forKey: name)
-            }
+        let previous = snapshot()
+        let owned = names.filter { previous[$0]?.executionId == executionId }
+        // Most feature sets publish nothing; don't cut a new version for them
+        guard !owned.isEmpty else { return }
+
+        var shards = previous.shards
+        for name in owned {
+            shards[Snapshot.shard(for: name)].removeValue(forKey: name)
         }
+        install(shards, count: previous.count - owned.count, after: previous)
     }
 
     // MARK: - Read
@@ -1495,73 +1615,43 @@ public actor GlobalSymbolStorage {
     ///   - forBusinessActivity: The business activity of the requesting feature set
     /// - Returns: The value if found and accessible, nil otherwise
     public func resolve<T: Sendable>(_ name: String, forBusinessActivity: String) -> T? {
-        guard let entry = symbols[name] else { return nil }
-
-        // Business activity validation: must match or be empty (framework/external)
-        if !entry.businessActivity.isEmpty && !forBusinessActivity.isEmpty &&
-           entry.businessActivity != forBusinessActivity {
-            return nil  // Access denied - different business activity
-        }
-
-        return entry.value as? T
+        snapshot().resolveAny(name, forBusinessActivity: forBusinessActivity) as? T
     }
 
     /// Resolve a published symbol as any Sendable (validates business activity)
     public func resolveAny(_ name: String, forBusinessActivity: String) -> (any Sendable)? {
-        guard let entry = symbols[name] else { return nil }
-
-        // Business activity validation: must match or be empty (framework/external)
-        if !entry.businessActivity.isEmpty && !forBusinessActivity.isEmpty &&
-           entry.businessActivity != forBusinessActivity {
-            return nil  // Access denied - different business activity
-        }
-
-        return entry.value
+        snapshot().resolveAny(name, forBusinessActivity: forBusinessActivity)
     }
 
     /// Check if a symbol is published and accessible
     public func isPublished(_ name: String, forBusinessActivity: String) -> Bool {
-        guard let entry = symbols[name] else { return false }
-
-        // Business activity validation
-        if !entry.businessActivity.isEmpty && !forBusinessActivity.isEmpty &&
-           entry.businessActivity != forBusinessActivity {
-            return false
-        }
-
-        return true
+        guard let entry = snapshot()[name] else { return false }
+        return !entry.isDenied(to: forBusinessActivity)
     }
 
     /// Get the feature set that published a symbol
     public func sourceFeatureSet(for name: String) -> String? {
-        return symbols[name]?.featureSet
+        return snapshot()[name]?.featureSet
     }
 
     /// Get the business activity that a symbol belongs to
     public func businessActivity(for name: String) -> String? {
-        return symbols[name]?.businessActivity
+        return snapshot()[name]?.businessActivity
     }
 
     /// Check if accessing a symbol would be denied due to business activity mismatch
     public func isAccessDenied(_ name: String, forBusinessActivity: String) -> Bool {
-        guard let entry = symbols[name] else { return false }
-
-        // Access is denied if both have non-empty business activities that don't match
-        return !entry.businessActivity.isEmpty &&
-               !forBusinessActivity.isEmpty &&
-               entry.businessActivity != forBusinessActivity
+        return snapshot()[name]?.isDenied(to: forBusinessActivity) ?? false
     }
 
     /// One-pass dependency resolution: walks the dependency list,
-    /// applying access-control checks and value lookups in a
-    /// single actor turn. Eliminates the per-dependency triple of
-    /// actor hops (\`isAccessDenied\`, \`businessActivity\`,
-    /// \`resolveAny\`) that \`FeatureSetExecutor\` was making before
-    /// (#332).
+    /// applying access-control checks and value lookups against a
+    /// single snapshot, so every dependency sees the same version (#332).
     public func resolveDependencies<S: Collection>(
         _ names: S,
         forBusinessActivity activity: String
     ) -> [DependencyResolution] where S.Element == String {
+        let symbols = snapshot()
         var out: [DependencyResolution] = []
         out.reserveCapacity(names.count)
         for name in names {
@@ -1569,10 +1659,7 @@ public actor GlobalSymbolStorage {
                 out.append(.notFound(name: name))
                 continue
             }
-            let crossActivity = !entry.businessActivity.isEmpty
-                && !activity.isEmpty
-                && entry.businessActivity != activity
-            if crossActivity {
+            if entry.isDenied(to: activity) {
                 out.append(.denied(
                     name: name,
                     sourceActivity: entry.businessActivity
@@ -1584,13 +1671,23 @@ public actor GlobalSymbolStorage {
         return out
     }
 
-    /// Get all published symbols (for eager binding in feature sets)
-    public func allSymbols() -> [String: PublishedSymbol] {
-        return symbols
+    /// Get all published symbols (for eager binding in feature sets).
+    /// This is the current snapshot itself; iterating it copies nothing.
+    public func allSymbols() -> Snapshot {
+        return snapshot()
     }
 
     /// Total number of currently stored symbols. Useful for memory monitoring.
-    public var count: Int { symbols.count }
+    public var count: Int { snapshot().count }
+}
+
+extension PublishedSymbol {
+    /// Business activity validation: access is denied only when both the
+    /// symbol and the requester have non-empty activities that differ
+    /// (empty means framework/external).
+    func isDenied(to activity: String) -> Bool {
+        !businessActivity.isEmpty && !activity.isEmpty && businessActivity != activity
+    }
 }
 
 /// Outcome of a single dependency lookup via
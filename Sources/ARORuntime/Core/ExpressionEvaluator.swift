@@ -2,6 +2,13 @@
 // ExpressionEvaluator.swift
 // ARO Runtime - Expression Evaluation (ARO-0002)
 // ============================================================
+//
+// Most expressions — literals, plain variable references, arithmetic,
+// comparisons, member access — never suspend, yet an async evaluator
+// allocates a suspension-capable frame for every node. `evaluate` first
+// checks whether the tree is pure (see `PurityCheck`) and, if so, runs
+// the synchronous `evaluatePure` instead. Both paths share the operator
+// implementations below, so results and error messages are identical.
 
 import Foundation
 import AROParser
@@ -9,7 +16,22 @@ import AROParser
 /// Evaluates expressions at runtime
 public struct ExpressionEvaluator: Sendable {
 
-    public init() {}
+    /// Route pure expressions through `evaluatePure`
+    private let usesPureFastPath: Bool
+
+    public init() {
+        self.usesPureFastPath = true
+    }
+
+    /// Evaluator with the synchronous fast path switched off (differential tests)
+    init(usesPureFastPath: Bool) {
+        self.usesPureFastPath = usesPureFastPath
+    }
+
+    /// Whether `expression` can be evaluated without suspending
+    static func isPure(_ expression: any AROParser.Expression) -> Bool {
+        expression.accept(PurityCheck())
+    }
 
     /// Evaluates an expression in the given context
     /// - Parameters:
@@ -17,6 +39,10 @@ public struct ExpressionEvaluator: Sendable {
     ///   - context: The execution context for variable resolution
     /// - Returns: The evaluated value
     public func evaluate(_ expression: any AROParser.Expression, context: ExecutionContext) async throws -> any Sendable {
+        if usesPureFastPath && Self.isPure(expression) {
+            return try evaluatePure(expression, context: context)
+        }
+
         switch expression {
         // Literal expressions
         case let literal as LiteralExpression:
@@ -146,6 +172,147 @@ public struct ExpressionEvaluator: Sendable {
         }
     }
 
+    // MARK: - Pure Evaluation
+
+    /// Synchronous counterpart of `evaluate` for trees that pass
+    /// `PurityCheck`. Mirrors the async cases for those node kinds.
+    private func evaluatePure(_ expression: any AROParser.Expression, context: ExecutionContext) throws -> any Sendable {
+        switch expression {
+        case let literal as LiteralExpression:
+            return evaluateLiteral(literal.value)
+
+        case let varRef as VariableRefExpression:
+            // Pure references have no specifiers, so none of the special
+            // forms (repository count, metrics, env, qualifiers) apply
+            guard let value = context.resolveAny(varRef.noun.base) else {
+                throw ExpressionError.undefinedVariable(varRef.noun.base)
+            }
+            return value
+
+        case let array as ArrayLiteralExpression:
+            var elements: [any Sendable] = []
+            for element in array.elements {
+                elements.append(try evaluatePure(element, context: context))
+            }
+            return elements
+
+        case let map as MapLiteralExpression:
+            var dict: [String: any Sendable] = [:]
+            for entry in map.entries {
+                dict[entry.key] = try evaluatePure(entry.value, context: context)
+            }
+            return dict
+
+        case let binary as BinaryExpression:
+            let left = try evaluatePure(binary.left, context: context)
+            let right = try evaluatePure(binary.right, context: context)
+            return try applyBinary(binary.op, left, right)
+
+        case let unary as UnaryExpression:
+            return try applyUnary(unary.op, try evaluatePure(unary.operand, context: context))
+
+        case let member as MemberAccessExpression:
+            return try applyMemberAccess(member.member, on: try evaluatePure(member.base, context: context))
+
+        case let subscript_ as SubscriptExpression:
+            let base = try evaluatePure(subscript_.base, context: context)
+            let index = try evaluatePure(subscript_.index, context: context)
+            return try applySubscript(base, index)
+
+        case let grouped as GroupedExpression:
+            return try evaluatePure(grouped.expression, context: context)
+
+        case let existence as ExistenceExpression:
+            if let varRef = existence.expression as? VariableRefExpression {
+                return context.exists(varRef.noun.base)
+            }
+            do {
+                _ = try evaluatePure(existence.expression, context: context)
+                return true
+            } catch {
+                return false
+            }
+
+        case let typeCheck as TypeCheckExpression:
+            let value = try evaluatePure(typeCheck.expression, context: context)
+            return checkType(value, typeName: typeCheck.typeName)
+
+        case let interp as InterpolatedStringExpression:
+            var result = ""
+            for part in interp.parts {
+                switch part {
+                case .literal(let s):
+                    result += s
+                case .interpolation(let innerExpr):
+                    let value = try evaluatePure(innerExpr, context: context)
+                    result += "\(value)"
+                }
+            }
+            return result
+
+        default:
+            throw ExpressionError.unsupportedExpression(String(describing: type(of: expression)))
+        }
+    }
+
+    /// Marks trees that cannot suspend or call out. A variable reference
+    /// with specifiers is impure: it may run a plugin qualifier, count a
+    /// repository (async), or read metrics or the environment.
+    private struct PurityCheck: ExpressionVisitor {
+        typealias Result = Bool
+
+        func visit(_ node: LiteralExpression) -> Bool { true }
+
+        func visit(_ node: ArrayLiteralExpression) -> Bool {
+            node.elements.allSatisfy { $0.accept(self) }
+        }
+
+        func visit(_ node: MapLiteralExpression) -> Bool {
+            node.entries.allSatisfy { $0.value.accept(self) }
+        }
+
+        func visit(_ node: VariableRefExpression) -> Bool {
+            node.noun.typeAnnotation == nil
+        }
+
+        func visit(_ node: BinaryExpression) -> Bool {
+            node.left.accept(self) && node.right.accept(self)
+        }
+
+        func visit(_ node: UnaryExpression) -> Bool {
+            node.operand.accept(self)
+        }
+
+        func visit(_ node: MemberAccessExpression) -> Bool {
+            node.base.accept(self)
+        }
+
+        func visit(_ node: SubscriptExpression) -> Bool {
+            node.base.accept(self) && node.index.accept(self)
+        }
+
+        func visit(_ node: GroupedExpression) -> Bool {
+            node.expression.accept(self)
+        }
+
+        func visit(_ node: ExistenceExpression) -> Bool {
+            node.expression.accept(self)
+        }
+
+        func visit(_ node: TypeCheckExpression) -> Bool {
+            node.expression.accept(self)
+        }
+
+        func visit(_ node: InterpolatedStringExpression) -> Bool {
+            node.parts.allSatisfy { part in
+                if case .interpolation(let inner) = part {
+                    return inner.accept(self)
+                }
+                return true
+            }
+        }
+    }
+
     // MARK: - Literal Evaluation
 
     private func evaluateLiteral(_ literal: LiteralValue) -> any Sendable {
@@ -174,8 +341,21 @@ public struct ExpressionEvaluator: Sendable {
     private func evaluateBinary(_ expr: BinaryExpression, context: ExecutionContext) async throws -> any Sendable {
         let left = try await evaluate(expr.left, context: context)
         let right = try await evaluate(expr.right, context: context)
+        return try applyBinary(expr.op, left, right)
+    }
+
+    /// Internal so `BreakpointCondition` compares with the same semantics
+    func applyBinary(_ op: BinaryOperator, _ left: any Sendable, _ right: any Sendable) throws -> any Sendable {
+        // Int and Double operands first: the common case in loops and
+        // conditions, without the String and date checks below
+        if let l = left as? Int, let r = right as? Int, let result = Self.intFastPath(op, l, r) {
+            return result
+        }
+        if let l = left as? Double, let r = right as? Double, let result = Self.doubleFastPath(op, l, r) {
+            return result
+        }
 
-        switch expr.op {
+        switch op {
         // Arithmetic operators
         case .add:
             return try numericOperation(left, right) { $0 + $1 }
@@ -242,8 +422,11 @@ public struct ExpressionEvaluator: Sendable {
 
     private func evaluateUnary(_ expr: UnaryExpression, context: ExecutionContext) async throws -> any Sendable {
         let operand = try await evaluate(expr.operand, context: context)
+        return try applyUnary(expr.op, operand)
+    }
 
-        switch expr.op {
+    private func applyUnary(_ op: UnaryOperator, _ operand: any Sendable) throws -> any Sendable {
+        switch op {
         case .negate:
             if let i = operand as? Int { return -i }
             if let d = operand as? Double { return -d }
@@ -257,24 +440,27 @@ public struct ExpressionEvaluator: Sendable {
 
     private func evaluateMemberAccess(_ expr: MemberAccessExpression, context: ExecutionContext) async throws -> any Sendable {
         let base = try await evaluate(expr.base, context: context)
+        return try applyMemberAccess(expr.member, on: base)
+    }
 
+    private func applyMemberAccess(_ member: String, on base: any Sendable) throws -> any Sendable {
         // Handle dictionary access
         if let dict = base as? [String: any Sendable] {
-            if let value = dict[expr.member] {
+            if let value = dict[member] {
                 return value
             }
-            throw ExpressionError.undefinedMember(expr.member)
+            throw ExpressionError.undefinedMember(member)
         }
 
         // Handle key-value pairs with AnySendable
         if let dict = base as? [String: AnySendable] {
-            if let value = dict[expr.member] {
+            if let value = dict[member] {
                 return value
             }
-            throw ExpressionError.undefinedMember(expr.member)
+            throw ExpressionError.undefinedMember(member)
         }
 
-        throw ExpressionError.typeMismatch("Cannot access member '\(expr.member)' on \(type(of: base))")
+        throw ExpressionError.typeMismatch("Cannot access member '\(member)' on \(type(of: base))")
     }
 
     // MARK: - Subscript Evaluation
@@ -282,7 +468,10 @@ public struct ExpressionEvaluator: Sendable {
     private func evaluateSubscript(_ expr: SubscriptExpression, context: ExecutionContext) async throws -> any Sendable {
         let base = try await evaluate(expr.base, context: context)
         let index = try await evaluate(expr.index, context: context)
+        return try applySubscript(base, index)
+    }
 
+    private func applySubscript(_ base: any Sendable, _ index: any Sendable) throws -> any Sendable {
         // Array subscript (0 = most recent element)
         if let array = base as? [any Sendable], let i = index as? Int {
             guard i >= 0 && i < array.count else {
@@ -389,6 +578,51 @@ public struct ExpressionEvaluator: Sendable {
         throw ExpressionError.typeMismatch("Cannot access property '\(property)' on \(type(of: value))")
     }
 
+    // MARK: - Numeric Fast Paths
+
+    /// Largest magnitude at which every Int is exactly representable as a
+    /// Double. Within it, Int arithmetic and comparison give the same
+    /// answer as the Double-based generic paths.
+    private static let exactDoubleLimit: UInt = 1 << 53
+
+    /// Int ⊕ Int without boxing through Double, or nil to take the
+    /// generic path (division, modulo, `is`, large or overflowing values)
+    private static func intFastPath(_ op: BinaryOperator, _ l: Int, _ r: Int) -> (any Sendable)? {
+        guard l.magnitude <= exactDoubleLimit, r.magnitude <= exactDoubleLimit else { return nil }
+        let result: (partialValue: Int, overflow: Bool)
+        switch op {
+        case .add: result = l.addingReportingOverflow(r)
+        case .subtract: result = l.subtractingReportingOverflow(r)
+        case .multiply: result = l.multipliedReportingOverflow(by: r)
+        case .equal: return l == r
+        case .notEqual: return l != r
+        case .lessThan: return l < r
+        case .greaterThan: return l > r
+        case .lessEqual: return l <= r
+        case .greaterEqual: return l >= r
+        default: return nil
+        }
+        guard !result.overflow, result.partialValue.magnitude <= exactDoubleLimit else { return nil }
+        return result.partialValue
+    }
+
+    /// Double ⊕ Double, or nil to take the generic path
+    private static func doubleFastPath(_ op: BinaryOperator, _ l: Double, _ r: Double) -> (any Sendable)? {
+        switch op {
+        case .add: return l + r
+        case .subtract: return l - r
+        case .multiply: return l * r
+        case .divide: return l / r
+        case .equal: return l == r
+        case .notEqual: return l != r
+        case .lessThan: return l < r
+        case .greaterThan: return l > r
+        case .lessEqual: return l <= r
+        case .greaterEqual: return l >= r
+        default: return nil
+        }
+    }
+
     private func numericOperation(_ left: any Sendable, _ right: any Sendable, _ op: (Double, Double) -> Double) throws -> any Sendable {
         let l = try asDouble(left)
         let r = try asDouble(right)
@@ -439,7 +673,8 @@ public struct ExpressionEvaluator: Sendable {
         throw ExpressionError.typeMismatch("Cannot convert \(type(of: value)) to number")
     }
 
-    private func asBool(_ value: any Sendable) -> Bool {
+    /// Truthiness for `!`, `&&` and `||`, also used by conditional breakpoints
+    func asBool(_ value: any Sendable) -> Bool {
         if let b = value as? Bool { return b }
         if let i = value as? Int { return i != 0 }
         if let s = value as? String { return !s.isEmpty }
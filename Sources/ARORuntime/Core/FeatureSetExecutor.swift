@@ -7,10 +7,14 @@
 // ------------------------------------
 // The executor supports two modes:
 // 1. Sequential (default): Statements execute one after another
-// 2. Optimized: I/O operations run in parallel based on data dependencies
+// 2. Parallel statements (`ARO_PARALLEL_STATEMENTS=1`): runs of adjacent,
+//    independent I/O statements found by the analyzer's
+//    `StatementDependencyGraph` execute concurrently
 //
-// The optimized mode maintains sequential semantics from the programmer's
-// perspective while overlapping I/O operations under the hood.
+// The parallel mode maintains sequential semantics from the programmer's
+// perspective while overlapping I/O operations under the hood: every
+// side-effecting statement is a barrier, and results are bound in
+// source order.
 
 import Foundation
 import AROParser
@@ -23,10 +27,10 @@ import AROParser
 /// Statements execute sequentially by source order, but action results
 /// are produced lazily under the lazy-handle model (issue #55): each
 /// non-effectful action returns an AROFuture that the next consumer
-/// transparently forces. This subsumes the older `enableParallelIO`
-/// data-flow scheduler — independent I/O calls overlap automatically
-/// when their futures are forced by downstream consumers, with no need
-/// for a separate DAG-builder.
+/// transparently forces. In compiled binaries independent I/O calls
+/// overlap when their futures are forced by downstream consumers; the
+/// interpreter's opt-in parallel mode gets the same effect from the
+/// analyzer's `StatementDependencyGraph`.
 public final class FeatureSetExecutor: Sendable {
     // MARK: - Properties
 
@@ -47,16 +51,31 @@ public final class FeatureSetExecutor: Sendable {
     private let responseVerbs: Set<String>
     private let serverVerbs: Set<String>
 
+    /// Run independent I/O statements concurrently (see `StatementDependencyGraph`)
+    private let parallelizesStatements: Bool
+
+    /// Read once from `ARO_PARALLEL_STATEMENTS`.
+    public static let parallelStatementsDefault: Bool = {
+        switch ProcessInfo.processInfo.environment["ARO_PARALLEL_STATEMENTS"]?.lowercased() {
+        case "1", "true", "yes", "on":
+            return true
+        default:
+            return false
+        }
+    }()
+
     // MARK: - Initialization
 
     public init(
         actionRegistry: ActionRegistry,
         eventBus: EventBus,
-        globalSymbols: GlobalSymbolStorage
+        globalSymbols: GlobalSymbolStorage,
+        parallelizesStatements: Bool = FeatureSetExecutor.parallelStatementsDefault
     ) {
         self.actionRegistry = actionRegistry
         self.eventBus = eventBus
         self.globalSymbols = globalSymbols
+        self.parallelizesStatements = parallelizesStatements
         self.expressionEvaluator = ExpressionEvaluator()
         self.testVerbs = VerbSets.testVerbs
         self.requestVerbs = VerbSets.requestVerbs
@@ -91,18 +110,16 @@ public final class FeatureSetExecutor: Sendable {
             || featureSet.name.hasPrefix("Application-End")
 
         // Emit start event
-        eventBus.publish(FeatureSetStartedEvent(
+        eventBus.publish(ifObserved: FeatureSetStartedEvent(
             featureSetName: featureSet.name,
             businessActivity: featureSet.businessActivity,
             executionId: context.executionId
         ))
 
-        // Bind external dependencies from global symbols in a
-        // single actor hop instead of three per dependency
-        // (`isAccessDenied`, `businessActivity`, `resolveAny`).
-        // For a feature set with N published-symbol dependencies
-        // this saves 2N actor turns of overhead (#332).
-        let resolutions = await globalSymbols.resolveDependencies(
+        // Bind external dependencies from global symbols against a
+        // single snapshot instead of three lookups per dependency
+        // (`isAccessDenied`, `businessActivity`, `resolveAny`) (#332).
+        let resolutions = globalSymbols.resolveDependencies(
             analyzedFeatureSet.dependencies,
             forBusinessActivity: context.businessActivity
         )
@@ -123,7 +140,7 @@ public final class FeatureSetExecutor: Sendable {
 
         // Also eagerly bind all other published variables for this business activity
         // This handles cases where semantic analyzer misses dependencies in map literals
-        for (name, entry) in await globalSymbols.allSymbols() {
+        for (name, entry) in globalSymbols.allSymbols() {
             // Skip if already bound
             if context.resolveAny(name) != nil {
                 continue
@@ -155,13 +172,26 @@ public final class FeatureSetExecutor: Sendable {
             context.bind("terminal", value: terminalDict, allowRebind: true)
         }
 
-        // Execute statements sequentially by source order. Independent I/O
-        // overlaps automatically: non-effectful actions return AROFutures
-        // that the next consumer forces, so the runtime parallelises at
-        // the action level without a separate scheduler.
+        // Execute statements by source order. In parallel mode, the
+        // analyzer's batches of independent I/O statements run together.
+        // Stepping through a debugger keeps the sequential order.
+        let statements = featureSet.statements
+        let batches = parallelizesStatements && Debug.controller == nil
+            ? analyzedFeatureSet.dependencyGraph.parallelBatches
+            : []
         do {
-            for statement in featureSet.statements {
-                try await executeStatement(statement, context: context)
+            var index = 0
+            var nextBatch = 0
+            while index < statements.count {
+                if nextBatch < batches.count, batches[nextBatch].lowerBound == index {
+                    let batch = batches[nextBatch]
+                    try await executeBatch(batch, of: analyzedFeatureSet, context: context)
+                    index = batch.upperBound
+                    nextBatch += 1
+                } else {
+                    try await executeStatement(statements[index], context: context)
+                    index += 1
+                }
 
                 // Check if we have a response (Return was called)
                 if context.getResponse() != nil {
@@ -173,7 +203,7 @@ public final class FeatureSetExecutor: Sendable {
             if let response = context.getResponse() {
                 let duration = Date().timeIntervalSince(startTime) * 1000
 
-                eventBus.publish(FeatureSetCompletedEvent(
+                eventBus.publish(ifObserved: FeatureSetCompletedEvent(
                     featureSetName: featureSet.name,
                     businessActivity: featureSet.businessActivity,
                     executionId: context.executionId,
@@ -182,7 +212,7 @@ public final class FeatureSetExecutor: Sendable {
                 ))
 
                 if !isLifecycleFeatureSet {
-                    await globalSymbols.evict(executionId: context.executionId)
+                    globalSymbols.evict(executionId: context.executionId)
                 }
 
                 return response
@@ -191,7 +221,7 @@ public final class FeatureSetExecutor: Sendable {
             // No explicit return - create default response
             let duration = Date().timeIntervalSince(startTime) * 1000
 
-            eventBus.publish(FeatureSetCompletedEvent(
+            eventBus.publish(ifObserved: FeatureSetCompletedEvent(
                 featureSetName: featureSet.name,
                 businessActivity: featureSet.businessActivity,
                 executionId: context.executionId,
@@ -200,7 +230,7 @@ public final class FeatureSetExecutor: Sendable {
             ))
 
             if !isLifecycleFeatureSet {
-                await globalSymbols.evict(executionId: context.executionId)
+                globalSymbols.evict(executionId: context.executionId)
             }
 
             return Response.ok()
@@ -208,7 +238,7 @@ public final class FeatureSetExecutor: Sendable {
         } catch {
             let duration = Date().timeIntervalSince(startTime) * 1000
 
-            eventBus.publish(FeatureSetCompletedEvent(
+            eventBus.publish(ifObserved: FeatureSetCompletedEvent(
                 featureSetName: featureSet.name,
                 businessActivity: featureSet.businessActivity,
                 executionId: context.executionId,
@@ -217,7 +247,7 @@ public final class FeatureSetExecutor: Sendable {
             ))
 
             if !isLifecycleFeatureSet {
-                await globalSymbols.evict(executionId: context.executionId)
+                globalSymbols.evict(executionId: context.executionId)
             }
 
             throw error
@@ -232,8 +262,10 @@ public final class FeatureSetExecutor: Sendable {
     ) async throws {
         // Issue #229 Phase 1: statement-boundary debug hook.
         // Cheap fast-path: TaskLocal pointer load + nil check when no
-        // debugger is attached.
-        if let controller = Debug.controller {
+        // debugger is attached, and one atomic load when an attached
+        // debugger cannot pause here (see DebugStopGate).
+        if let controller = Debug.controller,
+           controller.stopGate.mayStop(at: statement, sourceFile: Debug.currentSourceFile) {
             let symbols = await Self.snapshotSymbols(from: context)
             try await controller.checkpoint(
                 statement: statement,
@@ -299,6 +331,116 @@ public final class FeatureSetExecutor: Sendable {
         }
     }
 
+    /// Run one of the dependency graph's batches. The graph batches Call
+    /// and Invoke by verb; a call to a method its service does not declare
+    /// read-only may have side effects, so it runs on its own at its place
+    /// in the batch and only the statements between such calls overlap.
+    private func executeBatch(
+        _ batch: Range<Int>,
+        of featureSet: AnalyzedFeatureSet,
+        context: ExecutionContext
+    ) async throws {
+        let statements = featureSet.featureSet.statements
+        var runs: [[Int]] = []
+        var run: [Int] = []
+        for index in batch {
+            if Self.mayOverlap(statements[index], context: context) {
+                run.append(index)
+            } else {
+                if !run.isEmpty { runs.append(run) }
+                runs.append([index])
+                run = []
+            }
+        }
+        if !run.isEmpty { runs.append(run) }
+
+        for run in runs {
+            if run.count == 1 {
+                try await executeStatement(statements[run[0]], context: context)
+            } else {
+                try await executeConcurrently(run.map { statements[$0] }, context: context)
+            }
+        }
+    }
+
+    /// False for a Call/Invoke unless its service declares the method read-only
+    private static func mayOverlap(_ statement: Statement, context: ExecutionContext) -> Bool {
+        guard let aro = statement as? AROStatement,
+              CallAction.verbs.contains(aro.action.verb.lowercased()) else {
+            return true
+        }
+        guard let target = CallAction.serviceAndMethod(
+            base: aro.object.noun.base,
+            specifiers: aro.object.noun.specifiers
+        ) else {
+            return false
+        }
+        return context.container.externalServices.isReadOnly(target.service, method: target.method)
+    }
+
+    /// Run independent statements concurrently, each in its own child
+    /// context so their statement-scoped bindings (`_expression_`, `_with_`,
+    /// ...) can't collide, then bind everything each one bound (not only
+    /// its declared result) into `context` in source order. The first
+    /// statement to fail cancels the rest of the batch, since it would
+    /// have stopped the feature set sequentially.
+    /// Its error is rethrown once the batch has stopped, and the outputs
+    /// of the statements before it that completed are still bound.
+    private func executeConcurrently(
+        _ statements: [Statement],
+        context: ExecutionContext
+    ) async throws {
+        let children = statements.map { _ in context.createChild(featureSetName: context.featureSetName) }
+        var completed = [Bool](repeating: false, count: statements.count)
+        var failure: (index: Int, error: Error)?
+        await withTaskGroup(of: (Int, Error?).self) { group in
+            for (index, statement) in statements.enumerated() {
+                let child = children[index]
+                group.addTask {
+                    do {
+                        try await self.executeStatement(statement, context: child)
+                        return (index, nil)
+                    } catch {
+                        return (index, error)
+                    }
+                }
+            }
+            for await (index, error) in group {
+                if let error {
+                    // Errors after the first are most likely the
+                    // cancellation itself
+                    if failure == nil {
+                        failure = (index, error)
+                        group.cancelAll()
+                    }
+                } else {
+                    completed[index] = true
+                }
+            }
+        }
+
+        let parent = context as? RuntimeContext
+        for (index, child) in children.enumerated() where completed[index] {
+            if let failure, index > failure.index { break }
+            guard let child = child as? RuntimeContext else { continue }
+            let verb = (statements[index] as? AROStatement)?.action.verb.lowercased() ?? ""
+            let allowRebind = Self.rebindingVerbs.contains(verb)
+            for name in child.localVariableNames where !Self.statementTransients.contains(name) {
+                guard let value = child.resolveAnyRaw(name) else { continue }
+                // Same rule as the sequential bind: keep an existing local
+                // binding unless the statement was allowed to replace it.
+                // Framework (`_`-prefixed) bindings are always replaced.
+                let existsLocally = parent?.existsLocally(name) ?? context.exists(name)
+                if allowRebind || name.hasPrefix("_") || !existsLocally {
+                    context.bind(name, value: value, allowRebind: allowRebind)
+                }
+            }
+        }
+        if let failure {
+            throw failure.error
+        }
+    }
+
     /// Build a `SymbolSnapshot` array from the visible bindings on a
     /// context. Values are previewed with truncation so the TUI / DAP
     /// frontend can print them safely. Internal underscore-prefixed
@@ -427,21 +569,10 @@ public final class FeatureSetExecutor: Sendable {
     ) async throws {
         // Clear transient bindings from previous statements
         // These are statement-local and should not persist between statements
-        context.unbind("_literal_")
-        context.unbind("_expression_")
+        for name in Self.statementTransients {
+            context.unbind(name)
+        }
         context.bind("_expression_name_", value: "")  // bind empty to shadow any parent binding
-        context.unbind("_result_expression_")
-        context.unbind("_aggregation_type_")
-        context.unbind("_aggregation_field_")
-        context.unbind("_where_field_")
-        context.unbind("_where_op_")
-        context.unbind("_where_value_")
-        context.unbind("_by_pattern_")
-        context.unbind("_by_flags_")
-        context.unbind("_by_field_")
-        context.unbind("_default_value_")
-        context.unbind("_to_")
-        context.unbind("_with_")
 
         // ARO-0004: Evaluate when condition before processing statement
         // If condition is present and evaluates to false, skip this statement entirely
@@ -624,19 +755,7 @@ public final class FeatureSetExecutor: Sendable {
                 // Check if this is a rebinding action (accept, update, delete, merge, etc.)
                 // Also include REQUEST actions (retrieve, fetch, etc.) since they always get fresh data
                 // and should override parent context values (fixes event handler variable shadowing)
-                let rebindingVerbs: Set<String> = [
-                    "accept", "update", "modify", "change", "set", "configure",
-                    "delete", "remove", "destroy", "clear", "show",
-                    "merge", "combine", "join", "concat"
-                ]
-                let requestVerbs: Set<String> = [
-                    "retrieve", "fetch", "load", "find", "extract", "parse", "get",
-                    "request", "probe", "receive", "read"
-                ]
-                // #316: lowercase once, not twice.
-                let lowerVerb = verb.lowercased()
-                let allowRebind = rebindingVerbs.contains(lowerVerb) ||
-                                  requestVerbs.contains(lowerVerb)
+                let allowRebind = Self.rebindingVerbs.contains(verb.lowercased())
 
                 // Only bind if variable doesn't exist LOCALLY or if this is a rebinding/request action.
                 // We check existsLocally (not exists) so event handlers can create local shadow
@@ -673,6 +792,27 @@ public final class FeatureSetExecutor: Sendable {
         }
     }
 
+    /// Statement-local bindings, cleared before every statement and never
+    /// copied out of a concurrent statement's child context
+    private static let statementTransients: Set<String> = [
+        "_literal_", "_expression_", "_expression_name_", "_result_expression_",
+        "_aggregation_type_", "_aggregation_field_",
+        "_where_field_", "_where_op_", "_where_value_",
+        "_by_pattern_", "_by_flags_", "_by_field_",
+        "_default_value_", "_to_", "_with_"
+    ]
+
+    /// Verbs whose result replaces an existing local binding: rebinding
+    /// actions (accept, update, delete, merge, ...) and request actions,
+    /// which always get fresh data
+    private static let rebindingVerbs: Set<String> = [
+        "accept", "update", "modify", "change", "set", "configure",
+        "delete", "remove", "destroy", "clear", "show",
+        "merge", "combine", "join", "concat",
+        "retrieve", "fetch", "load", "find", "extract", "parse", "get",
+        "request", "probe", "receive", "read"
+    ]
+
     /// Gather resolved variable values for error context
     private func gatherResolvedValues(
         for statement: AROStatement,
@@ -719,7 +859,7 @@ public final class FeatureSetExecutor: Sendable {
         }
 
         // Publish to global symbols with business activity and execution owner
-        await globalSymbols.publish(
+        globalSymbols.publish(
             name: statement.externalName,
             value: value,
             fromFeatureSet: context.featureSetName,
@@ -931,7 +1071,7 @@ public final class FeatureSetExecutor: Sendable {
             }
         case .featureSet(let name):
             // Cross-feature-set dependency - resolve from global symbols (with business activity validation)
-            if let value = await globalSymbols.resolveAny(statement.variableName, forBusinessActivity: context.businessActivity) {
+            if let value = globalSymbols.resolveAny(statement.variableName, forBusinessActivity: context.businessActivity) {
                 context.bind(statement.variableName, value: value)
             }
             // If not found, the dependency might be provided later
@@ -965,14 +1105,7 @@ public final class FeatureSetExecutor: Sendable {
     // MARK: - Range Loop Execution (ARO-0072)
 
     private func executeRangeLoop(_ loop: RangeLoop, context: ExecutionContext) async throws {
-        let fromVal = try await expressionEvaluator.evaluate(loop.from, context: context)
-        let toVal   = try await expressionEvaluator.evaluate(loop.to,   context: context)
-
-        guard let fromInt = toInt(fromVal), let toInt = toInt(toVal) else {
-            throw ActionError.typeMismatch(expected: "Int", actual: "\(type(of: fromVal))", variable: "range bounds")
-        }
-
-        for i in fromInt..<toInt {
+        for i in try await rangeBounds(loop, context: context) {
             let iterationContext = context.createChild(featureSetName: context.featureSetName)
             iterationContext.bind(loop.variable, value: i)
             for stmt in loop.body {
@@ -982,6 +1115,17 @@ public final class FeatureSetExecutor: Sendable {
         }
     }
 
+    /// Evaluate the loop bounds; an upper bound below the lower one is an empty range
+    private func rangeBounds(_ loop: RangeLoop, context: ExecutionContext) async throws -> Range<Int> {
+        let fromVal = try await expressionEvaluator.evaluate(loop.from, context: context)
+        let toVal   = try await expressionEvaluator.evaluate(loop.to,   context: context)
+
+        guard let fromInt = toInt(fromVal), let toInt = toInt(toVal) else {
+            throw ActionError.typeMismatch(expected: "Int", actual: "\(type(of: fromVal))", variable: "range bounds")
+        }
+        return fromInt..<max(fromInt, toInt)
+    }
+
     private func toInt(_ value: any Sendable) -> Int? {
         if let i = value as? Int    { return i }
         if let d = value as? Double { return Int(d) }
@@ -991,10 +1135,16 @@ public final class FeatureSetExecutor: Sendable {
 
     // MARK: - For-Each Loop Execution (ARO-0005)
 
-    private func executeForEachLoop(
+    /// What a for-each loop iterates: a lazy stream or materialized items
+    private enum ForEachSource {
+        case stream(AROStream<any Sendable>)
+        case items([any Sendable])
+    }
+
+    private func forEachSource(
         _ loop: ForEachLoop,
         context: ExecutionContext
-    ) async throws {
+    ) async throws -> ForEachSource {
         // Resolve the collection (with specifier support for property access)
         guard var collectionValue: any Sendable = context.resolveAny(loop.collection.base) else {
             throw ActionError.undefinedVariable(loop.collection.base)
@@ -1003,8 +1153,7 @@ public final class FeatureSetExecutor: Sendable {
         // Lazy stream path: iterate without materialising the collection into memory (ARO-0051).
         // Specifiers are not supported on streams — they require an in-memory value.
         if let anyStream = collectionValue as? AnyStreamingValue, loop.collection.specifiers.isEmpty {
-            try await executeForEachLazy(loop, stream: anyStream.asStream(), context: context)
-            return
+            return .stream(anyStream.asStream())
         }
 
         // Handle specifiers as property access (e.g., <team: members> -> team.members)
@@ -1015,26 +1164,38 @@ public final class FeatureSetExecutor: Sendable {
         // ARO-0051: Streaming support — iterate lazy streams without materializing
         if let anyStreaming = collectionValue as? AnyStreamingValue, !anyStreaming.isMaterialized {
             if !loop.isParallel {
-                try await executeForEachLazy(loop, stream: anyStreaming.asStream(), context: context)
-                return
+                return .stream(anyStreaming.asStream())
             }
             // Parallel loops must materialize (no streaming support for concurrent iteration)
             collectionValue = try await anyStreaming.materialize() as any Sendable
         }
 
         // Convert to array
-        let items: [any Sendable]
         if let array = collectionValue as? [any Sendable] {
-            items = array
+            return .items(array)
         } else if let array = collectionValue as? [String] {
-            items = array
+            return .items(array)
         } else if let array = collectionValue as? [Int] {
-            items = array
+            return .items(array)
         } else if let array = collectionValue as? [Double] {
-            items = array
+            return .items(array)
         } else {
             // Single item
-            items = [collectionValue]
+            return .items([collectionValue])
+        }
+    }
+
+    private func executeForEachLoop(
+        _ loop: ForEachLoop,
+        context: ExecutionContext
+    ) async throws {
+        let items: [any Sendable]
+        switch try await forEachSource(loop, context: context) {
+        case .stream(let stream):
+            try await executeForEachLazy(loop, stream: stream, context: context)
+            return
+        case .items(let resolved):
+            items = resolved
         }
 
         // Execute loop body for each item
@@ -1209,9 +1370,7 @@ public final class Runtime: @unchecked Sendable {
     public let eventBus: EventBus
     /// Global symbols for sharing between feature sets (public for HTTP handlers)
     public var globalSymbols: GlobalSymbolStorage {
-        get async {
-            return await engine.sharedGlobalSymbols
-        }
+        return engine.sharedGlobalSymbols
     }
     private var _isRunning: Bool = false
     private var _currentProgram: AnalyzedProgram?
@@ -1296,7 +1455,7 @@ public final class Runtime: @unchecked Sendable {
             // We just need to store it in globalSymbols for cross-feature-set access
             // Note: In interpreter mode, FeatureSetExecutor handles this directly,
             // but in binary mode we need to catch the event
-            let globalSymbols = await self.globalSymbols
+            let globalSymbols = self.globalSymbols
             // We don't have access to the actual value or business activity from the event
             // This is a limitation of the current event structure
             // For now, this subscription serves as documentation of the intended behavior
@@ -34,4 +34,17 @@ public enum RuntimeDefaults {
     /// BoundedSet's eviction is amortised O(1) so the cost is
     /// purely the memory budget.
     public static let visitedURLStoreMaxSize: Int = 100_000
+
+    /// Maximum number of responses kept by the shared outbound HTTP
+    /// cache (`HTTPResponseCache`). Override with
+    /// `ARO_HTTP_CACHE_ENTRIES`.
+    public static let httpCacheMaxEntries: Int = 1_024
+
+    /// Responses with larger bodies bypass the outbound HTTP cache.
+    /// Override with `ARO_HTTP_CACHE_MAX_BODY`.
+    public static let httpCacheMaxBodyBytes: Int = 1 * 1024 * 1024
+
+    /// Connections the outbound HTTP clients keep per upstream host.
+    /// Override with `ARO_HTTP_MAX_CONNECTIONS_PER_HOST`.
+    public static let httpMaxConnectionsPerHost: Int = 8
 }
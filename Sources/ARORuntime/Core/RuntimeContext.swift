@@ -424,6 +424,12 @@ public actor RuntimeContext: ExecutionContext {
         return variables[name] != nil
     }
 
+    /// Names bound in THIS context only (ignoring parent contexts).
+    /// Used by FeatureSetExecutor to copy a concurrent statement's bindings back.
+    public nonisolated var localVariableNames: Set<String> {
+        return Set(variables.keys)
+    }
+
     public nonisolated var variableNames: Set<String> {
         var names = Set(variables.keys)
         if let parentNames = parent?.variableNames {
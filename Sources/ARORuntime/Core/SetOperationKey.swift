@@ -0,0 +1,194 @@
+// ============================================================
+// SetOperationKey.swift
+// ARO Runtime - Hash keys for Compute set operations
+// ============================================================
+//
+// Set operations (`Compute ... intersect / difference / union`) treat
+// two elements as the same when their rendered keys are equal: sorted
+// `key:value` text for dictionaries, bracketed comma-joined text for
+// lists and `String(describing:)` for everything else. So the string
+// "1" matches the integer 1, and ["a,b"] matches ["a", "b"].
+//
+// The key used to be that rendered string, built recursively with a
+// joined string at every level. Now the rendering is never built: the
+// value is walked once and the bytes the rendering would contain are fed
+// straight into a `Hasher`. Integers are written as digits into a stack
+// buffer and dictionary entries are ordered through a stack-allocated
+// index buffer, so the common shapes hash without a heap allocation.
+// Strings are hashed in normalized form (NFC), matching String's
+// canonical equality; only strings with characters at or above U+0300
+// need a normalized copy. Doubles and uncommon types still hash their
+// description, which for doubles almost always fits an inline small
+// string.
+//
+// Equality is decided when two digests match. Values of the same shape
+// are compared directly; the rendering is built only when that does not
+// settle it, i.e. for values that merely render alike, or a collision.
+
+import Foundation
+
+/// A runtime value keyed by its rendered text for set operations.
+struct SetOperationKey: Hashable, Sendable {
+    let value: any Sendable
+    private let digest: Int
+
+    init(_ value: any Sendable) {
+        self.value = value
+        var hasher = Hasher()
+        Self.feed(value, into: &hasher)
+        self.digest = hasher.finalize()
+    }
+
+    func hash(into hasher: inout Hasher) {
+        hasher.combine(digest)
+    }
+
+    static func == (lhs: SetOperationKey, rhs: SetOperationKey) -> Bool {
+        guard lhs.digest == rhs.digest else { return false }
+        return knownEqual(lhs.value, rhs.value) || rendering(of: lhs.value) == rendering(of: rhs.value)
+    }
+
+    // MARK: - Hashing
+
+    /// Feed the bytes of `value`'s rendering, without building it
+    private static func feed(_ value: any Sendable, into hasher: inout Hasher) {
+        if let dict = value as? [String: any Sendable] {
+            hasher.combine(UInt8(ascii: "{"))
+            withUnsafeTemporaryAllocation(of: Dictionary<String, any Sendable>.Index.self, capacity: dict.count) { order in
+                _ = order.initialize(from: dict.indices)
+                defer { order.deinitialize() }
+                order.sort { dict[$0].key < dict[$1].key }
+                for (position, index) in order.enumerated() {
+                    if position > 0 { hasher.combine(UInt8(ascii: ",")) }
+                    let (key, element) = dict[index]
+                    feed(key, into: &hasher)
+                    hasher.combine(UInt8(ascii: ":"))
+                    feed(element, into: &hasher)
+                }
+            }
+            hasher.combine(UInt8(ascii: "}"))
+        } else if let array = value as? [any Sendable] {
+            hasher.combine(UInt8(ascii: "["))
+            for (position, element) in array.enumerated() {
+                if position > 0 { hasher.combine(UInt8(ascii: ",")) }
+                feed(element, into: &hasher)
+            }
+            hasher.combine(UInt8(ascii: "]"))
+        } else if let string = value as? String {
+            feed(string, into: &hasher)
+        } else if let int = value as? Int {
+            feed(int, into: &hasher)
+        } else {
+            feed(String(describing: value), into: &hasher)
+        }
+    }
+
+    /// Feed a string's UTF-8 in NFC. Text below U+0300 (UTF-8 bytes below
+    /// 0xCC) is already normalized and is hashed in place.
+    private static func feed(_ string: String, into hasher: inout Hasher) {
+        let hashedInPlace = string.utf8.withContiguousStorageIfAvailable { bytes -> Bool in
+            guard !bytes.contains(where: { $0 >= 0xCC }) else { return false }
+            hasher.combine(bytes: UnsafeRawBufferPointer(bytes))
+            return true
+        }
+        if hashedInPlace == true { return }
+
+        let normalized = string.utf8.contains(where: { $0 >= 0xCC })
+            ? string.precomposedStringWithCanonicalMapping
+            : string
+        for byte in normalized.utf8 {
+            hasher.combine(byte)
+        }
+    }
+
+    /// Feed the decimal digits of `int`
+    private static func feed(_ int: Int, into hasher: inout Hasher) {
+        if int < 0 { hasher.combine(UInt8(ascii: "-")) }
+        withUnsafeTemporaryAllocation(of: UInt8.self, capacity: 20) { digits in
+            var magnitude = int.magnitude
+            var start = digits.count
+            repeat {
+                start -= 1
+                digits[start] = UInt8(ascii: "0") + UInt8(magnitude % 10)
+                magnitude /= 10
+            } while magnitude > 0
+            hasher.combine(bytes: UnsafeRawBufferPointer(rebasing: digits[start...]))
+        }
+    }
+
+    // MARK: - Equality
+
+    /// True when `lhs` and `rhs` have the same shape and therefore the
+    /// same rendering. False means "not settled", not "different".
+    private static func knownEqual(_ lhs: any Sendable, _ rhs: any Sendable) -> Bool {
+        if let a = lhs as? [String: any Sendable] {
+            guard let b = rhs as? [String: any Sendable], a.count == b.count else { return false }
+            for (key, x) in a {
+                guard let y = b[key], knownEqual(x, y) else { return false }
+            }
+            return true
+        }
+        if let a = lhs as? [any Sendable] {
+            guard let b = rhs as? [any Sendable], a.count == b.count else { return false }
+            for (x, y) in zip(a, b) where !knownEqual(x, y) {
+                return false
+            }
+            return true
+        }
+        if let a = lhs as? String {
+            return (rhs as? String) == a
+        }
+        if let a = lhs as? Int {
+            return (rhs as? Int) == a
+        }
+        if let a = lhs as? Bool {
+            return (rhs as? Bool) == a
+        }
+        if let a = lhs as? Double {
+            // Bit patterns, since 0.0 == -0.0 but they render differently
+            return (rhs as? Double)?.bitPattern == a.bitPattern
+        }
+        return false
+    }
+
+    /// The rendered key, built only when a digest match is not settled
+    /// by `knownEqual`
+    private static func rendering(of value: any Sendable) -> String {
+        if let string = value as? String {
+            return string
+        }
+        var text = ""
+        render(value, into: &text)
+        return text
+    }
+
+    private static func render(_ value: any Sendable, into text: inout String) {
+        if let dict = value as? [String: any Sendable] {
+            text.append("{")
+            var first = true
+            for key in dict.keys.sorted() {
+                if !first { text.append(",") }
+                first = false
+                text.append(key)
+                text.append(":")
+                render(dict[key]!, into: &text)
+            }
+            text.append("}")
+        } else if let array = value as? [any Sendable] {
+            text.append("[")
+            var first = true
+            for element in array {
+                if !first { text.append(",") }
+                first = false
+                render(element, into: &text)
+            }
+            text.append("]")
+        } else if let string = value as? String {
+            text.append(string)
+        } else if let int = value as? Int {
+            text.append(String(int))
+        } else {
+            text.append(String(describing: value))
+        }
+    }
+}
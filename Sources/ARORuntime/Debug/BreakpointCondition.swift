@@ -0,0 +1,399 @@
+// ============================================================
+// BreakpointCondition.swift
+// ARO Runtime - Compiled conditional breakpoint predicates
+// ============================================================
+//
+// Conditional breakpoints used to re-lex and re-parse their predicate
+// on every hit, and the snapshot fallback substituted values into the
+// source text and split it on `&` / `|`, so a value containing either
+// character changed the meaning of the predicate. A condition is now
+// parsed once, when the breakpoint is set, into a small typed tree:
+//
+//   b 5 if <user: id> == 530
+//   b 7 if <count> > 100 && <user: role> == "admin"
+//   b 9 if not (<users-repository: count> > 10 or <name> == 'a|b')
+//
+// Grammar, loosest first: `||` / `or`, `&&` / `and`, `!` / `not`, then
+// one comparison (`==` `!=` `<` `<=` `>` `>=`) or a bare operand tested
+// for truthiness. Operands are `<...>` variable references, quoted
+// strings ("..." or '...', backslash escapes), numbers, `true` and
+// `false`. References keep the full ARO semantics (qualifiers,
+// repository counts) because each one is parsed by `AROParser` and
+// resolved by `ExpressionEvaluator`; values are compared as values and
+// never re-enter the parser.
+
+import Foundation
+import AROParser
+
+/// A conditional breakpoint predicate that failed to parse.
+public struct BreakpointConditionError: Error, Equatable, CustomStringConvertible {
+    public let message: String
+    /// 1-based column in the condition source
+    public let column: Int
+
+    public var description: String {
+        "column \(column): \(message)"
+    }
+}
+
+/// A parsed conditional breakpoint predicate.
+public struct BreakpointCondition: Sendable, CustomStringConvertible {
+    public let source: String
+    let root: Node
+
+    indirect enum Node: Sendable {
+        case or(Node, Node)
+        case and(Node, Node)
+        case not(Node)
+        case compare(Operand, BinaryOperator, Operand)
+        case truthy(Operand)
+    }
+
+    enum Operand: Sendable {
+        case string(String)
+        case int(Int)
+        case double(Double)
+        case bool(Bool)
+        case reference(VariableRefExpression)
+    }
+
+    /// Parse `source`, throwing `BreakpointConditionError` with the
+    /// column of the first problem.
+    public init(_ source: String) throws {
+        var parser = ConditionParser(source)
+        self.source = source
+        self.root = try parser.parse()
+    }
+
+    /// Fully parenthesized form, showing how the condition was grouped
+    public var description: String {
+        Self.render(root)
+    }
+
+    // MARK: - Evaluation
+
+    /// Evaluate against a live context. A comparison or operand that
+    /// cannot be evaluated (unbound variable, type mismatch) is false,
+    /// so `<missing> == 1 || <n> > 0` still matches on `<n>`.
+    public func evaluate(context: ExecutionContext) async -> Bool {
+        let evaluator = ExpressionEvaluator()
+        return await evaluate(root) { ref in
+            try await evaluator.evaluate(ref, context: context)
+        }
+    }
+
+    /// Evaluate against snapshot previews, for checkpoints that have no
+    /// live context. References resolve by name to the preview, read back
+    /// as a Boolean or number when the symbol has that type.
+    func evaluate(symbols: [SymbolSnapshot]) async -> Bool {
+        await evaluate(root) { ref in
+            guard ref.noun.specifiers.isEmpty,
+                  let symbol = symbols.first(where: { $0.name == ref.noun.base }) else {
+                throw ExpressionError.undefinedVariable(ref.noun.base)
+            }
+            return Self.value(of: symbol)
+        }
+    }
+
+    private func evaluate(
+        _ node: Node,
+        resolve: (VariableRefExpression) async throws -> any Sendable
+    ) async -> Bool {
+        switch node {
+        case .or(let lhs, let rhs):
+            if await evaluate(lhs, resolve: resolve) { return true }
+            return await evaluate(rhs, resolve: resolve)
+        case .and(let lhs, let rhs):
+            guard await evaluate(lhs, resolve: resolve) else { return false }
+            return await evaluate(rhs, resolve: resolve)
+        case .not(let operand):
+            return await !evaluate(operand, resolve: resolve)
+        case .compare(let lhs, let op, let rhs):
+            guard let left = try? await value(of: lhs, resolve: resolve),
+                  let right = try? await value(of: rhs, resolve: resolve),
+                  let result = try? ExpressionEvaluator().applyBinary(op, left, right) as? Bool else {
+                return false
+            }
+            return result
+        case .truthy(let operand):
+            guard let value = try? await value(of: operand, resolve: resolve) else { return false }
+            return ExpressionEvaluator().asBool(value)
+        }
+    }
+
+    private func value(
+        of operand: Operand,
+        resolve: (VariableRefExpression) async throws -> any Sendable
+    ) async throws -> any Sendable {
+        switch operand {
+        case .string(let s): return s
+        case .int(let i): return i
+        case .double(let d): return d
+        case .bool(let b): return b
+        case .reference(let ref): return try await resolve(ref)
+        }
+    }
+
+    /// The snapshot preview as the value it renders, so a Boolean `false`
+    /// or Integer `0` stays falsy while the String "false" is truthy, as
+    /// it is in a live context
+    private static func value(of symbol: SymbolSnapshot) -> any Sendable {
+        let preview = symbol.valuePreview
+        switch symbol.typeName {
+        case "Boolean": if let b = Bool(preview) { return b }
+        case "Integer": if let i = Int(preview) { return i }
+        case "Float": if let d = Double(preview) { return d }
+        default: break
+        }
+        return preview
+    }
+
+    // MARK: - Rendering
+
+    private static func render(_ node: Node) -> String {
+        switch node {
+        case .or(let lhs, let rhs): return "(\(render(lhs)) || \(render(rhs)))"
+        case .and(let lhs, let rhs): return "(\(render(lhs)) && \(render(rhs)))"
+        case .not(let operand): return "!\(render(operand))"
+        case .compare(let lhs, let op, let rhs): return "(\(render(lhs)) \(op.rawValue) \(render(rhs)))"
+        case .truthy(let operand): return render(operand)
+        }
+    }
+
+    private static func render(_ operand: Operand) -> String {
+        switch operand {
+        case .string(let s):
+            let escaped = s.replacingOccurrences(of: "\\", with: "\\\\")
+                .replacingOccurrences(of: "\"", with: "\\\"")
+            return "\"\(escaped)\""
+        case .int(let i): return String(i)
+        case .double(let d): return String(d)
+        case .bool(let b): return String(b)
+        case .reference(let ref): return ref.description
+        }
+    }
+}
+
+// MARK: - Parser
+
+/// Recursive descent over the condition's characters. Tokens depend on
+/// position: `<` opens a reference where an operand is expected and is
+/// the less-than operator after one.
+private struct ConditionParser {
+    private typealias Node = BreakpointCondition.Node
+    private typealias Operand = BreakpointCondition.Operand
+
+    private let chars: [Character]
+    private var index = 0
+
+    init(_ source: String) {
+        self.chars = Array(source)
+    }
+
+    mutating func parse() throws -> Node {
+        skipWhitespace()
+        guard index < chars.count else {
+            throw error("empty condition")
+        }
+        let node = try parseOr()
+        skipWhitespace()
+        if index < chars.count {
+            throw error("unexpected '\(chars[index])'")
+        }
+        return node
+    }
+
+    private mutating func parseOr() throws -> Node {
+        var node = try parseAnd()
+        while consume("||") || consumeKeyword("or") {
+            node = .or(node, try parseAnd())
+        }
+        return node
+    }
+
+    private mutating func parseAnd() throws -> Node {
+        var node = try parseNot()
+        while consume("&&") || consumeKeyword("and") {
+            node = .and(node, try parseNot())
+        }
+        return node
+    }
+
+    private mutating func parseNot() throws -> Node {
+        skipWhitespace()
+        if peek("!") && !peek("!=") {
+            index += 1
+            return .not(try parseNot())
+        }
+        if consumeKeyword("not") {
+            return .not(try parseNot())
+        }
+        if consume("(") {
+            let node = try parseOr()
+            guard consume(")") else {
+                throw error("expected ')'")
+            }
+            return node
+        }
+        return try parseComparison()
+    }
+
+    private mutating func parseComparison() throws -> Node {
+        let lhs = try parseOperand()
+        skipWhitespace()
+        let op: BinaryOperator
+        if consume("==") {
+            op = .equal
+        } else if consume("!=") {
+            op = .notEqual
+        } else if consume("<=") {
+            op = .lessEqual
+        } else if consume(">=") {
+            op = .greaterEqual
+        } else if consume("<") {
+            op = .lessThan
+        } else if consume(">") {
+            op = .greaterThan
+        } else if peek("=") {
+            throw error("use '==' to compare")
+        } else {
+            return .truthy(lhs)
+        }
+        return .compare(lhs, op, try parseOperand())
+    }
+
+    private mutating func parseOperand() throws -> Operand {
+        skipWhitespace()
+        guard index < chars.count else {
+            throw error("expected a value")
+        }
+        let c = chars[index]
+        if c == "<" {
+            return try parseReference()
+        }
+        if c == "\"" || c == "'" {
+            return try parseString(quote: c)
+        }
+        if c.isNumber || (c == "-" && index + 1 < chars.count && chars[index + 1].isNumber) {
+            return try parseNumber()
+        }
+        if consumeKeyword("true") {
+            return .bool(true)
+        }
+        if consumeKeyword("false") {
+            return .bool(false)
+        }
+        if c.isLetter {
+            throw error("expected a value, found '\(word())' (quote strings)")
+        }
+        throw error("expected a value, found '\(c)'")
+    }
+
+    /// `<name: qualifiers>` up to the first `>`, parsed as ARO
+    private mutating func parseReference() throws -> Operand {
+        let start = index
+        guard let end = chars[start...].firstIndex(of: ">") else {
+            throw error("unterminated variable reference", at: start)
+        }
+        index = end + 1
+        let text = String(chars[start...end])
+        let diagnostics = DiagnosticCollector()
+        guard let tokens = try? Lexer(source: text, diagnostics: diagnostics).tokenize(),
+              let expression = try? Parser(tokens: tokens, diagnostics: diagnostics).parseExpression(),
+              let ref = expression as? VariableRefExpression,
+              !diagnostics.hasErrors else {
+            throw error("invalid variable reference \(text)", at: start)
+        }
+        return .reference(ref)
+    }
+
+    private mutating func parseString(quote: Character) throws -> Operand {
+        let start = index
+        index += 1
+        var value = ""
+        while index < chars.count {
+            let c = chars[index]
+            index += 1
+            if c == quote {
+                return .string(value)
+            }
+            guard c == "\\" else {
+                value.append(c)
+                continue
+            }
+            guard index < chars.count else { break }
+            let escaped = chars[index]
+            index += 1
+            switch escaped {
+            case "n": value.append("\n")
+            case "t": value.append("\t")
+            default: value.append(escaped)
+            }
+        }
+        throw error("unterminated string", at: start)
+    }
+
+    private mutating func parseNumber() throws -> Operand {
+        let start = index
+        if chars[index] == "-" { index += 1 }
+        while index < chars.count && (chars[index].isNumber || chars[index] == ".") {
+            index += 1
+        }
+        let text = String(chars[start..<index])
+        if let int = Int(text) {
+            return .int(int)
+        }
+        if let double = Double(text) {
+            return .double(double)
+        }
+        throw error("invalid number '\(text)'", at: start)
+    }
+
+    // MARK: - Scanning
+
+    private mutating func skipWhitespace() {
+        while index < chars.count && chars[index].isWhitespace {
+            index += 1
+        }
+    }
+
+    private func peek(_ text: String) -> Bool {
+        var i = index
+        for c in text {
+            guard i < chars.count, chars[i] == c else { return false }
+            i += 1
+        }
+        return true
+    }
+
+    private mutating func consume(_ text: String) -> Bool {
+        skipWhitespace()
+        guard peek(text) else { return false }
+        index += text.count
+        return true
+    }
+
+    /// Consume `keyword` only as a whole word
+    private mutating func consumeKeyword(_ keyword: String) -> Bool {
+        skipWhitespace()
+        guard peek(keyword) else { return false }
+        let end = index + keyword.count
+        if end < chars.count && (chars[end].isLetter || chars[end].isNumber || chars[end] == "-" || chars[end] == "_") {
+            return false
+        }
+        index = end
+        return true
+    }
+
+    private func word() -> String {
+        var end = index
+        while end < chars.count && (chars[end].isLetter || chars[end].isNumber) {
+            end += 1
+        }
+        return String(chars[index..<end])
+    }
+
+    private func error(_ message: String, at position: Int? = nil) -> BreakpointConditionError {
+        BreakpointConditionError(message: message, column: (position ?? index) + 1)
+    }
+}
@@ -86,7 +86,7 @@ public actor DAPFrontend: DebugFrontend {
         case (.request, "initialize"):
             try? writer.reply(to: msg, body: [
                 "supportsConfigurationDoneRequest": true,
-                "supportsConditionalBreakpoints": false,        // Phase 3
+                "supportsConditionalBreakpoints": true,
                 "supportsHitConditionalBreakpoints": false,
                 "supportsFunctionBreakpoints": true,             // verb breakpoints
                 "supportsSetVariable": false,
@@ -169,15 +169,35 @@ public actor DAPFrontend: DebugFrontend {
         // Wipe any existing location breakpoints for this source and re-add.
         if let ctrl = controller {
             for bp in await ctrl.listBreakpoints() {
-                if case .location(let f, _) = bp, f == sourceName ?? "" {
-                    await ctrl.removeBreakpoint(bp)
+                switch bp {
+                case .location(let f, _), .conditionalLocation(let f, _, _):
+                    if f == sourceName ?? "" { await ctrl.removeBreakpoint(bp) }
+                default:
+                    continue
                 }
             }
             var verified: [[String: Any]] = []
             for entry in lines {
                 guard let line = entry["line"] as? Int else { continue }
-                await ctrl.addBreakpoint(.location(file: sourceName ?? "", line: line))
-                verified.append(["verified": true, "line": line])
+                let condition = (entry["condition"] as? String)?
+                    .trimmingCharacters(in: .whitespacesAndNewlines) ?? ""
+                if condition.isEmpty {
+                    await ctrl.addBreakpoint(.location(file: sourceName ?? "", line: line))
+                    verified.append(["verified": true, "line": line])
+                    continue
+                }
+                // Conditions are parsed here, so a typo shows up on the
+                // breakpoint in the editor rather than as a silent miss.
+                do {
+                    try await ctrl.addConditionalBreakpoint(file: sourceName ?? "", line: line, condition: condition)
+                    verified.append(["verified": true, "line": line])
+                } catch {
+                    verified.append([
+                        "verified": false,
+                        "line": line,
+                        "message": "Invalid condition: \(error)"
+                    ])
+                }
             }
             try? writer.reply(to: msg, body: ["breakpoints": verified])
         } else {
@@ -24,8 +24,9 @@ public enum DebugBreakpoint: Sendable, Hashable {
     case verb(String)
 
     /// Pause at the given file + line only when `predicate` evaluates to a
-    /// truthy value against the current symbol table. `predicate` is raw
-    /// ARO expression source compiled lazily by the controller.
+    /// truthy value against the current symbol table. `predicate` is the
+    /// condition source; the controller parses it into a
+    /// `BreakpointCondition` once, when the breakpoint is added.
     case conditionalLocation(file: String, line: Int, predicate: String)
 
     /// Pause when an event with the given name is about to be published.
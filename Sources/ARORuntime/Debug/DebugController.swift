@@ -20,10 +20,20 @@ public actor DebugController {
     // MARK: - State
 
     private let frontend: any DebugFrontend
-    private var breakpoints: [DebugBreakpoint] = []
+    private var breakpoints: [DebugBreakpoint] = [] {
+        didSet { publishStopGate() }
+    }
+    /// Conditional breakpoint predicates, parsed when the breakpoint is
+    /// added. A predicate that failed to parse has no entry and never
+    /// matches.
+    private var conditions: [String: BreakpointCondition] = [:]
     private var watchExpressions: [String] = []
-    private var nextMode: StepMode = .stepOver   // first checkpoint pauses
-    private var hasFiredEntry = false
+    private var nextMode: StepMode = .stepOver {  // first checkpoint pauses
+        didSet { publishStopGate() }
+    }
+    private var hasFiredEntry = false {
+        didSet { publishStopGate() }
+    }
     private var recorder: DebugEventLogWriter?
     /// Wall-clock at the most recent checkpoint we built a
     /// PauseInfo for (#282 phase 2). Used to compute the
@@ -37,12 +47,24 @@ public actor DebugController {
     private var sampleStride: Int = 1
     private var sampleCounter: Int = 0
 
+    /// Tested by the executor before each checkpoint; statements that
+    /// cannot pause skip the symbol snapshot and the actor call.
+    nonisolated public let stopGate = DebugStopGate()
+
     // MARK: - Init
 
     public init(frontend: any DebugFrontend) {
         self.frontend = frontend
     }
 
+    /// Mirror the breakpoints and step mode into `stopGate`
+    private func publishStopGate() {
+        stopGate.update(
+            breakpoints: breakpoints,
+            stopsAlways: !hasFiredEntry || nextMode != .continue
+        )
+    }
+
     /// Phase 4 — install a record sink. Every pause + event + error
     /// after this call gets appended as a JSONL line.
     public func setRecorder(_ recorder: DebugEventLogWriter) {
@@ -60,17 +82,41 @@ public actor DebugController {
     // MARK: - Breakpoint management (callable from frontend)
 
     public func addBreakpoint(_ bp: DebugBreakpoint) {
+        if case .conditionalLocation(_, _, let predicate) = bp, conditions[predicate] == nil {
+            conditions[predicate] = try? BreakpointCondition(predicate)
+        }
         if !breakpoints.contains(bp) {
             breakpoints.append(bp)
         }
     }
 
+    /// Add a conditional breakpoint, reporting a predicate that does not
+    /// parse instead of adding a breakpoint that can never match.
+    @discardableResult
+    public func addConditionalBreakpoint(file: String, line: Int, condition: String) throws -> DebugBreakpoint {
+        let compiled = try BreakpointCondition(condition)
+        let bp = DebugBreakpoint.conditionalLocation(file: file, line: line, predicate: condition)
+        conditions[condition] = compiled
+        if !breakpoints.contains(bp) {
+            breakpoints.append(bp)
+        }
+        return bp
+    }
+
     public func removeBreakpoint(_ bp: DebugBreakpoint) {
         breakpoints.removeAll { $0 == bp }
+        if case .conditionalLocation(_, _, let predicate) = bp {
+            let stillUsed = breakpoints.contains {
+                if case .conditionalLocation(_, _, predicate) = $0 { return true }
+                return false
+            }
+            if !stillUsed { conditions[predicate] = nil }
+        }
     }
 
     public func clearBreakpoints() {
         breakpoints.removeAll()
+        conditions.removeAll()
     }
 
     public func listBreakpoints() -> [DebugBreakpoint] {
@@ -133,8 +179,8 @@ public actor DebugController {
 
         // Match breakpoints first — they override the step mode.
         // Conditional predicates evaluate against the live context when
-        // one is available (preferred) and fall back to the snapshot-
-        // string evaluator when it isn't.
+        // one is available (preferred) and against the snapshot previews
+        // when it isn't.
         var matched: DebugBreakpoint? = nil
         for bp in breakpoints {
             switch bp {
@@ -145,12 +191,13 @@ public actor DebugController {
             case .verb(let v):
                 if verb == v { matched = bp }
             case .conditionalLocation(let f, let l, let predicate):
-                guard l == line && (f.isEmpty || basename.hasSuffix(f)) else { continue }
+                guard l == line && (f.isEmpty || basename.hasSuffix(f)),
+                      let condition = conditions[predicate] else { continue }
                 let result: Bool
                 if let ctx = context {
-                    result = await PredicateEvaluator.evaluate(predicate, context: ctx)
+                    result = await condition.evaluate(context: ctx)
                 } else {
-                    result = Self.evaluatePredicateFromSnapshot(predicate, symbols: symbols)
+                    result = await condition.evaluate(symbols: symbols)
                 }
                 if result { matched = bp }
             case .event, .errorAny:
@@ -314,79 +361,64 @@ public actor DebugController {
         await recorder.write(.pause, body: body)
     }
 
-    // MARK: - Predicate evaluation (Phase 3)
-
-    /// Fallback predicate evaluator used only when `checkpoint` is called
-    /// without a live `ExecutionContext` — matches `<name>` against
-    /// snapshot previews and supports `==` / `!=` / `&&` / `||`. The
-    /// primary path is `PredicateEvaluator.evaluate`, which uses the
-    /// real `AROParser` + `ExpressionEvaluator` against a live context
-    /// (#230). Keeping this fallback around preserves bug-compatibility
-    /// with the original #229 Phase 3 behavior for any harness that
-    /// hasn't been updated to thread an `ExecutionContext` through.
-    private static func evaluatePredicateFromSnapshot(_ source: String, symbols: [SymbolSnapshot]) -> Bool {
-        var expr = source.trimmingCharacters(in: .whitespaces)
-        // Resolve `<name>` references against the snapshot.
-        for s in symbols {
-            expr = expr.replacingOccurrences(of: "<\(s.name)>", with: "\"\(s.valuePreview)\"")
-        }
-        // Tiny grammar: split on `&&` first, then `||`, then compare.
-        if expr.contains("&&") {
-            return expr.split(separator: "&", maxSplits: .max, omittingEmptySubsequences: true)
-                .filter { !$0.isEmpty }
-                .map(String.init)
-                .allSatisfy { evaluatePredicateFromSnapshot($0, symbols: symbols) }
-        }
-        if expr.contains("||") {
-            return expr.split(separator: "|", maxSplits: .max, omittingEmptySubsequences: true)
-                .filter { !$0.isEmpty }
-                .map(String.init)
-                .contains { evaluatePredicateFromSnapshot($0, symbols: symbols) }
-        }
-        for op in ["==", "!="] {
-            if let range = expr.range(of: op) {
-                let lhs = String(expr[..<range.lowerBound]).trimmingCharacters(in: .whitespacesAndNewlines)
-                let rhs = String(expr[range.upperBound...]).trimmingCharacters(in: .whitespacesAndNewlines)
-                return op == "==" ? lhs == rhs : lhs != rhs
-            }
-        }
-        // Bare expression: truthy when non-empty and not "false".
-        let lowered = expr.lowercased()
-        return !lowered.isEmpty && lowered != "false" && lowered != "\"\"" && lowered != "0"
-    }
-
     // MARK: - Helpers
 
-    private func describe(_ statement: any Statement) -> (line: Int, column: Int, summary: String, verb: String?) {
+    /// Source line, column and verb that breakpoints match against.
+    /// Nonisolated so `DebugStopGate` can use it outside the actor.
+    nonisolated static func position(of statement: any Statement) -> (line: Int, column: Int, verb: String?) {
         if let aro = statement as? AROStatement {
-            let line = aro.span.start.line
-            let column = aro.span.start.column
-            return (line, column, aro.description, aro.action.verb)
+            return (aro.span.start.line, aro.span.start.column, aro.action.verb)
         }
         if let pub = statement as? PublishStatement {
-            return (pub.span.start.line, pub.span.start.column, "Publish as \(pub.externalName) \(pub.internalVariable)", "Publish")
+            return (pub.span.start.line, pub.span.start.column, "Publish")
         }
         if let m = statement as? MatchStatement {
-            return (m.span.start.line, m.span.start.column, "Match …", "Match")
+            return (m.span.start.line, m.span.start.column, "Match")
         }
         if let r = statement as? RequireStatement {
-            return (r.span.start.line, r.span.start.column, "Require …", "Require")
+            return (r.span.start.line, r.span.start.column, "Require")
         }
         if let f = statement as? ForEachLoop {
-            return (f.span.start.line, f.span.start.column, "For each …", "ForEach")
+            return (f.span.start.line, f.span.start.column, "ForEach")
         }
         if let w = statement as? WhileLoop {
-            return (w.span.start.line, w.span.start.column, "While …", "While")
+            return (w.span.start.line, w.span.start.column, "While")
         }
         if let r = statement as? RangeLoop {
-            return (r.span.start.line, r.span.start.column, "Range …", "Range")
+            return (r.span.start.line, r.span.start.column, "Range")
         }
         if let p = statement as? PipelineStatement {
             let start = p.stages.first?.span.start
-            return (start?.line ?? 0, start?.column ?? 0, "Pipeline (\(p.stages.count) stages)", "Pipeline")
+            return (start?.line ?? 0, start?.column ?? 0, "Pipeline")
         }
         // BreakStatement and any future Statement types fall through here.
-        return (0, 0, "<unknown statement>", nil)
+        return (0, 0, nil)
+    }
+
+    private func describe(_ statement: any Statement) -> (line: Int, column: Int, summary: String, verb: String?) {
+        let (line, column, verb) = Self.position(of: statement)
+        let summary: String
+        switch statement {
+        case let aro as AROStatement:
+            summary = aro.description
+        case let pub as PublishStatement:
+            summary = "Publish as \(pub.externalName) \(pub.internalVariable)"
+        case is MatchStatement:
+            summary = "Match …"
+        case is RequireStatement:
+            summary = "Require …"
+        case is ForEachLoop:
+            summary = "For each …"
+        case is WhileLoop:
+            summary = "While …"
+        case is RangeLoop:
+            summary = "Range …"
+        case let p as PipelineStatement:
+            summary = "Pipeline (\(p.stages.count) stages)"
+        default:
+            summary = "<unknown statement>"
+        }
+        return (line, column, summary, verb)
     }
 
     /// Resident memory the runtime process currently holds
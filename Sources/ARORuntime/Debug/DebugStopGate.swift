@@ -0,0 +1,142 @@
+// ============================================================
+// DebugStopGate.swift
+// ARO Runtime - Synchronous stop test for statement checkpoints
+// ============================================================
+//
+// With a debugger attached, every statement used to snapshot the whole
+// symbol table (including repository rows) and hop onto the
+// `DebugController` actor, even when the session was simply running
+// with no breakpoints. The gate is a nonisolated mirror of the
+// controller's stop conditions that the executor tests first:
+//
+//   - A "must stop" word, read with one atomic load. Zero means no
+//     statement can pause (continuing, no statement breakpoints), which
+//     is the common case for an attached but idle debugger.
+//   - Per-file line bitmaps and the verb set, rebuilt by the controller
+//     whenever its breakpoints or step mode change. A source path is
+//     resolved against the breakpoint files once and cached.
+//
+// Only statements that pass the gate pay for the snapshot and the
+// actor call. Conditional breakpoints pass on their line; the
+// controller still evaluates the predicate.
+
+import Foundation
+import Synchronization
+import AROParser
+
+/// Set of source lines, one bit per line.
+struct LineBitmap: Sendable, Equatable {
+    private var words: [UInt64] = []
+
+    var isEmpty: Bool {
+        words.isEmpty
+    }
+
+    func contains(_ line: Int) -> Bool {
+        guard line >= 0, line >> 6 < words.count else { return false }
+        return words[line >> 6] & (1 << UInt64(line & 63)) != 0
+    }
+
+    mutating func insert(_ line: Int) {
+        guard line >= 0 else { return }
+        if line >> 6 >= words.count {
+            words.append(contentsOf: repeatElement(0, count: (line >> 6) + 1 - words.count))
+        }
+        words[line >> 6] |= 1 << UInt64(line & 63)
+    }
+
+    mutating func formUnion(_ other: LineBitmap) {
+        if other.words.count > words.count {
+            words.append(contentsOf: repeatElement(0, count: other.words.count - words.count))
+        }
+        for (index, word) in other.words.enumerated() {
+            words[index] |= word
+        }
+    }
+}
+
+/// Nonisolated view of whether a statement checkpoint can pause.
+public final class DebugStopGate: @unchecked Sendable {
+    /// Stepping, entry pause pending, or quit requested
+    private static let stopsAlways: UInt8 = 1 << 0
+    /// At least one line or verb breakpoint
+    private static let hasBreakpoints: UInt8 = 1 << 1
+
+    /// Starts at `stopsAlways`: the first checkpoint is the entry pause
+    private let word = Atomic<UInt8>(stopsAlways)
+
+    /// Guards the tables below
+    private let lock = NSLock()
+    private var anyFile = LineBitmap()
+    private var byFile: [String: LineBitmap] = [:]
+    private var verbs: Set<String> = []
+    /// Source path → lines with a breakpoint in that file
+    private var resolved: [String: LineBitmap] = [:]
+
+    init() {}
+
+    /// Whether `statement` in `sourceFile` might pause. False means the
+    /// checkpoint would return without pausing and can be skipped.
+    public func mayStop(at statement: any Statement, sourceFile: String) -> Bool {
+        let flags = word.load(ordering: .acquiring)
+        if flags == 0 { return false }
+        if flags & Self.stopsAlways != 0 { return true }
+
+        let position = DebugController.position(of: statement)
+        return lock.withLock {
+            if let verb = position.verb, verbs.contains(verb) {
+                return true
+            }
+            return lines(in: sourceFile).contains(position.line)
+        }
+    }
+
+    /// Rebuild from the controller's state (called inside the actor).
+    func update(breakpoints: [DebugBreakpoint], stopsAlways: Bool) {
+        var anyFile = LineBitmap()
+        var byFile: [String: LineBitmap] = [:]
+        var verbs: Set<String> = []
+        for breakpoint in breakpoints {
+            switch breakpoint {
+            case .location(let file, let line), .conditionalLocation(let file, let line, _):
+                if file.isEmpty {
+                    anyFile.insert(line)
+                } else {
+                    byFile[file, default: LineBitmap()].insert(line)
+                }
+            case .verb(let verb):
+                verbs.insert(verb)
+            case .event, .errorAny:
+                continue   // not checked at statement boundaries
+            }
+        }
+
+        lock.withLock {
+            self.anyFile = anyFile
+            self.byFile = byFile
+            self.verbs = verbs
+            self.resolved = [:]
+        }
+        var flags: UInt8 = stopsAlways ? Self.stopsAlways : 0
+        if !anyFile.isEmpty || !byFile.isEmpty || !verbs.isEmpty {
+            flags |= Self.hasBreakpoints
+        }
+        word.store(flags, ordering: .releasing)
+    }
+
+    /// Lines to stop at in `sourceFile`. Breakpoint files match the
+    /// basename by suffix, as in `DebugController.checkpoint`.
+    /// Caller holds `lock`.
+    private func lines(in sourceFile: String) -> LineBitmap {
+        if let cached = resolved[sourceFile] {
+            return cached
+        }
+        let basename = sourceFile.isEmpty ? "" : URL(fileURLWithPath: sourceFile).lastPathComponent
+        var lines = anyFile
+        for (file, fileLines) in byFile where basename.hasSuffix(file) {
+            lines.formUnion(fileLines)
+        }
+        resolved[sourceFile] = lines
+        return lines
+    }
+}
@@ -69,6 +69,8 @@ private final class SubscriptionStore: @unchecked Sendable {
     /// Side-map from subscription ID to its event type (or "*" for wildcard).
     /// Allows remove() to locate the correct bucket in O(1).
     private var idToType: [UUID: String] = [:]
+    /// Live `stream(for:)` continuations; they receive every event type.
+    private var streamCount = 0
 
     func add(_ subscription: EventBus.Subscription) {
         lock.lock()
@@ -103,6 +105,31 @@ private final class SubscriptionStore: @unchecked Sendable {
         idToType.removeAll()
     }
 
+    func addStream() {
+        lock.lock()
+        defer { lock.unlock() }
+        streamCount += 1
+    }
+
+    func removeStream() {
+        lock.lock()
+        defer { lock.unlock() }
+        streamCount = max(0, streamCount - 1)
+    }
+
+    func removeAllStreams() {
+        lock.lock()
+        defer { lock.unlock() }
+        streamCount = 0
+    }
+
+    /// Whether an event of `eventType` would reach any handler or stream
+    func hasSubscribers(for eventType: String) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return streamCount > 0 || !wildcardSubscriptions.isEmpty || subscriptionsByType[eventType] != nil
+    }
+
     func matching(for eventType: String) -> [EventBus.Subscription] {
         lock.lock()
         defer { lock.unlock() }
@@ -236,6 +263,21 @@ public actor EventBus {
         }
     }
 
+    /// Whether publishing an event of `type` would reach anyone: a typed or
+    /// wildcard subscriber, a stream, or an attached debugger.
+    nonisolated public func hasObservers<E: RuntimeEvent>(for type: E.Type) -> Bool {
+        Debug.controller != nil || store.hasSubscribers(for: E.eventType)
+    }
+
+    /// Publish an event only if its type is observed. The event is built
+    /// lazily, so high-frequency lifecycle events (feature set started /
+    /// completed) cost neither construction nor a publish Task when
+    /// nothing listens for them.
+    nonisolated public func publish<E: RuntimeEvent>(ifObserved makeEvent: @autoclosure () -> E) {
+        guard hasObservers(for: E.self) else { return }
+        publish(makeEvent())
+    }
+
     /// Internal async publish implementation.
     ///
     /// Each subscription gets a Task. Tracks `inFlightHandlers` so
@@ -553,19 +595,20 @@ public actor EventBus {
     /// - Returns: An async stream of events
     public func stream(for eventType: String = "*") -> AsyncStream<any RuntimeEvent> {
         let id = UUID()
+        let (stream, continuation) = AsyncStream<any RuntimeEvent>.makeStream()
 
-        return AsyncStream { continuation in
-            Task {
-                self.continuations[id] = continuation
-            }
+        // Register before the stream escapes, so termination always finds
+        // the entry it has to remove and the stream count stays balanced
+        continuations[id] = continuation
+        store.addStream()
 
-            continuation.onTermination = { [weak self] _ in
-                guard let self else { return }
-                Task {
-                    await self.removeContinuation(id)
-                }
+        continuation.onTermination = { [weak self] _ in
+            guard let self else { return }
+            Task {
+                await self.removeContinuation(id)
             }
         }
+        return stream
     }
 
     /// Create a typed async stream of events
@@ -589,7 +632,9 @@ public actor EventBus {
     }
 
     private func removeContinuation(_ id: UUID) {
-        _ = continuations.removeValue(forKey: id)
+        if continuations.removeValue(forKey: id) != nil {
+            store.removeStream()
+        }
     }
 
     // MARK: - Unsubscribing
@@ -616,6 +661,7 @@ public actor EventBus {
             continuation.finish()
         }
         continuations.removeAll()
+        store.removeAllStreams()
     }
 
     // MARK: - Inspection
@@ -0,0 +1,611 @@
+// ============================================================
+// EventLog.swift
+// ARO Runtime - Binary append-only event log (GitLab #124 follow-up)
+// ============================================================
+//
+// Compact on-disk format for `--record`. Events are streamed to disk
+// as they are published instead of being buffered in memory until
+// shutdown, and the file can be memory-mapped and seeked for replay.
+//
+// Layout (all integers little-endian):
+//
+//   header  "AROEVLOG" u16 version  u16 reserved  i64 startedAtNanos
+//           u16 appNameLength  appName
+//   record  u32 bodyLength  body
+//   body    u64 sequence  i64 timestampNanos
+//           u16 typeLength  type  u16 fieldCount
+//           (u16 keyLength  key  u32 valueLength  value) * fieldCount
+//
+// A sparse index lives next to the log in `<path>.idx`:
+//
+//   "AROEVIDX" then (u64 sequence  i64 timestampNanos  u64 offset) * n
+//
+// with one entry every `indexStride` records. The index is only ever
+// written after the data it points at, so a stale or missing index is
+// harmless: the reader falls back to scanning length prefixes.
+//
+// Record timestamps never decrease. Events can reach the writer out of
+// order when they are published from several threads; such an event is
+// recorded with the previous record's timestamp, so `seek(toTime:)` can
+// binary search the index.
+
+import Foundation
+
+// MARK: - Format Constants
+
+public enum EventLogFormat {
+    public static let magic: [UInt8] = Array("AROEVLOG".utf8)
+    public static let indexMagic: [UInt8] = Array("AROEVIDX".utf8)
+    public static let version: UInt16 = 1
+
+    /// Records between two sparse index entries
+    public static let indexStride = 256
+
+    /// Size of one sparse index entry
+    static let indexEntrySize = 24
+
+    /// File extension that selects the binary format for `--record`
+    public static let fileExtension = "aroevents"
+
+    /// Whether `path` should be recorded in the binary format
+    public static func isBinaryLogPath(_ path: String) -> Bool {
+        (path as NSString).pathExtension == fileExtension
+    }
+
+    /// Whether `data` starts with the binary log magic
+    public static func hasMagic(_ data: Data) -> Bool {
+        data.count >= magic.count && data.prefix(magic.count).elementsEqual(magic)
+    }
+
+    static func indexPath(for path: String) -> String {
+        path + ".idx"
+    }
+
+    static func nanos(_ date: Date) -> Int64 {
+        Int64(date.timeIntervalSince1970 * 1_000_000_000)
+    }
+
+    static func date(_ nanos: Int64) -> Date {
+        Date(timeIntervalSince1970: Double(nanos) / 1_000_000_000)
+    }
+}
+
+// MARK: - Field Encoding
+
+/// Flat key/value payload for one recorded event, encoded straight
+/// into bytes. Events that adopt `RecordableEvent` fill this directly;
+/// anything else goes through a reflection fallback.
+public struct EventRecordFields {
+    fileprivate var bytes: [UInt8] = []
+    fileprivate var count: UInt16 = 0
+
+    public init() {
+        bytes.reserveCapacity(256)
+    }
+
+    fileprivate mutating func reset() {
+        bytes.removeAll(keepingCapacity: true)
+        count = 0
+    }
+
+    public mutating func add(_ key: String, _ value: String) {
+        let keyBytes = key.utf8
+        let keyLength = Swift.min(keyBytes.count, Int(UInt16.max))
+        bytes.appendLE(UInt16(keyLength))
+        bytes.append(contentsOf: keyBytes.prefix(keyLength))
+        let valueBytes = value.utf8
+        bytes.appendLE(UInt32(truncatingIfNeeded: valueBytes.count))
+        bytes.append(contentsOf: valueBytes)
+        count &+= 1
+    }
+
+    public mutating func add(_ key: String, _ value: Int) {
+        add(key, String(value))
+    }
+
+    public mutating func add(_ key: String, _ value: Double) {
+        add(key, String(value))
+    }
+
+    public mutating func add(_ key: String, _ value: Bool) {
+        add(key, value ? "true" : "false")
+    }
+}
+
+/// Events that can describe their payload without reflection. Adopted by
+/// the high-frequency runtime events so recording stays cheap enough to
+/// leave on in production.
+public protocol RecordableEvent: RuntimeEvent {
+    func recordFields(into fields: inout EventRecordFields)
+}
+
+extension HTTPRequestReceivedEvent: RecordableEvent {
+    public func recordFields(into fields: inout EventRecordFields) {
+        fields.add("requestId", requestId)
+        fields.add("method", method)
+        fields.add("path", path)
+    }
+}
+
+extension HTTPResponseSentEvent: RecordableEvent {
+    public func recordFields(into fields: inout EventRecordFields) {
+        fields.add("requestId", requestId)
+        fields.add("statusCode", statusCode)
+        fields.add("durationMs", durationMs)
+    }
+}
+
+extension FeatureSetStartedEvent: RecordableEvent {
+    public func recordFields(into fields: inout EventRecordFields) {
+        fields.add("featureSetName", featureSetName)
+        fields.add("businessActivity", businessActivity)
+        fields.add("executionId", executionId)
+    }
+}
+
+extension FeatureSetCompletedEvent: RecordableEvent {
+    public func recordFields(into fields: inout EventRecordFields) {
+        fields.add("featureSetName", featureSetName)
+        fields.add("businessActivity", businessActivity)
+        fields.add("executionId", executionId)
+        fields.add("success", success)
+        fields.add("durationMs", durationMs)
+    }
+}
+
+extension DomainEvent: RecordableEvent {
+    public func recordFields(into fields: inout EventRecordFields) {
+        fields.add("domainEventType", domainEventType)
+        for (key, value) in payload {
+            fields.add(key, String(describing: value))
+        }
+    }
+}
+
+// MARK: - Writer
+
+/// Streams events to a binary log. Appends are synchronous and take a
+/// single short lock, so the recorder can call straight in from an
+/// EventBus handler without an actor hop. Records are staged in memory
+/// and written in chunks of `flushThreshold` bytes, and at least every
+/// `flushInterval` seconds, so a quiet application's last events still
+/// reach the disk.
+public final class EventLogWriter: @unchecked Sendable {
+    private let lock = NSLock()
+    private let handle: FileHandle
+    private let indexHandle: FileHandle
+    private let flushThreshold: Int
+
+    /// Flushes staged records while the log is idle
+    private var flushTimer: DispatchSourceTimer?
+
+    private var staging: [UInt8] = []
+    private var pendingIndex: [UInt8] = []
+    private var fields = EventRecordFields()
+
+    /// File offset of the first byte in `staging`
+    private var stagingOffset: UInt64 = 0
+    private var nextSequence: UInt64 = 0
+    private var lastTimestamp: Int64 = .min
+    private var closed = false
+
+    public let path: String
+
+    /// - Parameters:
+    ///   - flushThreshold: Staged bytes that trigger a write
+    ///   - flushInterval: Seconds between idle flushes; nil flushes only
+    ///     at the threshold, on `flush()` and on `close()`
+    public init(
+        path: String,
+        applicationName: String = "ARO Application",
+        flushThreshold: Int = 64 * 1024,
+        flushInterval: TimeInterval? = 1.0
+    ) throws {
+        FileManager.default.createFile(atPath: path, contents: nil)
+        FileManager.default.createFile(atPath: EventLogFormat.indexPath(for: path), contents: nil)
+        guard let h = FileHandle(forWritingAtPath: path),
+              let ih = FileHandle(forWritingAtPath: EventLogFormat.indexPath(for: path)) else {
+            throw NSError(domain: "EventLogWriter", code: 1, userInfo: [NSLocalizedDescriptionKey: "cannot open \(path) for writing"])
+        }
+        self.path = path
+        self.handle = h
+        self.indexHandle = ih
+        self.flushThreshold = flushThreshold
+        staging.reserveCapacity(flushThreshold + 4096)
+
+        var header: [UInt8] = EventLogFormat.magic
+        header.appendLE(EventLogFormat.version)
+        header.appendLE(UInt16(0))
+        header.appendLE(EventLogFormat.nanos(Date()))
+        let name = Array(applicationName.utf8.prefix(Int(UInt16.max)))
+        header.appendLE(UInt16(name.count))
+        header.append(contentsOf: name)
+        try handle.write(contentsOf: header)
+        try indexHandle.write(contentsOf: EventLogFormat.indexMagic)
+        stagingOffset = UInt64(header.count)
+
+        if let flushInterval {
+            let timer = DispatchSource.makeTimerSource(queue: DispatchQueue.global(qos: .utility))
+            let interval = DispatchTimeInterval.milliseconds(max(1, Int(flushInterval * 1000)))
+            timer.schedule(deadline: .now() + interval, repeating: interval, leeway: .milliseconds(100))
+            timer.setEventHandler { [weak self] in
+                self?.flush()
+            }
+            flushTimer = timer
+            timer.resume()
+        }
+    }
+
+    deinit {
+        flushTimer?.cancel()
+    }
+
+    /// Number of events appended so far
+    public var count: Int {
+        lock.lock(); defer { lock.unlock() }
+        return Int(nextSequence)
+    }
+
+    /// Appends one event to the log
+    public func append(_ event: any RuntimeEvent) {
+        let eventType = type(of: event).eventType
+        let timestamp = EventLogFormat.nanos(event.timestamp)
+
+        lock.lock()
+        defer { lock.unlock() }
+        guard !closed else { return }
+
+        fields.reset()
+        if let recordable = event as? any RecordableEvent {
+            recordable.recordFields(into: &fields)
+        } else {
+            EventLogWriter.reflectFields(of: event, into: &fields)
+        }
+        appendRecordLocked(eventType: eventType, timestamp: timestamp)
+    }
+
+    /// Appends a pre-rendered record (used when converting JSON recordings)
+    public func append(eventType: String, timestamp: Date, fields recordFields: [(String, String)]) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard !closed else { return }
+
+        fields.reset()
+        for (key, value) in recordFields {
+            fields.add(key, value)
+        }
+        appendRecordLocked(eventType: eventType, timestamp: EventLogFormat.nanos(timestamp))
+    }
+
+    private func appendRecordLocked(eventType: String, timestamp: Int64) {
+        let sequence = nextSequence
+        nextSequence += 1
+        // Keep timestamps non-decreasing for seek(toTime:)
+        let timestamp = max(timestamp, lastTimestamp)
+        lastTimestamp = timestamp
+
+        let recordOffset = stagingOffset + UInt64(staging.count)
+        if sequence % UInt64(EventLogFormat.indexStride) == 0 {
+            pendingIndex.appendLE(sequence)
+            pendingIndex.appendLE(timestamp)
+            pendingIndex.appendLE(recordOffset)
+        }
+
+        let typeBytes = eventType.utf8
+        let typeLength = min(typeBytes.count, Int(UInt16.max))
+        let bodyLength = 8 + 8 + 2 + typeLength + 2 + fields.bytes.count
+        staging.appendLE(UInt32(bodyLength))
+        staging.appendLE(sequence)
+        staging.appendLE(timestamp)
+        staging.appendLE(UInt16(typeLength))
+        staging.append(contentsOf: typeBytes.prefix(typeLength))
+        staging.appendLE(fields.count)
+        staging.append(contentsOf: fields.bytes)
+
+        if staging.count >= flushThreshold {
+            flushLocked()
+        }
+    }
+
+    /// Writes staged records (and then their index entries) to disk
+    public func flush() {
+        lock.lock()
+        defer { lock.unlock() }
+        guard !closed else { return }
+        flushLocked()
+    }
+
+    private func flushLocked() {
+        guard !staging.isEmpty else { return }
+        try? handle.write(contentsOf: staging)
+        stagingOffset += UInt64(staging.count)
+        staging.removeAll(keepingCapacity: true)
+
+        // Data first, index second: the index never points past the data
+        if !pendingIndex.isEmpty {
+            try? indexHandle.write(contentsOf: pendingIndex)
+            pendingIndex.removeAll(keepingCapacity: true)
+        }
+    }
+
+    /// Flushes and closes the log; later appends are ignored
+    public func close() {
+        lock.lock()
+        defer { lock.unlock() }
+        guard !closed else { return }
+        flushTimer?.cancel()
+        flushTimer = nil
+        flushLocked()
+        closed = true
+        try? handle.close()
+        try? indexHandle.close()
+    }
+
+    /// Reflection fallback for events that don't adopt RecordableEvent
+    private static func reflectFields(of event: any RuntimeEvent, into fields: inout EventRecordFields) {
+        for child in Mirror(reflecting: event).children {
+            guard let label = child.label, label != "timestamp" else { continue }
+            fields.add(label, String(describing: child.value))
+        }
+    }
+}
+
+// MARK: - Reader
+
+/// One decoded record from a binary event log
+public struct EventLogRecord: Sendable {
+    public let sequence: UInt64
+    public let timestamp: Date
+    public let eventType: String
+    public let fields: [(key: String, value: String)]
+
+    /// Payload rendered as a compact JSON object (the shape `ReplayedEvent` carries)
+    public var payloadJSON: String {
+        var dict: [String: String] = [:]
+        for (key, value) in fields { dict[key] = value }
+        guard let data = try? JSONSerialization.data(withJSONObject: dict, options: [.sortedKeys]),
+              let json = String(data: data, encoding: .utf8) else {
+            return "{}"
+        }
+        return json
+    }
+}
+
+/// Reads a binary event log through a memory-mapped view. Records are
+/// decoded lazily; `seek(toSequence:)` and `seek(toTime:)` use the sparse
+/// index to jump close to the target and then walk at most
+/// `indexStride` records.
+public struct EventLogReader: Sendable {
+    public struct IndexEntry: Sendable, Equatable {
+        public let sequence: UInt64
+        public let timestampNanos: Int64
+        public let offset: Int
+    }
+
+    public let applicationName: String
+    public let startedAt: Date
+
+    /// Sparse index, ordered by sequence
+    public let index: [IndexEntry]
+
+    private let data: Data
+    private let firstRecordOffset: Int
+
+    public init(path: String) throws {
+        let url = URL(fileURLWithPath: path)
+        let data = try Data(contentsOf: url, options: .alwaysMapped)
+        guard EventLogFormat.hasMagic(data), data.count >= 22 else {
+            throw EventLogError.notAnEventLog(path)
+        }
+        let version: UInt16 = data.loadLE(at: 8)
+        guard version == EventLogFormat.version else {
+            throw EventLogError.unsupportedVersion(Int(version))
+        }
+        self.data = data
+        self.startedAt = EventLogFormat.date(data.loadLE(at: 12))
+        let nameLength = Int(data.loadLE(at: 20) as UInt16)
+        guard data.count >= 22 + nameLength else { throw EventLogError.truncated(path) }
+        self.applicationName = String(decoding: data[data.startIndex + 22 ..< data.startIndex + 22 + nameLength], as: UTF8.self)
+        self.firstRecordOffset = 22 + nameLength
+
+        if let sidecar = EventLogReader.loadIndex(path: EventLogFormat.indexPath(for: path), dataCount: data.count) {
+            self.index = sidecar
+        } else {
+            self.index = EventLogReader.buildIndex(data: data, from: 22 + nameLength)
+        }
+    }
+
+    /// Offset of the first record at or after `sequence`
+    public func seek(toSequence sequence: UInt64) -> Int {
+        // Last index entry whose sequence <= target
+        var start = firstRecordOffset
+        var lo = 0, hi = index.count - 1
+        while lo <= hi {
+            let mid = (lo + hi) / 2
+            if index[mid].sequence <= sequence {
+                start = index[mid].offset
+                lo = mid + 1
+            } else {
+                hi = mid - 1
+            }
+        }
+        var offset = start
+        while let header = recordHeader(at: offset), header.sequence < sequence {
+            offset = header.next
+        }
+        return offset
+    }
+
+    /// Offset of the first record with timestamp at or after `date`.
+    /// Relies on the writer keeping timestamps non-decreasing.
+    public func seek(toTime date: Date) -> Int {
+        let target = EventLogFormat.nanos(date)
+        var start = firstRecordOffset
+        var lo = 0, hi = index.count - 1
+        while lo <= hi {
+            let mid = (lo + hi) / 2
+            if index[mid].timestampNanos < target {
+                start = index[mid].offset
+                lo = mid + 1
+            } else {
+                hi = mid - 1
+            }
+        }
+        var offset = start
+        while let header = recordHeader(at: offset), header.timestamp < target {
+            offset = header.next
+        }
+        return offset
+    }
+
+    /// Lazily decoded records starting at `offset` (defaults to the first record)
+    public func records(from offset: Int? = nil) -> AnySequence<EventLogRecord> {
+        let start = offset ?? firstRecordOffset
+        return AnySequence { () -> AnyIterator<EventLogRecord> in
+            var cursor = start
+            return AnyIterator {
+                guard let (record, next) = self.decode(at: cursor) else { return nil }
+                cursor = next
+                return record
+            }
+        }
+    }
+
+    /// All records as an `EventRecording`, for the existing replay path
+    public func recording() -> EventRecording {
+        let events = records().map {
+            RecordedEvent(timestamp: $0.timestamp, eventType: $0.eventType, payload: $0.payloadJSON)
+        }
+        return EventRecording(application: applicationName, recorded: startedAt, events: events)
+    }
+
+    // MARK: Decoding
+
+    private func recordHeader(at offset: Int) -> (sequence: UInt64, timestamp: Int64, next: Int)? {
+        guard offset + 4 + 16 <= data.count else { return nil }
+        let length = Int(data.loadLE(at: offset) as UInt32)
+        let next = offset + 4 + length
+        // A torn tail record (crash mid-write) ends the log
+        guard length >= 20, next <= data.count else { return nil }
+        return (data.loadLE(at: offset + 4), data.loadLE(at: offset + 12), next)
+    }
+
+    private func decode(at offset: Int) -> (EventLogRecord, Int)? {
+        guard let header = recordHeader(at: offset) else { return nil }
+        var cursor = offset + 20
+        let typeLength = Int(data.loadLE(at: cursor) as UInt16)
+        cursor += 2
+        guard cursor + typeLength + 2 <= header.next else { return nil }
+        let eventType = string(at: cursor, length: typeLength)
+        cursor += typeLength
+        let fieldCount = Int(data.loadLE(at: cursor) as UInt16)
+        cursor += 2
+
+        var fields: [(key: String, value: String)] = []
+        fields.reserveCapacity(fieldCount)
+        for _ in 0..<fieldCount {
+            guard cursor + 2 <= header.next else { return nil }
+            let keyLength = Int(data.loadLE(at: cursor) as UInt16)
+            cursor += 2
+            guard cursor + keyLength + 4 <= header.next else { return nil }
+            let key = string(at: cursor, length: keyLength)
+            cursor += keyLength
+            let valueLength = Int(data.loadLE(at: cursor) as UInt32)
+            cursor += 4
+            guard cursor + valueLength <= header.next else { return nil }
+            fields.append((key, string(at: cursor, length: valueLength)))
+            cursor += valueLength
+        }
+
+        let record = EventLogRecord(
+            sequence: header.sequence,
+            timestamp: EventLogFormat.date(header.timestamp),
+            eventType: eventType,
+            fields: fields
+        )
+        return (record, header.next)
+    }
+
+    private func string(at offset: Int, length: Int) -> String {
+        let start = data.startIndex + offset
+        return String(decoding: data[start ..< start + length], as: UTF8.self)
+    }
+
+    // MARK: Index
+
+    private static func loadIndex(path: String, dataCount: Int) -> [IndexEntry]? {
+        guard let raw = try? Data(contentsOf: URL(fileURLWithPath: path), options: .alwaysMapped),
+              raw.count >= EventLogFormat.indexMagic.count,
+              raw.prefix(EventLogFormat.indexMagic.count).elementsEqual(EventLogFormat.indexMagic) else {
+            return nil
+        }
+        var entries: [IndexEntry] = []
+        var cursor = EventLogFormat.indexMagic.count
+        while cursor + EventLogFormat.indexEntrySize <= raw.count {
+            let entry = IndexEntry(
+                sequence: raw.loadLE(at: cursor),
+                timestampNanos: raw.loadLE(at: cursor + 8),
+                offset: Int(raw.loadLE(at: cursor + 16) as UInt64)
+            )
+            // An entry past the end of the data means the index is stale
+            guard entry.offset < dataCount else { return nil }
+            entries.append(entry)
+            cursor += EventLogFormat.indexEntrySize
+        }
+        return entries
+    }
+
+    private static func buildIndex(data: Data, from start: Int) -> [IndexEntry] {
+        var entries: [IndexEntry] = []
+        var offset = start
+        var position = 0
+        while offset + 20 <= data.count {
+            let length = Int(data.loadLE(at: offset) as UInt32)
+            let next = offset + 4 + length
+            guard length >= 20, next <= data.count else { break }
+            if position % EventLogFormat.indexStride == 0 {
+                entries.append(IndexEntry(
+                    sequence: data.loadLE(at: offset + 4),
+                    timestampNanos: data.loadLE(at: offset + 12),
+                    offset: offset
+                ))
+            }
+            position += 1
+            offset = next
+        }
+        return entries
+    }
+}
+
+/// Errors raised while opening a binary event log
+public enum EventLogError: Error, CustomStringConvertible {
+    case notAnEventLog(String)
+    case unsupportedVersion(Int)
+    case truncated(String)
+
+    public var description: String {
+        switch self {
+        case .notAnEventLog(let path): return "Not an ARO event log: \(path)"
+        case .unsupportedVersion(let version): return "Unsupported event log version \(version)"
+        case .truncated(let path): return "Event log header is truncated: \(path)"
+        }
+    }
+}
+
+// MARK: - Little-endian Helpers
+
+extension Array where Element == UInt8 {
+    @inline(__always)
+    fileprivate mutating func appendLE<T: FixedWidthInteger>(_ value: T) {
+        withUnsafeBytes(of: value.littleEndian) { append(contentsOf: $0) }
+    }
+}
+
+extension Data {
+    @inline(__always)
+    fileprivate func loadLE<T: FixedWidthInteger>(at offset: Int) -> T {
+        withUnsafeBytes { raw in
+            T(littleEndian: raw.loadUnaligned(fromByteOffset: offset, as: T.self))
+        }
+    }
+}
@@ -0,0 +1,83 @@
+// ============================================================
+// EventPayload.swift
+// ARO Runtime - Shared immutable event payload storage
+// ============================================================
+
+import Foundation
+
+/// Immutable, reference-counted payload shared by every subscriber of an event.
+///
+/// An event fanned out to N handlers hands each of them the same instance,
+/// so delivery retains one object instead of copying the dictionary, and
+/// the `event:<key>` binding names are derived once per event rather than
+/// once per handler.
+public final class EventPayload: Sendable {
+    /// One payload entry with its precomputed context binding name
+    public struct Binding: Sendable {
+        /// Payload key, e.g. "user"
+        public let key: String
+        /// Context name handlers see, e.g. "event:user"
+        public let qualifiedName: String
+        public let value: any Sendable
+    }
+
+    /// The payload as a dictionary (shares storage, never copied)
+    public let values: [String: any Sendable]
+
+    /// Payload entries with their `event:<key>` names
+    public let bindings: [Binding]
+
+    /// Shared empty payload
+    public static let empty = EventPayload([:])
+
+    public init(_ values: [String: any Sendable]) {
+        self.values = values
+        self.bindings = values.map { key, value in
+            Binding(key: key, qualifiedName: "event:\(key)", value: value)
+        }
+    }
+
+    public subscript(key: String) -> (any Sendable)? {
+        values[key]
+    }
+
+    public var isEmpty: Bool { values.isEmpty }
+}
+
+/// Per-event cache of the read-only context frame that handler contexts
+/// are parented to.
+///
+/// The frame holds `event` and every `event:<key>` binding. It is built the
+/// first time a handler of the event runs and reused by every later handler
+/// with the same base context, so each handler binds only its own locals.
+/// The frame is never written after it is published, which makes the
+/// concurrent reads of parallel handlers safe.
+final class EventFrameCache: @unchecked Sendable {
+    private let lock = NSLock()
+    private var frames: [ObjectIdentifier: RuntimeContext] = [:]
+
+    /// Returns the frame for `base`, building it from `payload` on first use.
+    /// The frame retains `base`, so its identifier is never reused while cached.
+    func frame(over base: RuntimeContext, payload: () -> EventPayload) -> RuntimeContext {
+        let key = ObjectIdentifier(base)
+        lock.lock()
+        defer { lock.unlock() }
+        if let frame = frames[key] {
+            return frame
+        }
+
+        let payload = payload()
+        let frame = RuntimeContext(
+            featureSetName: base.featureSetName,
+            businessActivity: base.businessActivity,
+            eventBus: base.eventBus,
+            parent: base
+        )
+        frame.bind("event", value: payload.values)
+        for binding in payload.bindings {
+            frame.bind(binding.qualifiedName, value: binding.value)
+        }
+        frames[key] = frame
+        return frame
+    }
+}
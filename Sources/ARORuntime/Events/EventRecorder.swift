@@ -31,21 +31,35 @@ public struct EventRecording: Codable, Sendable {
     public let events: [RecordedEvent]
 
     public init(application: String, events: [RecordedEvent]) {
+        self.init(application: application, recorded: Date(), events: events)
+    }
+
+    public init(application: String, recorded: Date, events: [RecordedEvent]) {
         self.version = "1.0"
         self.application = application
-        self.recorded = Date()
+        self.recorded = recorded
         self.events = events
     }
 }
 
 /// Records events for debugging and replay
 /// GitLab #124: Event replay and persistence
+///
+/// Two modes:
+/// - in-memory (default): events are kept until `saveToFile` writes one
+///   pretty-printed `EventRecording` JSON document.
+/// - streaming: `startRecording(streamingTo:)` appends each event to a
+///   binary `EventLogWriter` as it is published, straight from the bus
+///   handler with no actor hop and nothing retained in memory.
 public actor EventRecorder {
     private var events: [(timestamp: Date, eventType: String, payload: String)] = []
     private var isRecording = false
     private var subscriptionId: UUID?
     private let eventBus: EventBus
 
+    /// Binary log for streaming mode (nil when recording in memory)
+    private var logWriter: EventLogWriter?
+
     /// Reused encoder — actor isolation guarantees single-threaded access.
     private let encoder: JSONEncoder = {
         let e = JSONEncoder()
@@ -63,6 +77,7 @@ public actor EventRecorder {
         guard !isRecording else { return }
         isRecording = true
         events.removeAll()
+        logWriter = nil
 
         // Subscribe to all events
         subscriptionId = eventBus.subscribe(to: "*") { [weak self] event in
@@ -82,11 +97,40 @@ public actor EventRecorder {
             subscriptionId = nil
         }
 
+        // Streaming mode: everything is already on disk. The closed
+        // writer is kept so saveToFile knows not to overwrite the log.
+        if let writer = logWriter {
+            writer.close()
+            return []
+        }
+
         return events.map { RecordedEvent(timestamp: $0.timestamp, eventType: $0.eventType, payload: $0.payload) }
     }
 
+    /// Start streaming all events to a binary event log at `path`
+    /// (see EventLog.swift for the format)
+    public func startRecording(streamingTo path: String, applicationName: String = "ARO Application") throws {
+        guard !isRecording else { return }
+        let writer = try EventLogWriter(path: path, applicationName: applicationName)
+        logWriter = writer
+        isRecording = true
+        events.removeAll()
+
+        subscriptionId = eventBus.subscribe(to: "*") { event in
+            writer.append(event)
+        }
+    }
+
     /// Save recorded events to file
+    ///
+    /// In streaming mode the events are already on disk; this just
+    /// flushes whatever is still staged.
     public func saveToFile(_ path: String, applicationName: String = "ARO Application") async throws {
+        if let writer = logWriter {
+            writer.flush()
+            return
+        }
+
         let recordedEvents = events.map { RecordedEvent(timestamp: $0.timestamp, eventType: $0.eventType, payload: $0.payload) }
         let recording = EventRecording(application: applicationName, events: recordedEvents)
 
@@ -132,7 +176,7 @@ public actor EventRecorder {
 
     /// Get count of recorded events
     public var eventCount: Int {
-        events.count
+        logWriter?.count ?? events.count
     }
 }
 
@@ -152,14 +196,37 @@ public actor EventReplayer {
         self.eventBus = eventBus
     }
 
-    /// Load recording from file
+    /// Load recording from file (binary event log or JSON recording)
     public func loadFromFile(_ path: String) throws -> EventRecording {
         let url = URL(fileURLWithPath: path)
-        let data = try Data(contentsOf: url)
+        let data = try Data(contentsOf: url, options: .alwaysMapped)
 
+        if EventLogFormat.hasMagic(data) {
+            return try EventLogReader(path: path).recording()
+        }
         return try decoder.decode(EventRecording.self, from: data)
     }
 
+    /// Replay a binary event log without timing delays, starting at the
+    /// first event at or after `time` (or at the beginning). Records are
+    /// decoded one at a time from the mapped file.
+    /// - Returns: Number of events replayed
+    @discardableResult
+    public func replayFast(_ log: EventLogReader, from time: Date? = nil) -> Int {
+        let start = time.map { log.seek(toTime: $0) }
+        var count = 0
+        for record in log.records(from: start) {
+            let replayedEvent = ReplayedEvent(
+                originalType: record.eventType,
+                timestamp: record.timestamp,
+                payload: record.payloadJSON
+            )
+            eventBus.publish(replayedEvent)
+            count += 1
+        }
+        return count
+    }
+
     /// Replay events with timing preserved
     /// - Parameters:
     ///   - recording: The event recording to replay
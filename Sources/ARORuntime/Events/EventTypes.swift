@@ -307,6 +307,9 @@ public struct RepositoryChangedEvent: RuntimeEvent {
     /// The old value (nil for creates)
     public let oldValue: (any Sendable)?
 
+    /// Frames shared by every observer context of this change
+    let handlerFrames = EventFrameCache()
+
     public init(
         repositoryName: String,
         changeType: RepositoryChangeType,
@@ -321,6 +324,33 @@ public struct RepositoryChangedEvent: RuntimeEvent {
         self.newValue = newValue
         self.oldValue = oldValue
     }
+
+    /// The payload observers see as `event`
+    var payload: [String: any Sendable] {
+        var payload: [String: any Sendable] = [
+            "repositoryName": repositoryName,
+            "changeType": changeType.rawValue,
+            "timestamp": timestamp
+        ]
+        if let entityId { payload["entityId"] = entityId }
+        if let newValue { payload["newValue"] = newValue }
+        if let oldValue { payload["oldValue"] = oldValue }
+        return payload
+    }
+}
+
+extension RepositoryChangedEvent: CustomReflectable {
+    /// Hides the frame cache from reflection-based recording.
+    public var customMirror: Mirror {
+        Mirror(self, children: [
+            "timestamp": timestamp,
+            "repositoryName": repositoryName,
+            "changeType": changeType,
+            "entityId": entityId as Any,
+            "newValue": newValue as Any,
+            "oldValue": oldValue as Any,
+        ])
+    }
 }
 
 /// Event emitted when an item is evicted from a repository due to maxSize or TTL.
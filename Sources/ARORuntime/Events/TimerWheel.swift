@@ -0,0 +1,402 @@
+// ============================================================
+// TimerWheel.swift
+// ARO Runtime - Hierarchical timing wheel for scheduled events
+// ============================================================
+//
+// `Schedule` used to start one detached sleep loop per timer. Thousands
+// of per-entity schedules meant thousands of suspended tasks, and every
+// `Task.sleep` added its wake-up latency to the next period, so ticks
+// drifted. All timers now live in one wheel owned by the runtime:
+//
+//   - Deadlines are absolute nanoseconds on a monotonic clock. A
+//     periodic timer's next deadline is `deadline + interval`, never
+//     `now + interval`, so wake-up latency does not accumulate.
+//   - The wheel has `levels` rings of 64 slots. Level 0 slots are one
+//     tick wide, each higher level is 64 times coarser. A timer sits in
+//     the finest level that can hold its distance and moves down
+//     ("cascades") when the lower levels roll over.
+//   - Slots are intrusive doubly linked lists over a flat entry array,
+//     so scheduling and cancelling are O(1). Handles carry a generation
+//     so a stale handle never cancels a reused entry.
+//   - One driver thread sleeps until the next occupied level 0 slot or
+//     cascade point, at most 64 ticks, and parks while no timer is
+//     scheduled.
+//
+// Timer actions run on the driver thread after the wheel lock is
+// released; they must be short (ScheduleAction only publishes).
+
+import Foundation
+
+// MARK: - Clock
+
+/// Monotonic time source for `TimerWheel`.
+public protocol TimerClock: Sendable {
+    /// Nanoseconds since an arbitrary fixed origin; never decreases
+    func now() -> UInt64
+}
+
+/// System uptime clock, unaffected by wall-clock adjustments
+public struct MonotonicTimerClock: TimerClock {
+    public init() {}
+
+    public func now() -> UInt64 {
+        DispatchTime.now().uptimeNanoseconds
+    }
+}
+
+// MARK: - Catch-Up Policy
+
+/// What a periodic timer does about periods that elapsed while it could
+/// not fire (process suspended, driver delayed).
+public enum TimerCatchUp: Sendable {
+    /// Drop missed periods; fire only when less than one interval late
+    case skip
+    /// Fire once for all missed periods together
+    case fireOnce
+    /// Fire once per missed period
+    case fireAll
+}
+
+/// Identifies a scheduled timer for cancellation.
+public struct TimerHandle: Hashable, Sendable {
+    fileprivate let index: Int32
+    fileprivate let generation: UInt32
+}
+
+// MARK: - TimerWheel
+
+/// Hierarchical timing wheel with O(1) schedule and cancel.
+public final class TimerWheel: @unchecked Sendable {
+    /// The runtime's wheel: monotonic clock, 10 ms ticks, own driver thread
+    public static let shared = TimerWheel(clock: MonotonicTimerClock())
+
+    private static let slotBits: UInt64 = 6
+    private static let slotsPerLevel = 1 << slotBits
+    private static let slotMask = UInt64(slotsPerLevel - 1)
+
+    public let tickNanoseconds: UInt64
+    private let clock: any TimerClock
+    private let levels: Int
+    private let origin: UInt64
+    private let startsDriver: Bool
+
+    /// Guards everything below; the driver waits on it
+    private let condition = NSCondition()
+    /// First entry of each (level, slot) list, -1 when empty
+    private var slots: [Int32]
+    private var entries: [Entry] = []
+    private var freeList: Int32 = -1
+    private var active = 0
+    /// Last tick whose level 0 slot has been fired
+    private var currentTick: UInt64 = 0
+    private var driverStarted = false
+    private var isShutDown = false
+
+    /// - Parameters:
+    ///   - clock: Time source; tests inject a virtual clock
+    ///   - tickNanoseconds: Resolution of level 0
+    ///   - levels: Number of rings; 6 levels of 10 ms ticks span ~21 years
+    ///   - startsDriver: Start a driver thread on the first `schedule`.
+    ///     Without one, call `advance()` to fire due timers.
+    public init(
+        clock: any TimerClock,
+        tickNanoseconds: UInt64 = 10_000_000,
+        levels: Int = 6,
+        startsDriver: Bool = true
+    ) {
+        self.clock = clock
+        self.tickNanoseconds = max(1, tickNanoseconds)
+        self.levels = min(max(1, levels), 10)
+        self.origin = clock.now()
+        self.startsDriver = startsDriver
+        self.slots = Array(repeating: -1, count: self.levels * Self.slotsPerLevel)
+    }
+
+    /// Number of scheduled timers
+    public var count: Int {
+        condition.withLock { active }
+    }
+
+    // MARK: - Scheduling
+
+    /// Schedule `action` to run `delay` nanoseconds from now and, when
+    /// `interval` is given, every `interval` nanoseconds after that.
+    /// Intervals shorter than one tick are rounded up to one tick.
+    @discardableResult
+    public func schedule(
+        after delay: UInt64,
+        every interval: UInt64? = nil,
+        catchUp: TimerCatchUp = .fireOnce,
+        _ action: @escaping @Sendable () -> Void
+    ) -> TimerHandle {
+        let deadline = elapsed(at: clock.now()) &+ delay
+
+        condition.lock()
+        defer { condition.unlock() }
+
+        let index = allocate()
+        entries[Int(index)].deadline = deadline
+        entries[Int(index)].interval = interval.map { max($0, tickNanoseconds) } ?? 0
+        entries[Int(index)].catchUp = catchUp
+        entries[Int(index)].action = action
+        link(index)
+        active += 1
+
+        if startsDriver && !isShutDown {
+            if !driverStarted {
+                driverStarted = true
+                let thread = Thread { [self] in runDriver() }
+                thread.name = "aro.timer-wheel"
+                thread.start()
+            }
+            // The new deadline may be earlier than the driver's current wait
+            condition.signal()
+        }
+        return TimerHandle(index: index, generation: entries[Int(index)].generation)
+    }
+
+    /// Cancel a timer. Returns false when it already fired (one-shot) or
+    /// was cancelled before.
+    @discardableResult
+    public func cancel(_ handle: TimerHandle) -> Bool {
+        condition.lock()
+        defer { condition.unlock() }
+
+        let index = Int(handle.index)
+        guard index < entries.count,
+              entries[index].generation == handle.generation,
+              entries[index].slot >= 0 else {
+            return false
+        }
+        unlink(handle.index)
+        release(handle.index)
+        return true
+    }
+
+    /// Stop the driver thread. Scheduled timers no longer fire on their own.
+    public func shutdown() {
+        condition.lock()
+        isShutDown = true
+        condition.broadcast()
+        condition.unlock()
+    }
+
+    // MARK: - Advancing
+
+    /// Fire every timer that is due at the clock's current time.
+    public func advance() {
+        advance(to: clock.now())
+    }
+
+    private func advance(to now: UInt64) {
+        let elapsedNow = elapsed(at: now)
+        var due: [(action: @Sendable () -> Void, times: UInt64)] = []
+
+        condition.lock()
+        let target = elapsedNow / tickNanoseconds
+        while currentTick < target {
+            if active == 0 {
+                currentTick = target
+                break
+            }
+            let tick = currentTick + 1
+            cascade(at: tick)
+
+            let flat = Int(tick & Self.slotMask)
+            var index = slots[flat]
+            slots[flat] = -1
+            while index >= 0 {
+                let next = entries[Int(index)].next
+                expire(index, now: elapsedNow, into: &due)
+                index = next
+            }
+            currentTick = tick
+        }
+        condition.unlock()
+
+        for (action, times) in due {
+            for _ in 0..<times {
+                action()
+            }
+        }
+    }
+
+    /// Fire or reschedule an entry whose slot came due. The slot list has
+    /// already been detached, so the entry is not unlinked here.
+    private func expire(
+        _ index: Int32,
+        now: UInt64,
+        into due: inout [(action: @Sendable () -> Void, times: UInt64)]
+    ) {
+        let i = Int(index)
+        entries[i].slot = -1
+        guard let action = entries[i].action else {
+            release(index)
+            return
+        }
+
+        let interval = entries[i].interval
+        guard interval > 0 else {
+            due.append((action, 1))
+            release(index)
+            return
+        }
+
+        // Further periods that also ended by `now`
+        let deadline = entries[i].deadline
+        let missed = now > deadline ? (now - deadline) / interval : 0
+        let times: UInt64
+        switch entries[i].catchUp {
+        case .skip: times = missed == 0 ? 1 : 0
+        case .fireOnce: times = 1
+        case .fireAll: times = missed + 1
+        }
+        if times > 0 {
+            due.append((action, times))
+        }
+        entries[i].deadline = deadline &+ (missed + 1) * interval
+        link(index)
+    }
+
+    /// Move the higher-level slots that roll over at `tick` down to the
+    /// levels that now cover them, coarsest first.
+    private func cascade(at tick: UInt64) {
+        var top = 0
+        while top + 1 < levels && tick & ((1 << (Self.slotBits * UInt64(top + 1))) - 1) == 0 {
+            top += 1
+        }
+        var level = top
+        while level >= 1 {
+            let slot = Int((tick >> (Self.slotBits * UInt64(level))) & Self.slotMask)
+            let flat = level * Self.slotsPerLevel + slot
+            var index = slots[flat]
+            slots[flat] = -1
+            while index >= 0 {
+                let next = entries[Int(index)].next
+                link(index)
+                index = next
+            }
+            level -= 1
+        }
+    }
+
+    // MARK: - Driver
+
+    private func runDriver() {
+        condition.lock()
+        while !isShutDown {
+            guard active > 0 else {
+                condition.wait()
+                continue
+            }
+            let wakeAt = origin &+ nextWakeTick() * tickNanoseconds
+            let now = clock.now()
+            if now < wakeAt {
+                // Woken early by `schedule` or `shutdown`: re-evaluate
+                _ = condition.wait(until: Date(timeIntervalSinceNow: Double(wakeAt - now) / 1e9))
+                continue
+            }
+            condition.unlock()
+            advance(to: now)
+            condition.lock()
+        }
+        condition.unlock()
+    }
+
+    /// The next tick with an occupied level 0 slot, or the next cascade
+    /// point, whichever comes first. Caller holds `condition`.
+    private func nextWakeTick() -> UInt64 {
+        for offset in 1...UInt64(Self.slotsPerLevel) {
+            let tick = currentTick + offset
+            if tick & Self.slotMask == 0 || slots[Int(tick & Self.slotMask)] >= 0 {
+                return tick
+            }
+        }
+        return currentTick + 1
+    }
+
+    // MARK: - Entries
+
+    private struct Entry {
+        /// Nanoseconds since `origin`
+        var deadline: UInt64 = 0
+        /// 0 for one-shot timers
+        var interval: UInt64 = 0
+        var catchUp: TimerCatchUp = .fireOnce
+        var action: (@Sendable () -> Void)?
+        var prev: Int32 = -1
+        var next: Int32 = -1
+        /// Flat slot index while scheduled, -1 otherwise
+        var slot: Int32 = -1
+        var generation: UInt32 = 0
+    }
+
+    private func elapsed(at now: UInt64) -> UInt64 {
+        now > origin ? now - origin : 0
+    }
+
+    private func allocate() -> Int32 {
+        if freeList >= 0 {
+            let index = freeList
+            freeList = entries[Int(index)].next
+            entries[Int(index)].next = -1
+            return index
+        }
+        entries.append(Entry())
+        return Int32(entries.count - 1)
+    }
+
+    /// Return an unlinked entry to the free list
+    private func release(_ index: Int32) {
+        let i = Int(index)
+        entries[i].action = nil
+        entries[i].slot = -1
+        entries[i].prev = -1
+        entries[i].generation &+= 1
+        entries[i].next = freeList
+        freeList = index
+        active -= 1
+    }
+
+    /// Insert an entry into the slot for its deadline, relative to the
+    /// next tick to be fired. Overdue entries go to that next tick.
+    private func link(_ index: Int32) {
+        let i = Int(index)
+        let base = currentTick + 1
+        let dueTick = (entries[i].deadline + tickNanoseconds - 1) / tickNanoseconds
+        let tick = max(dueTick, base)
+        let delta = tick - base
+
+        var level = 0
+        while level + 1 < levels && delta >= 1 << (Self.slotBits * UInt64(level + 1)) {
+            level += 1
+        }
+        let slot = Int((tick >> (Self.slotBits * UInt64(level))) & Self.slotMask)
+        let flat = level * Self.slotsPerLevel + slot
+
+        let head = slots[flat]
+        entries[i].slot = Int32(flat)
+        entries[i].prev = -1
+        entries[i].next = head
+        if head >= 0 {
+            entries[Int(head)].prev = index
+        }
+        slots[flat] = index
+    }
+
+    private func unlink(_ index: Int32) {
+        let i = Int(index)
+        let prev = entries[i].prev
+        let next = entries[i].next
+        if prev >= 0 {
+            entries[Int(prev)].next = next
+        } else {
+            slots[Int(entries[i].slot)] = next
+        }
+        if next >= 0 {
+            entries[Int(next)].prev = prev
+        }
+        entries[i].prev = -1
+        entries[i].next = -1
+    }
+}
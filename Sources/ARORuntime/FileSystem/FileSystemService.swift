@@ -512,6 +512,24 @@ public final class AROFileSystemService: FileSystemService, FileMonitorService,
         }
     }
 
+    /// Write a stream of records through the format's `FormatWriter`
+    public func write(
+        path: String,
+        records: AROStream<any Sendable>,
+        format: FileFormat,
+        variableName: String,
+        options: [String: any Sendable],
+        append: Bool
+    ) async throws {
+        try await FormatSerializer.write(
+            records, to: path, format: format,
+            variableName: variableName, options: options, append: append
+        )
+        if !append {
+            eventBus.publish(FileWrittenEvent(path: path))
+        }
+    }
+
     /// Delete file
     public func delete(path: String) async throws {
         guard fileManager.fileExists(atPath: path) else {
@@ -1169,6 +1187,24 @@ public final class AROFileSystemService: FileSystemService, @unchecked Sendable
         }
     }
 
+    /// Write a stream of records through the format's `FormatWriter`
+    public func write(
+        path: String,
+        records: AROStream<any Sendable>,
+        format: FileFormat,
+        variableName: String,
+        options: [String: any Sendable],
+        append: Bool
+    ) async throws {
+        try await FormatSerializer.write(
+            records, to: path, format: format,
+            variableName: variableName, options: options, append: append
+        )
+        if !append {
+            eventBus.publish(FileWrittenEvent(path: path))
+        }
+    }
+
     /// Delete file
     public func delete(path: String) async throws {
         guard fileManager.fileExists(atPath: path) else {
@@ -168,506 +168,17 @@ public struct FormatDeserializer: Sendable {
 
     // MARK: - YAML Deserialization
 
+    /// Parse with `YAMLParser` (iterative, over the UTF-8 bytes)
     private static func deserializeYAML(_ content: String) -> any Sendable {
-        let lines = content.split(separator: "\n", omittingEmptySubsequences: false).map { String($0) }
-        return parseYAMLLines(lines, startIndex: 0, indent: 0).value
-    }
-
-    private static func parseYAMLLines(
-        _ lines: [String],
-        startIndex: Int,
-        indent: Int
-    ) -> (value: any Sendable, endIndex: Int) {
-        guard startIndex < lines.count else {
-            return ("", startIndex)
-        }
-
-        let line = lines[startIndex]
-        let trimmedLine = line.trimmingCharacters(in: .whitespaces)
-
-        // Skip empty lines and comments
-        if trimmedLine.isEmpty || trimmedLine.hasPrefix("#") {
-            return parseYAMLLines(lines, startIndex: startIndex + 1, indent: indent)
-        }
-
-        // Check for array item
-        if trimmedLine.hasPrefix("- ") {
-            return parseYAMLArray(lines, startIndex: startIndex, indent: indent)
-        }
-
-        // Check for key-value pair
-        if trimmedLine.contains(":") {
-            return parseYAMLObject(lines, startIndex: startIndex, indent: indent)
-        }
-
-        // Simple value
-        return (parseYAMLScalar(trimmedLine), startIndex + 1)
-    }
-
-    private static func parseYAMLArray(
-        _ lines: [String],
-        startIndex: Int,
-        indent: Int
-    ) -> (value: [any Sendable], endIndex: Int) {
-        var result: [any Sendable] = []
-        var index = startIndex
-
-        while index < lines.count {
-            let line = lines[index]
-            let currentIndent = line.prefix(while: { $0 == " " }).count
-
-            if currentIndent < indent && !line.trimmingCharacters(in: .whitespaces).isEmpty {
-                break
-            }
-
-            let trimmedLine = line.trimmingCharacters(in: .whitespaces)
-            if trimmedLine.isEmpty || trimmedLine.hasPrefix("#") {
-                index += 1
-                continue
-            }
-
-            if !trimmedLine.hasPrefix("- ") {
-                break
-            }
-
-            // Parse array item
-            let itemContent = String(trimmedLine.dropFirst(2))
-            if itemContent.contains(": ") {
-                // Object in array: first key-value is on the "- " line,
-                // continuation keys are indented on subsequent lines.
-                // Build a synthetic line array where the first key is at
-                // the continuation indent so parseYAMLObject sees them all.
-                let dashIndent = currentIndent
-                let continuationIndent = dashIndent + 2
-                let prefix = String(repeating: " ", count: continuationIndent)
-                var objectLines = [prefix + itemContent]
-
-                // Collect continuation lines that belong to this object.
-                // A line is part of the same object iff it is strictly more
-                // indented than the dash that opened the item. Lines at the
-                // same indent that start with `- ` are the next array item
-                // and stop the collection; deeper `- ` lines belong to a
-                // nested array under one of the object's keys.
-                var peek = index + 1
-                while peek < lines.count {
-                    let pLine = lines[peek]
-                    let pTrimmed = pLine.trimmingCharacters(in: .whitespaces)
-                    if pTrimmed.isEmpty || pTrimmed.hasPrefix("#") {
-                        objectLines.append(pLine)
-                        peek += 1
-                        continue
-                    }
-                    let pIndent = pLine.prefix(while: { $0 == " " }).count
-                    if pIndent > dashIndent {
-                        objectLines.append(pLine)
-                        peek += 1
-                    } else {
-                        break
-                    }
-                }
-
-                let (obj, _) = parseYAMLObject(
-                    objectLines,
-                    startIndex: 0,
-                    indent: continuationIndent
-                )
-                result.append(obj)
-                index = peek
-            } else if itemContent.isEmpty {
-                // Multi-line value after dash
-                index += 1
-            } else {
-                result.append(parseYAMLScalar(itemContent))
-                index += 1
-            }
-        }
-
-        return (result, index)
-    }
-
-    private static func parseYAMLObject(
-        _ lines: [String],
-        startIndex: Int,
-        indent: Int
-    ) -> (value: [String: any Sendable], endIndex: Int) {
-        var result: [String: any Sendable] = [:]
-        var index = startIndex
-
-        while index < lines.count {
-            let line = lines[index]
-            let currentIndent = line.prefix(while: { $0 == " " }).count
-
-            if currentIndent < indent && !line.trimmingCharacters(in: .whitespaces).isEmpty {
-                break
-            }
-
-            let trimmedLine = line.trimmingCharacters(in: .whitespaces)
-            if trimmedLine.isEmpty || trimmedLine.hasPrefix("#") {
-                index += 1
-                continue
-            }
-
-            if trimmedLine.hasPrefix("- ") {
-                break
-            }
-
-            guard let colonIndex = trimmedLine.firstIndex(of: ":") else {
-                index += 1
-                continue
-            }
-
-            let key = String(trimmedLine[..<colonIndex])
-            let afterColon = String(trimmedLine[trimmedLine.index(after: colonIndex)...])
-                .trimmingCharacters(in: .whitespaces)
-
-            // Block scalar indicators: `|`, `|-`, `|+`, `>`, `>-`, `>+`
-            // (literal vs folded, with optional chomping). All variants share
-            // the same collection loop — they keep every line whose indent
-            // exceeds the key's own indent.
-            if afterColon == "|" || afterColon == "|-" || afterColon == "|+"
-                || afterColon == ">" || afterColon == ">-" || afterColon == ">+" {
-                let folded = afterColon.hasPrefix(">")
-                let chomp = afterColon.last  // "-" strip, "+" keep, nil clip
-                let (text, endIdx) = parseYAMLBlockScalar(
-                    lines,
-                    startIndex: index + 1,
-                    parentIndent: currentIndent,
-                    folded: folded,
-                    chomp: chomp == "-" ? .strip : (chomp == "+" ? .keep : .clip)
-                )
-                result[key] = text
-                index = endIdx
-                continue
-            }
-
-            if afterColon.isEmpty {
-                // Value lives on the next non-blank, non-comment line(s).
-                // Skip blank and comment lines so a stylistic blank line
-                // between `key:` and its block doesn't trick the parser
-                // into seeing an object where the user wrote an array.
-                index += 1
-                while index < lines.count {
-                    let scanTrim = lines[index].trimmingCharacters(in: .whitespaces)
-                    if scanTrim.isEmpty || scanTrim.hasPrefix("#") {
-                        index += 1
-                    } else {
-                        break
-                    }
-                }
-                if index < lines.count {
-                    let nextLine = lines[index]
-                    let nextIndent = nextLine.prefix(while: { $0 == " " }).count
-                    if nextLine.trimmingCharacters(in: .whitespaces).hasPrefix("- ") {
-                        let (arr, endIdx) = parseYAMLArray(lines, startIndex: index, indent: nextIndent)
-                        result[key] = arr
-                        index = endIdx
-                    } else {
-                        let (obj, endIdx) = parseYAMLObject(lines, startIndex: index, indent: nextIndent)
-                        result[key] = obj
-                        index = endIdx
-                    }
-                }
-            } else {
-                result[key] = parseYAMLScalar(afterColon)
-                index += 1
-            }
-        }
-
-        return (result, index)
-    }
-
-    private enum YAMLChomp { case strip, clip, keep }
-
-    /// Collect a block scalar body. `parentIndent` is the indent of the key
-    /// line whose value this block is; the block ends as soon as a non-empty
-    /// line is found at parentIndent or less.
-    private static func parseYAMLBlockScalar(
-        _ lines: [String],
-        startIndex: Int,
-        parentIndent: Int,
-        folded: Bool,
-        chomp: YAMLChomp
-    ) -> (value: String, endIndex: Int) {
-        var collected: [String] = []
-        var index = startIndex
-        var blockIndent: Int? = nil
-
-        while index < lines.count {
-            let line = lines[index]
-            let trimmed = line.trimmingCharacters(in: .whitespaces)
-            if trimmed.isEmpty {
-                collected.append("")
-                index += 1
-                continue
-            }
-            let pIndent = line.prefix(while: { $0 == " " }).count
-            if pIndent <= parentIndent { break }
-            if blockIndent == nil { blockIndent = pIndent }
-            let strip = min(blockIndent ?? pIndent, pIndent)
-            collected.append(String(line.dropFirst(strip)))
-            index += 1
-        }
-
-        // Trim trailing empties that were collected past the real end.
-        while index < lines.count {
-            // safety no-op; placeholder
-            break
-        }
-
-        // Drop trailing blank lines that came after the last non-blank.
-        var lastNonBlank = collected.count
-        while lastNonBlank > 0 && collected[lastNonBlank - 1].isEmpty {
-            lastNonBlank -= 1
-        }
-
-        let body: String
-        if folded {
-            // Folded: single newlines become spaces, blank lines stay as newlines.
-            var pieces: [String] = []
-            var current = ""
-            for i in 0..<lastNonBlank {
-                let line = collected[i]
-                if line.isEmpty {
-                    pieces.append(current)
-                    pieces.append("")
-                    current = ""
-                } else if current.isEmpty {
-                    current = line
-                } else {
-                    current += " " + line
-                }
-            }
-            pieces.append(current)
-            body = pieces.joined(separator: "\n")
-        } else {
-            body = collected.prefix(lastNonBlank).joined(separator: "\n")
-        }
-
-        switch chomp {
-        case .strip:
-            return (body, index)
-        case .clip:
-            return (body.isEmpty ? body : body + "\n", index)
-        case .keep:
-            // Re-append every trailing blank we trimmed.
-            let trailing = collected.count - lastNonBlank
-            return (body + String(repeating: "\n", count: trailing + (body.isEmpty ? 0 : 1)), index)
-        }
-    }
-
-    private static func parseYAMLScalar(_ value: String) -> any Sendable {
-        let trimmed = value.trimmingCharacters(in: .whitespaces)
-
-        // Boolean
-        if trimmed == "true" || trimmed == "True" || trimmed == "TRUE" {
-            return true
-        }
-        if trimmed == "false" || trimmed == "False" || trimmed == "FALSE" {
-            return false
-        }
-
-        // Null
-        if trimmed == "null" || trimmed == "~" || trimmed.isEmpty {
-            return ""
-        }
-
-        // Number
-        if let intValue = Int(trimmed) {
-            return intValue
-        }
-        if let doubleValue = Double(trimmed) {
-            return doubleValue
-        }
-
-        // Double-quoted string: process YAML escape sequences
-        if trimmed.count >= 2 && trimmed.hasPrefix("\"") && trimmed.hasSuffix("\"") {
-            let body = String(trimmed.dropFirst().dropLast())
-            return unescapeDoubleQuotedYAML(body)
-        }
-
-        // Single-quoted string: only `''` -> `'` is significant
-        if trimmed.count >= 2 && trimmed.hasPrefix("'") && trimmed.hasSuffix("'") {
-            let body = String(trimmed.dropFirst().dropLast())
-            return body.replacingOccurrences(of: "''", with: "'")
-        }
-
-        return trimmed
-    }
-
-    private static func unescapeDoubleQuotedYAML(_ s: String) -> String {
-        var out = ""
-        out.reserveCapacity(s.count)
-        var iter = s.makeIterator()
-        while let ch = iter.next() {
-            if ch != "\\" { out.append(ch); continue }
-            guard let esc = iter.next() else { out.append("\\"); break }
-            switch esc {
-            case "n":  out.append("\n")
-            case "t":  out.append("\t")
-            case "r":  out.append("\r")
-            case "0":  out.append("\u{0}")
-            case "\"": out.append("\"")
-            case "'":  out.append("'")
-            case "\\": out.append("\\")
-            case "/":  out.append("/")
-            case "a":  out.append("\u{07}")
-            case "b":  out.append("\u{08}")
-            case "f":  out.append("\u{0C}")
-            case "v":  out.append("\u{0B}")
-            case "e":  out.append("\u{1B}")
-            case " ":  out.append(" ")
-            default:   out.append("\\"); out.append(esc)
-            }
-        }
-        return out
+        YAMLParser.parse(content)
     }
 
     // MARK: - XML Deserialization
 
+    /// Parse with `XMLTreeBuilder`; content that is not well-formed XML
+    /// is returned unchanged.
     private static func deserializeXML(_ content: String) -> any Sendable {
-        // Simple XML parser
-        let stripped = content.replacingOccurrences(
-            of: "<\\?xml[^>]*\\?>",
-            with: "",
-            options: .regularExpression
-        ).trimmingCharacters(in: .whitespacesAndNewlines)
-
-        if let parsed = parseXMLElement(stripped) {
-            return convertAnyToSendable(parsed)
-        }
-        return content
-    }
-
-    private static func convertAnyToSendable(_ value: Any) -> any Sendable {
-        switch value {
-        case let str as String:
-            return str
-        case let int as Int:
-            return int
-        case let double as Double:
-            return double
-        case let bool as Bool:
-            return bool
-        case let array as [Any]:
-            return array.map { convertAnyToSendable($0) }
-        case let dict as [String: Any]:
-            var result: [String: any Sendable] = [:]
-            for (key, val) in dict {
-                result[key] = convertAnyToSendable(val)
-            }
-            return result
-        case let sendable as (any Sendable):
-            return sendable
-        default:
-            return String(describing: value)
-        }
-    }
-
-    private static func parseXMLElement(_ content: String) -> Any? {
-        // Find the root element
-        guard let startTagMatch = content.range(of: "<([a-zA-Z][a-zA-Z0-9_-]*)>", options: .regularExpression) else {
-            return nil
-        }
-
-        let tagContent = String(content[startTagMatch])
-        let tagName = String(tagContent.dropFirst().dropLast())
-
-        // Find closing tag
-        let closingTag = "</\(tagName)>"
-        guard let closingRange = content.range(of: closingTag) else {
-            return nil
-        }
-
-        let innerContent = String(content[startTagMatch.upperBound..<closingRange.lowerBound])
-            .trimmingCharacters(in: .whitespacesAndNewlines)
-
-        // Check if inner content contains child elements
-        if innerContent.contains("<") {
-            // Parse child elements
-            var children: [String: Any] = [:]
-            var items: [Any] = []
-            var remaining = innerContent
-
-            while let childStart = remaining.range(of: "<([a-zA-Z][a-zA-Z0-9_-]*)>", options: .regularExpression) {
-                let childTagContent = String(remaining[childStart])
-                let childTagName = String(childTagContent.dropFirst().dropLast())
-                let childClosing = "</\(childTagName)>"
-
-                guard let childEnd = remaining.range(of: childClosing) else { break }
-
-                let childInner = String(remaining[childStart.upperBound..<childEnd.lowerBound])
-                    .trimmingCharacters(in: .whitespacesAndNewlines)
-
-                let childValue: Any
-                if childInner.contains("<") {
-                    childValue = parseXMLElement("<\(childTagName)>" + childInner + "</\(childTagName)>") ?? childInner
-                } else {
-                    childValue = parseXMLScalar(childInner)
-                }
-
-                if childTagName == "item" {
-                    items.append(childValue)
-                } else if let existing = children[childTagName] {
-                    // Multiple elements with same name -> array
-                    if var arr = existing as? [Any] {
-                        arr.append(childValue)
-                        children[childTagName] = arr
-                    } else {
-                        children[childTagName] = [existing, childValue]
-                    }
-                } else {
-                    children[childTagName] = childValue
-                }
-
-                remaining = String(remaining[childEnd.upperBound...])
-            }
-
-            if !items.isEmpty {
-                return items.map { item -> any Sendable in
-                    if let dict = item as? [String: Any] {
-                        return convertXMLToSendable(dict)
-                    }
-                    return convertAnyToSendable(item)
-                }
-            }
-            return convertXMLToSendable(children)
-        } else {
-            // Leaf element
-            return parseXMLScalar(innerContent)
-        }
-    }
-
-    private static func convertXMLToSendable(_ dict: [String: Any]) -> [String: any Sendable] {
-        var result: [String: any Sendable] = [:]
-        for (key, value) in dict {
-            if let nestedDict = value as? [String: Any] {
-                result[key] = convertXMLToSendable(nestedDict)
-            } else if let arr = value as? [Any] {
-                result[key] = arr.map { item -> any Sendable in
-                    if let d = item as? [String: Any] {
-                        return convertXMLToSendable(d)
-                    }
-                    return convertAnyToSendable(item)
-                }
-            } else {
-                result[key] = convertAnyToSendable(value)
-            }
-        }
-        return result
-    }
-
-    private static func parseXMLScalar(_ value: String) -> any Sendable {
-        let unescaped = unescapeXML(value)
-
-        if let intValue = Int(unescaped) {
-            return intValue
-        }
-        if let doubleValue = Double(unescaped) {
-            return doubleValue
-        }
-        if unescaped == "true" { return true }
-        if unescaped == "false" { return false }
-        return unescaped
+        (try? XMLTreeBuilder.parse(content)) ?? content
     }
 
     // MARK: - TOML Deserialization
@@ -1065,26 +576,6 @@ public struct FormatDeserializer: Sendable {
 
     // MARK: - Single-pass unescape functions (O(n) instead of O(n*m))
 
-    private static func unescapeXML(_ str: String) -> String {
-        guard str.contains("&") else { return str }
-        var result = ""
-        result.reserveCapacity(str.count)
-        var i = str.startIndex
-        while i < str.endIndex {
-            if str[i] == "&" {
-                let rest = str[i...]
-                if rest.hasPrefix("&amp;")  { result += "&";  i = str.index(i, offsetBy: 5); continue }
-                if rest.hasPrefix("&lt;")   { result += "<";  i = str.index(i, offsetBy: 4); continue }
-                if rest.hasPrefix("&gt;")   { result += ">";  i = str.index(i, offsetBy: 4); continue }
-                if rest.hasPrefix("&quot;") { result += "\""; i = str.index(i, offsetBy: 6); continue }
-                if rest.hasPrefix("&apos;") { result += "'";  i = str.index(i, offsetBy: 6); continue }
-            }
-            result.append(str[i])
-            i = str.index(after: i)
-        }
-        return result
-    }
-
     private static func unescapeTOML(_ str: String) -> String {
         guard str.contains("\\") else { return str }
         var result = ""
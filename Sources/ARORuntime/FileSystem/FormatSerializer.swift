@@ -102,7 +102,7 @@ public struct FormatSerializer: Sendable {
     }
 
     /// Build JSON string manually for types that JSONSerialization can't handle
-    private static func buildJSONManually(_ value: any Sendable) -> String {
+    static func buildJSONManually(_ value: any Sendable) -> String {
         switch value {
         case let str as String:
             return "\"\(escapeJSON(str))\""
@@ -175,18 +175,22 @@ public struct FormatSerializer: Sendable {
     }
 
     private static func serializeJSONCompact(_ value: any Sendable) -> String {
+        String(data: jsonCompactData(value), encoding: .utf8) ?? "{}"
+    }
+
+    /// One value as compact JSON bytes (a JSONL line without its newline)
+    static func jsonCompactData(_ value: any Sendable) -> Data {
         let jsonValue = convertToJSONSerializable(value)
         do {
-            let data = try JSONSerialization.data(
+            return try JSONSerialization.data(
                 withJSONObject: jsonValue,
                 options: [.sortedKeys]  // No prettyPrinted - compact output
             )
-            return String(data: data, encoding: .utf8) ?? "{}"
         } catch {
             if let str = value as? String {
-                return "\"\(escapeJSON(str))\""
+                return Data("\"\(escapeJSON(str))\"".utf8)
             }
-            return String(describing: value)
+            return Data(String(describing: value).utf8)
         }
     }
 
@@ -555,7 +559,7 @@ public struct FormatSerializer: Sendable {
         return "INSERT INTO \(tableName) (\(columnList)) VALUES (\(valueList));"
     }
 
-    private static func serializeSQLValue(_ value: any Sendable) -> String {
+    static func serializeSQLValue(_ value: any Sendable) -> String {
         switch value {
         case let str as String:
             return "'\(escapeSQL(str))'"
@@ -601,7 +605,7 @@ public struct FormatSerializer: Sendable {
         }
     }
 
-    private static func logStringValue(_ value: any Sendable) -> String {
+    static func logStringValue(_ value: any Sendable) -> String {
         switch value {
         case let str as String:
             return str
@@ -690,7 +694,7 @@ public struct FormatSerializer: Sendable {
 
     // MARK: - Helper Methods
 
-    private static func convertToJSONSerializable(_ value: any Sendable) -> Any {
+    static func convertToJSONSerializable(_ value: any Sendable) -> Any {
         switch value {
         case let str as String:
             return str
@@ -749,7 +753,7 @@ public struct FormatSerializer: Sendable {
         }
     }
 
-    private static func stringValue(_ value: any Sendable) -> String {
+    static func stringValue(_ value: any Sendable) -> String {
         switch value {
         case let str as String:
             return str
@@ -768,7 +772,7 @@ public struct FormatSerializer: Sendable {
 
     // MARK: - Single-pass escape functions (O(n) instead of O(n*m))
 
-    private static func escapeJSON(_ str: String) -> String {
+    static func escapeJSON(_ str: String) -> String {
         var result = ""
         result.reserveCapacity(str.count + str.count / 8)
         for char in str {
@@ -815,7 +819,7 @@ public struct FormatSerializer: Sendable {
         return result
     }
 
-    private static func escapeCSV(_ str: String, delimiter: String, quoteChar: String = "\"") -> String {
+    static func escapeCSV(_ str: String, delimiter: String, quoteChar: String = "\"") -> String {
         let quoteCharacter = quoteChar.first ?? "\""
         let delimCharacter = delimiter.first
         var needsQuoting = false
@@ -0,0 +1,440 @@
+// FormatWriter.swift - ARO-0040: Format-Aware File I/O
+// Incremental writers for record-oriented formats
+//
+// FormatSerializer renders a whole value into one String, which for a
+// million-row CSV, JSONL or SQL file means holding the complete text
+// in memory before anything reaches disk. A FormatWriter renders one
+// record at a time into a buffered FileSink instead, so memory stays
+// proportional to one record (or one SQL batch). Output is the same,
+// byte for byte, as serializing the records as one array, except that
+// SQL rows can be batched into multi-row INSERT statements and log
+// lines are stamped when they are written.
+
+import Foundation
+
+// MARK: - File Sink
+
+/// Buffered output file for `FormatWriter`s.
+///
+/// Bytes are collected in a fixed-size buffer and handed to the file
+/// when it fills, so a record costs a copy rather than a system call.
+/// A new file is written to a temporary sibling and moved into place by
+/// `close()`, so readers never see it half written; an append goes
+/// straight to the end of the existing file.
+public final class FileSink {
+    /// Destination path
+    public let path: String
+
+    /// Bytes passed to the sink so far
+    public private(set) var bytesWritten = 0
+
+    private let handle: FileHandle
+    private let temporaryPath: String?
+    private let capacity: Int
+    private var buffer: [UInt8] = []
+    private var isClosed = false
+
+    /// Open `path` for writing, replacing it unless `append` is set
+    public init(path: String, append: Bool = false, capacity: Int = 1 << 16) throws {
+        let fileManager = FileManager.default
+        let url = URL(fileURLWithPath: path)
+        let directory = url.deletingLastPathComponent()
+        if !fileManager.fileExists(atPath: directory.path) {
+            try fileManager.createDirectory(at: directory, withIntermediateDirectories: true)
+        }
+
+        let target = append ? path : "\(path).\(UUID().uuidString).tmp"
+        if !append || !fileManager.fileExists(atPath: target) {
+            guard fileManager.createFile(atPath: target, contents: nil) else {
+                throw FileSystemError.writeError(path, "cannot create file")
+            }
+        }
+        guard let handle = FileHandle(forWritingAtPath: target) else {
+            throw FileSystemError.writeError(path, "cannot open file for writing")
+        }
+        if append {
+            do {
+                try handle.seekToEnd()
+            } catch {
+                try? handle.close()
+                throw FileSystemError.writeError(path, error.localizedDescription)
+            }
+        }
+
+        self.path = path
+        self.handle = handle
+        self.temporaryPath = append ? nil : target
+        self.capacity = capacity
+        buffer.reserveCapacity(capacity)
+    }
+
+    deinit {
+        if !isClosed {
+            discard()
+        }
+    }
+
+    public func write(_ string: String) throws {
+        buffer.append(contentsOf: string.utf8)
+        bytesWritten += string.utf8.count
+        if buffer.count >= capacity {
+            try flush()
+        }
+    }
+
+    public func write(_ data: Data) throws {
+        buffer.append(contentsOf: data)
+        bytesWritten += data.count
+        if buffer.count >= capacity {
+            try flush()
+        }
+    }
+
+    /// Hand the buffered bytes to the file
+    public func flush() throws {
+        guard !buffer.isEmpty else { return }
+        do {
+            try buffer.withUnsafeBytes { try handle.write(contentsOf: $0) }
+        } catch {
+            throw FileSystemError.writeError(path, error.localizedDescription)
+        }
+        buffer.removeAll(keepingCapacity: true)
+    }
+
+    /// Flush, close and (for a new file) move it into place
+    public func close() throws {
+        guard !isClosed else { return }
+        isClosed = true
+        do {
+            try flush()
+            try handle.close()
+            if let temporaryPath {
+                let fileManager = FileManager.default
+                let destination = URL(fileURLWithPath: path)
+                let source = URL(fileURLWithPath: temporaryPath)
+                if fileManager.fileExists(atPath: path) {
+                    _ = try fileManager.replaceItemAt(destination, withItemAt: source)
+                } else {
+                    try fileManager.moveItem(at: source, to: destination)
+                }
+            }
+        } catch {
+            if let temporaryPath {
+                try? FileManager.default.removeItem(atPath: temporaryPath)
+            }
+            if let error = error as? FileSystemError {
+                throw error
+            }
+            throw FileSystemError.writeError(path, error.localizedDescription)
+        }
+    }
+
+    /// Close without publishing: a new file is removed, an append keeps
+    /// what was already flushed
+    public func discard() {
+        guard !isClosed else { return }
+        isClosed = true
+        try? handle.close()
+        if let temporaryPath {
+            try? FileManager.default.removeItem(atPath: temporaryPath)
+        }
+    }
+}
+
+// MARK: - Format Writer
+
+/// Writes the records of one format incrementally into a `FileSink`
+public protocol FormatWriter {
+    /// Write one record
+    mutating func write(_ record: any Sendable) throws
+
+    /// Write whatever the format needs after the last record
+    mutating func finish() throws
+}
+
+extension FormatSerializer {
+
+    /// A streaming writer for `format`, or nil if the format is only
+    /// serialized whole. With `continuing` the output extends a
+    /// non-empty file: no CSV header, a line break before the first
+    /// record, and no writer for JSON, which cannot be extended.
+    public static func writer(
+        for format: FileFormat,
+        sink: FileSink,
+        variableName: String,
+        options: [String: any Sendable] = [:],
+        continuing: Bool = false
+    ) -> (any FormatWriter)? {
+        switch format {
+        case .csv, .tsv:
+            return CSVWriter(
+                sink: sink,
+                delimiter: (options["delimiter"] as? String) ?? (format == .tsv ? "\t" : ","),
+                includeHeader: !continuing && ((options["header"] as? Bool) ?? true),
+                quoteChar: (options["quote"] as? String) ?? "\"",
+                continuing: continuing
+            )
+        case .jsonl:
+            return JSONLWriter(sink: sink, continuing: continuing)
+        case .json:
+            return continuing ? nil : JSONArrayWriter(sink: sink)
+        case .sql:
+            return SQLWriter(
+                sink: sink,
+                tableName: variableName,
+                batchSize: (options["batch"] as? Int) ?? SQLWriter.defaultBatchSize,
+                continuing: continuing
+            )
+        case .log:
+            return LogWriter(sink: sink, continuing: continuing)
+        default:
+            return nil
+        }
+    }
+
+    /// Whether `writer(for:...)` has a writer for `format`
+    public static func canStream(_ format: FileFormat, continuing: Bool = false) -> Bool {
+        switch format {
+        case .csv, .tsv, .jsonl, .sql, .log: return true
+        case .json: return !continuing
+        default: return false
+        }
+    }
+
+    /// Drain `records` into `path`. The file is replaced unless `append`
+    /// is set; an incomplete new file is removed if the stream fails.
+    public static func write(
+        _ records: AROStream<any Sendable>,
+        to path: String,
+        format: FileFormat,
+        variableName: String,
+        options: [String: any Sendable] = [:],
+        append: Bool = false
+    ) async throws {
+        let continuing = append && ((try? FileManager.default.attributesOfItem(atPath: path)[.size] as? Int) ?? 0) > 0
+        let sink = try FileSink(path: path, append: append)
+        guard var writer = Self.writer(for: format, sink: sink, variableName: variableName,
+                                       options: options, continuing: continuing) else {
+            sink.discard()
+            throw FileSystemError.writeError(path, "\(format.rawValue) output cannot be written as a stream")
+        }
+        do {
+            for try await record in records.stream {
+                try writer.write(record)
+            }
+            try writer.finish()
+            try sink.close()
+        } catch {
+            sink.discard()
+            throw error
+        }
+    }
+}
+
+// MARK: - Writers
+
+/// Writes records as newline-separated lines, with no newline after the
+/// last one (the shape of the joined serializer output)
+private struct LineSeparator {
+    var pending: Bool
+
+    mutating func write(to sink: FileSink) throws {
+        if pending {
+            try sink.write("\n")
+        }
+        pending = true
+    }
+}
+
+/// CSV/TSV rows. The columns are the sorted keys of the first record;
+/// if that record is not an object, every record becomes one column.
+public struct CSVWriter: FormatWriter {
+    private let sink: FileSink
+    private let delimiter: String
+    private let includeHeader: Bool
+    private let quoteChar: String
+    private var separator: LineSeparator
+    private var headers: [String]?
+    private var singleColumn = false
+    private var started = false
+
+    public init(sink: FileSink, delimiter: String = ",", includeHeader: Bool = true,
+                quoteChar: String = "\"", continuing: Bool = false) {
+        self.sink = sink
+        self.delimiter = delimiter
+        self.includeHeader = includeHeader
+        self.quoteChar = quoteChar
+        self.separator = LineSeparator(pending: continuing)
+    }
+
+    public mutating func write(_ record: any Sendable) throws {
+        if !started {
+            started = true
+            if let first = record as? [String: any Sendable] {
+                let keys = first.keys.sorted()
+                headers = keys
+                if includeHeader {
+                    try separator.write(to: sink)
+                    try sink.write(keys.map { escape($0) }.joined(separator: delimiter))
+                }
+            } else {
+                singleColumn = true
+            }
+        }
+
+        if singleColumn {
+            try separator.write(to: sink)
+            try sink.write(escape(String(describing: record)))
+            return
+        }
+        guard let headers, let dict = record as? [String: any Sendable] else { return }
+        try separator.write(to: sink)
+        for (index, key) in headers.enumerated() {
+            if index > 0 {
+                try sink.write(delimiter)
+            }
+            if let value = dict[key] {
+                try sink.write(escape(FormatSerializer.stringValue(value)))
+            }
+        }
+    }
+
+    public mutating func finish() throws {}
+
+    private func escape(_ field: String) -> String {
+        FormatSerializer.escapeCSV(field, delimiter: delimiter, quoteChar: quoteChar)
+    }
+}
+
+/// JSON Lines: one compact JSON value per line
+public struct JSONLWriter: FormatWriter {
+    private let sink: FileSink
+    private var separator: LineSeparator
+
+    public init(sink: FileSink, continuing: Bool = false) {
+        self.sink = sink
+        self.separator = LineSeparator(pending: continuing)
+    }
+
+    public mutating func write(_ record: any Sendable) throws {
+        try separator.write(to: sink)
+        try sink.write(FormatSerializer.jsonCompactData(record))
+    }
+
+    public mutating func finish() throws {}
+}
+
+/// A pretty-printed JSON array, one element at a time
+public struct JSONArrayWriter: FormatWriter {
+    private let sink: FileSink
+    private var count = 0
+
+    public init(sink: FileSink) {
+        self.sink = sink
+    }
+
+    public mutating func write(_ record: any Sendable) throws {
+        try sink.write(count == 0 ? "[\n" : ",\n")
+        count += 1
+
+        let data: Data
+        do {
+            data = try JSONSerialization.data(
+                withJSONObject: FormatSerializer.convertToJSONSerializable(record),
+                options: [.prettyPrinted, .sortedKeys, .fragmentsAllowed]
+            )
+        } catch {
+            data = Data(FormatSerializer.buildJSONManually(record).utf8)
+        }
+
+        // Indent the element one level; JSON strings never contain a raw
+        // newline, so every newline byte is a line break
+        var indented: [UInt8] = [0x20, 0x20]
+        indented.reserveCapacity(data.count + data.count / 8)
+        var previous: UInt8 = 0
+        for byte in data {
+            if previous == 0x0A && byte != 0x0A {
+                indented.append(0x20)
+                indented.append(0x20)
+            }
+            indented.append(byte)
+            previous = byte
+        }
+        try sink.write(Data(indented))
+    }
+
+    public mutating func finish() throws {
+        if count == 0 {
+            try sink.write(FormatSerializer.serialize([] as [any Sendable], format: .json, variableName: ""))
+        } else {
+            try sink.write("\n]")
+        }
+    }
+}
+
+/// SQL INSERT statements. Consecutive rows with the same columns share
+/// one multi-row statement of up to `batchSize` rows; a batch size of 1
+/// gives one statement per row. Records that are not objects are skipped.
+public struct SQLWriter: FormatWriter {
+    public static let defaultBatchSize = 500
+
+    private let sink: FileSink
+    private let tableName: String
+    private let batchSize: Int
+    private var separator: LineSeparator
+    private var columns: [String] = []
+    private var rows: [String] = []
+
+    public init(sink: FileSink, tableName: String, batchSize: Int = SQLWriter.defaultBatchSize,
+                continuing: Bool = false) {
+        self.sink = sink
+        self.tableName = tableName
+        self.batchSize = max(1, batchSize)
+        self.separator = LineSeparator(pending: continuing)
+    }
+
+    public mutating func write(_ record: any Sendable) throws {
+        guard let dict = record as? [String: any Sendable] else { return }
+        let keys = dict.keys.sorted()
+        if keys != columns || rows.count >= batchSize {
+            try flushBatch()
+            columns = keys
+        }
+        let values = keys.map { FormatSerializer.serializeSQLValue(dict[$0]!) }
+        rows.append("(\(values.joined(separator: ", ")))")
+    }
+
+    public mutating func finish() throws {
+        try flushBatch()
+    }
+
+    private mutating func flushBatch() throws {
+        guard !rows.isEmpty else { return }
+        try separator.write(to: sink)
+        try sink.write("INSERT INTO \(tableName) (\(columns.joined(separator: ", "))) VALUES ")
+        try sink.write(rows.joined(separator: ", "))
+        try sink.write(";")
+        rows.removeAll(keepingCapacity: true)
+    }
+}
+
+/// Log lines: `timestamp: message`, each stamped as it is written
+public struct LogWriter: FormatWriter {
+    private let sink: FileSink
+    private let now: () -> Date
+    private let dateFormatter = ISO8601DateFormatter()
+    private var separator: LineSeparator
+
+    public init(sink: FileSink, continuing: Bool = false, now: @escaping () -> Date = Date.init) {
+        self.sink = sink
+        self.now = now
+        self.separator = LineSeparator(pending: continuing)
+    }
+
+    public mutating func write(_ record: any Sendable) throws {
+        try separator.write(to: sink)
+        try sink.write("\(dateFormatter.string(from: now())): \(FormatSerializer.logStringValue(record))")
+    }
+
+    public mutating func finish() throws {}
+}
@@ -0,0 +1,609 @@
+// XMLTokenizer.swift - ARO-0040: Format-Aware File I/O
+// Single-pass XML tokenizer and value builder
+//
+// The previous deserializer located each tag with a regular expression
+// and re-parsed a copy of every element's inner text one level down,
+// so the work grew with depth and document size. `XMLTokenizer` walks
+// the UTF-8 bytes once and reports start tags, end tags and text;
+// `XMLTreeBuilder` turns those events into ARO values as elements
+// close, so no substring is copied more than once.
+//
+// Value shape (unchanged for documents without attributes):
+//   - the root element's value is the document's value
+//   - a leaf element is a scalar (Int, Double, Bool or String)
+//   - child elements are keyed by local name; repeated names collect
+//     into a list in document order
+//   - an element whose only children are <item> is a list
+//   - attributes are keyed "@name", and text next to child elements or
+//     attributes is kept under "#text"
+//
+// CDATA text is kept verbatim and never converted to a number. The
+// predefined and numeric character references are decoded; any other
+// `&` is kept as written. Namespace prefixes are resolved (unbound
+// prefixes are an error) and values are keyed by local name.
+
+import Foundation
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// An XML document that is not well-formed.
+public struct XMLSyntaxError: Error, Equatable, CustomStringConvertible {
+    public let message: String
+    /// 1-based line and column of the problem
+    public let line: Int
+    public let column: Int
+
+    public var description: String {
+        "line \(line), column \(column): \(message)"
+    }
+}
+
+/// A namespace-resolved element or attribute name
+struct XMLName: Sendable, Equatable {
+    let localName: String
+    /// URI bound to the name's prefix (or the default namespace)
+    let namespace: String?
+}
+
+/// One tokenizer event
+enum XMLEvent {
+    case startElement(XMLName, attributes: [(name: XMLName, value: String)])
+    case endElement(XMLName)
+    case text(String, isCDATA: Bool)
+}
+
+// MARK: - XMLTokenizer
+
+/// Pull tokenizer over a UTF-8 buffer. The buffer must outlive it.
+struct XMLTokenizer {
+    private static let xmlNamespace = "http://www.w3.org/XML/1998/namespace"
+
+    private let base: UnsafePointer<UInt8>
+    private let count: Int
+    private var position = 0
+
+    /// Byte range of each open element's qualified name, for matching
+    /// end tags without building strings
+    private var open: [(raw: Range<Int>, name: XMLName)] = []
+    /// In-scope namespace bindings, innermost last ("" is the default)
+    private var bindings: [(prefix: String, uri: String)] = []
+    /// `bindings.count` when each open element started
+    private var scopes: [Int] = []
+    /// End event owed for a self-closing tag
+    private var pendingEnd: XMLName?
+    private var sawRoot = false
+
+    init(_ buffer: UnsafeBufferPointer<UInt8>) {
+        self.base = buffer.baseAddress ?? UnsafePointer(bitPattern: 1)!
+        self.count = buffer.count
+        if count >= 3 && base[0] == 0xEF && base[1] == 0xBB && base[2] == 0xBF {
+            position = 3
+        }
+    }
+
+    /// Next event, or nil after the root element has closed and only
+    /// comments, processing instructions and whitespace follow.
+    mutating func next() throws -> XMLEvent? {
+        if let name = pendingEnd {
+            pendingEnd = nil
+            closeScope()
+            return .endElement(name)
+        }
+
+        while position < count {
+            guard base[position] == UInt8(ascii: "<") else {
+                let start = position
+                position = find(UInt8(ascii: "<"), from: start) ?? count
+                if open.isEmpty {
+                    guard isWhitespace(start..<position) else {
+                        throw fail(sawRoot ? "content after the root element" : "text before the root element", at: start)
+                    }
+                    continue
+                }
+                return .text(decodeText(start..<position, normalizeSpace: false), isCDATA: false)
+            }
+
+            if hasPrefix("<!--") {
+                guard let end = find("-->", from: position + 4) else {
+                    throw fail("unterminated comment")
+                }
+                position = end + 3
+            } else if hasPrefix("<![CDATA[") {
+                guard !open.isEmpty else {
+                    throw fail("CDATA outside the root element")
+                }
+                let start = position + 9
+                guard let end = find("]]>", from: start) else {
+                    throw fail("unterminated CDATA section")
+                }
+                position = end + 3
+                return .text(string(start..<end), isCDATA: true)
+            } else if hasPrefix("<?") {
+                guard let end = find("?>", from: position + 2) else {
+                    throw fail("unterminated processing instruction")
+                }
+                position = end + 2
+            } else if hasPrefix("<!DOCTYPE") {
+                guard !sawRoot else {
+                    throw fail("DOCTYPE after the root element")
+                }
+                try skipDoctype()
+            } else if hasPrefix("</") {
+                return try endTag()
+            } else {
+                return try startTag()
+            }
+        }
+
+        if let innermost = open.last {
+            throw fail("unclosed element <\(string(innermost.raw))>")
+        }
+        guard sawRoot else {
+            throw fail("no root element")
+        }
+        return nil
+    }
+
+    // MARK: - Tags
+
+    private mutating func startTag() throws -> XMLEvent {
+        let tagStart = position
+        if sawRoot && open.isEmpty {
+            throw fail("content after the root element")
+        }
+        position += 1
+        let raw = try scanName()
+
+        var rawAttributes: [(raw: Range<Int>, value: String)] = []
+        var selfClosing = false
+        while true {
+            let hadSpace = skipWhitespace()
+            guard position < count else {
+                throw fail("unterminated start tag", at: tagStart)
+            }
+            if base[position] == UInt8(ascii: ">") {
+                position += 1
+                break
+            }
+            if hasPrefix("/>") {
+                position += 2
+                selfClosing = true
+                break
+            }
+            guard hadSpace else {
+                throw fail("expected whitespace before attribute")
+            }
+            let nameStart = position
+            let name = try scanName()
+            if rawAttributes.contains(where: { equal($0.raw, name) }) {
+                throw fail("duplicate attribute '\(string(name))'", at: nameStart)
+            }
+            skipWhitespace()
+            guard position < count, base[position] == UInt8(ascii: "=") else {
+                throw fail("expected '=' after attribute name")
+            }
+            position += 1
+            skipWhitespace()
+            guard position < count, base[position] == UInt8(ascii: "\"") || base[position] == UInt8(ascii: "'") else {
+                throw fail("expected a quoted attribute value")
+            }
+            let quote = base[position]
+            let valueStart = position + 1
+            guard let valueEnd = find(quote, from: valueStart) else {
+                throw fail("unterminated attribute value")
+            }
+            if let lt = find(UInt8(ascii: "<"), from: valueStart, to: valueEnd) {
+                throw fail("'<' in attribute value", at: lt)
+            }
+            position = valueEnd + 1
+            rawAttributes.append((raw: name, value: decodeText(valueStart..<valueEnd, normalizeSpace: true)))
+        }
+
+        // Declarations first, so they apply to this element's own names
+        scopes.append(bindings.count)
+        var attributes: [(name: XMLName, value: String)] = []
+        for attribute in rawAttributes {
+            if equal(attribute.raw, "xmlns") {
+                bindings.append((prefix: "", uri: attribute.value))
+            } else if hasPrefix("xmlns:", at: attribute.raw.lowerBound) {
+                let prefix = string(attribute.raw.lowerBound + 6..<attribute.raw.upperBound)
+                bindings.append((prefix: prefix, uri: attribute.value))
+            }
+        }
+        for attribute in rawAttributes where !isNamespaceDeclaration(attribute.raw) {
+            try attributes.append((name: resolve(attribute.raw, isAttribute: true), value: attribute.value))
+        }
+
+        let name = try resolve(raw, isAttribute: false)
+        open.append((raw: raw, name: name))
+        sawRoot = true
+        if selfClosing {
+            open.removeLast()
+            pendingEnd = name
+        }
+        return .startElement(name, attributes: attributes)
+    }
+
+    private mutating func endTag() throws -> XMLEvent {
+        let tagStart = position
+        position += 2
+        let raw = try scanName()
+        skipWhitespace()
+        guard position < count, base[position] == UInt8(ascii: ">") else {
+            throw fail("expected '>' to end the tag")
+        }
+        position += 1
+        guard let innermost = open.last else {
+            throw fail("unexpected </\(string(raw))>", at: tagStart)
+        }
+        guard equal(innermost.raw, raw) else {
+            throw fail("expected </\(string(innermost.raw))>, found </\(string(raw))>", at: tagStart)
+        }
+        open.removeLast()
+        closeScope()
+        return .endElement(innermost.name)
+    }
+
+    private mutating func closeScope() {
+        if let mark = scopes.popLast() {
+            bindings.removeSubrange(mark...)
+        }
+    }
+
+    /// Skip `<!DOCTYPE ...>` including an internal subset
+    private mutating func skipDoctype() throws {
+        let start = position
+        var inSubset = false
+        position += 9
+        while position < count {
+            let c = base[position]
+            if c == UInt8(ascii: "\"") || c == UInt8(ascii: "'") {
+                guard let end = find(c, from: position + 1) else { break }
+                position = end + 1
+                continue
+            }
+            position += 1
+            if c == UInt8(ascii: "[") {
+                inSubset = true
+            } else if c == UInt8(ascii: "]") {
+                inSubset = false
+            } else if c == UInt8(ascii: ">") && !inSubset {
+                return
+            }
+        }
+        throw fail("unterminated DOCTYPE", at: start)
+    }
+
+    // MARK: - Names
+
+    private mutating func scanName() throws -> Range<Int> {
+        let start = position
+        guard position < count, isNameStart(base[position]) else {
+            throw fail("expected a name")
+        }
+        position += 1
+        while position < count, isNameByte(base[position]) {
+            position += 1
+        }
+        return start..<position
+    }
+
+    private func isNamespaceDeclaration(_ raw: Range<Int>) -> Bool {
+        equal(raw, "xmlns") || hasPrefix("xmlns:", at: raw.lowerBound)
+    }
+
+    /// Split `prefix:local` and look the prefix up. Unprefixed attributes
+    /// have no namespace; unprefixed elements take the default one.
+    private func resolve(_ raw: Range<Int>, isAttribute: Bool) throws -> XMLName {
+        guard let colon = raw.first(where: { base[$0] == UInt8(ascii: ":") }) else {
+            if isAttribute {
+                return XMLName(localName: string(raw), namespace: nil)
+            }
+            let uri = bindings.last(where: { $0.prefix.isEmpty })?.uri
+            return XMLName(localName: string(raw), namespace: uri?.isEmpty == false ? uri : nil)
+        }
+        let prefix = string(raw.lowerBound..<colon)
+        let local = string(colon + 1..<raw.upperBound)
+        if prefix == "xml" {
+            return XMLName(localName: local, namespace: Self.xmlNamespace)
+        }
+        guard let uri = bindings.last(where: { $0.prefix == prefix })?.uri, !uri.isEmpty else {
+            throw fail("unbound namespace prefix '\(prefix)'", at: raw.lowerBound)
+        }
+        return XMLName(localName: local, namespace: uri)
+    }
+
+    // MARK: - Text
+
+    /// Decode character references in `range`. Attribute values also map
+    /// tab, CR and LF to spaces.
+    private func decodeText(_ range: Range<Int>, normalizeSpace: Bool) -> String {
+        if !normalizeSpace && find(UInt8(ascii: "&"), from: range.lowerBound, to: range.upperBound) == nil {
+            return string(range)
+        }
+
+        var out: [UInt8] = []
+        out.reserveCapacity(range.count)
+        var i = range.lowerBound
+        while i < range.upperBound {
+            let c = base[i]
+            if normalizeSpace && (c == 0x09 || c == 0x0A || c == 0x0D) {
+                out.append(0x20)
+                i += 1
+            } else if c == UInt8(ascii: "&"), let (scalar, length) = reference(at: i, end: range.upperBound) {
+                out.append(contentsOf: String(Character(scalar)).utf8)
+                i += length
+            } else {
+                out.append(c)
+                i += 1
+            }
+        }
+        return String(decoding: out, as: UTF8.self)
+    }
+
+    /// `&name;` or `&#...;` at `i`, with its length in bytes
+    private func reference(at i: Int, end: Int) -> (Unicode.Scalar, Int)? {
+        var semicolon = i + 1
+        while semicolon < end && semicolon - i <= 10 && base[semicolon] != UInt8(ascii: ";") {
+            semicolon += 1
+        }
+        guard semicolon < end, base[semicolon] == UInt8(ascii: ";") else { return nil }
+        let body = string(i + 1..<semicolon)
+        let length = semicolon + 1 - i
+
+        switch body {
+        case "amp": return ("&", length)
+        case "lt": return ("<", length)
+        case "gt": return (">", length)
+        case "quot": return ("\"", length)
+        case "apos": return ("'", length)
+        default: break
+        }
+        guard body.hasPrefix("#") else { return nil }
+        let code = body.hasPrefix("#x") ? UInt32(body.dropFirst(2), radix: 16) : UInt32(body.dropFirst(), radix: 10)
+        guard let code, let scalar = Unicode.Scalar(code) else { return nil }
+        return (scalar, length)
+    }
+
+    // MARK: - Scanning
+
+    private func string(_ range: Range<Int>) -> String {
+        String(decoding: UnsafeBufferPointer(start: base + range.lowerBound, count: range.count), as: UTF8.self)
+    }
+
+    /// First `byte` in `start..<end` (end of buffer by default)
+    private func find(_ byte: UInt8, from start: Int, to end: Int? = nil) -> Int? {
+        let end = end ?? count
+        guard start < end, let hit = memchr(base + start, Int32(byte), end - start) else { return nil }
+        return UnsafeRawPointer(base).distance(to: UnsafeRawPointer(hit))
+    }
+
+    private func find(_ needle: StaticString, from start: Int) -> Int? {
+        let length = needle.utf8CodeUnitCount
+        var from = start
+        while let at = find(needle.utf8Start[0], from: from) {
+            guard at + length <= count else { return nil }
+            if memcmp(base + at, needle.utf8Start, length) == 0 {
+                return at
+            }
+            from = at + 1
+        }
+        return nil
+    }
+
+    private func hasPrefix(_ literal: StaticString, at offset: Int? = nil) -> Bool {
+        let at = offset ?? position
+        let length = literal.utf8CodeUnitCount
+        return at + length <= count && memcmp(base + at, literal.utf8Start, length) == 0
+    }
+
+    private func equal(_ raw: Range<Int>, _ literal: StaticString) -> Bool {
+        raw.count == literal.utf8CodeUnitCount && hasPrefix(literal, at: raw.lowerBound)
+    }
+
+    private func equal(_ a: Range<Int>, _ b: Range<Int>) -> Bool {
+        a.count == b.count && memcmp(base + a.lowerBound, base + b.lowerBound, a.count) == 0
+    }
+
+    @discardableResult
+    private mutating func skipWhitespace() -> Bool {
+        let start = position
+        while position < count, isSpace(base[position]) {
+            position += 1
+        }
+        return position > start
+    }
+
+    private func isWhitespace(_ range: Range<Int>) -> Bool {
+        range.allSatisfy { isSpace(base[$0]) }
+    }
+
+    private func isSpace(_ c: UInt8) -> Bool {
+        c == 0x20 || c == 0x09 || c == 0x0A || c == 0x0D
+    }
+
+    /// ASCII letters, `_`, `:` and any non-ASCII byte
+    private func isNameStart(_ c: UInt8) -> Bool {
+        (c | 0x20) >= UInt8(ascii: "a") && (c | 0x20) <= UInt8(ascii: "z")
+            || c == UInt8(ascii: "_") || c == UInt8(ascii: ":") || c >= 0x80
+    }
+
+    private func isNameByte(_ c: UInt8) -> Bool {
+        isNameStart(c) || (c >= UInt8(ascii: "0") && c <= UInt8(ascii: "9"))
+            || c == UInt8(ascii: "-") || c == UInt8(ascii: ".")
+    }
+
+    private func fail(_ message: String, at offset: Int? = nil) -> XMLSyntaxError {
+        let offset = min(offset ?? position, count)
+        var line = 1
+        var lineStart = 0
+        for i in 0..<offset where base[i] == 0x0A {
+            line += 1
+            lineStart = i + 1
+        }
+        return XMLSyntaxError(message: message, line: line, column: offset - lineStart + 1)
+    }
+}
+
+// MARK: - XMLTreeBuilder
+
+/// Builds ARO values from tokenizer events. Elements are built only
+/// inside the selected records; everything else is walked past.
+struct XMLTreeBuilder {
+    static let attributePrefix = "@"
+    static let textKey = "#text"
+
+    /// Which elements `handle` returns when they close
+    enum Selection {
+        /// Elements at this depth (0 is the root)
+        case depth(Int)
+        /// Elements with this local name, outermost match only
+        case name(String)
+    }
+
+    private struct Frame {
+        var attributes: [String: any Sendable] = [:]
+        var children: [String: [any Sendable]] = [:]
+        var text = ""
+        /// Trailing whitespace bytes from plain text, trimmed at the end
+        var trailingSpace = 0
+        var hasCDATA = false
+    }
+
+    private let selection: Selection
+    private var depth = 0
+    private var stack: [Frame] = []
+
+    init(selection: Selection) {
+        self.selection = selection
+    }
+
+    /// Parse a whole document to the value of its root element.
+    static func parse(_ content: String) throws -> any Sendable {
+        var content = content
+        return try content.withUTF8 { buffer in
+            var tokenizer = XMLTokenizer(buffer)
+            var builder = XMLTreeBuilder(selection: .depth(0))
+            var root: (any Sendable)?
+            while let event = try tokenizer.next() {
+                if let value = builder.handle(event) {
+                    root = value
+                }
+            }
+            return root ?? ""
+        }
+    }
+
+    /// Feed one event. Returns a selected element's value when it
+    /// closes: its plain value for `.depth(0)`, otherwise always a map.
+    mutating func handle(_ event: XMLEvent) -> (any Sendable)? {
+        switch event {
+        case .startElement(let name, let attributes):
+            defer { depth += 1 }
+            guard !stack.isEmpty || isSelected(name) else { return nil }
+            var frame = Frame()
+            for attribute in attributes {
+                frame.attributes[Self.attributePrefix + attribute.name.localName] = Self.scalar(attribute.value)
+            }
+            stack.append(frame)
+            return nil
+
+        case .endElement(let name):
+            depth -= 1
+            guard let frame = stack.popLast() else { return nil }
+            guard !stack.isEmpty else {
+                if case .depth(0) = selection {
+                    return Self.value(of: frame)
+                }
+                return Self.map(of: frame)
+            }
+            stack[stack.count - 1].children[name.localName, default: []].append(Self.value(of: frame))
+            return nil
+
+        case .text(let text, let isCDATA):
+            guard !stack.isEmpty else { return nil }
+            Self.append(text, isCDATA: isCDATA, to: &stack[stack.count - 1])
+            return nil
+        }
+    }
+
+    private func isSelected(_ name: XMLName) -> Bool {
+        switch selection {
+        case .depth(let selected): return depth == selected
+        case .name(let selected): return name.localName == selected
+        }
+    }
+
+    /// Plain text is trimmed at the element's edges; CDATA is kept
+    /// verbatim.
+    private static func append(_ text: String, isCDATA: Bool, to frame: inout Frame) {
+        if isCDATA {
+            frame.text += text
+            frame.trailingSpace = 0
+            frame.hasCDATA = true
+            return
+        }
+        var utf8 = Substring(text).utf8[...]
+        if frame.text.isEmpty {
+            utf8 = utf8.drop(while: isSpace)
+        }
+        guard !utf8.isEmpty else { return }
+        let trailing = utf8.reversed().prefix(while: isSpace).count
+        frame.trailingSpace = trailing == utf8.count ? frame.trailingSpace + trailing : trailing
+        frame.text.append(contentsOf: Substring(utf8))
+    }
+
+    private static func isSpace(_ c: UInt8) -> Bool {
+        c == 0x20 || c == 0x09 || c == 0x0A || c == 0x0D
+    }
+
+    private static func trimmedText(of frame: Frame) -> String {
+        guard frame.trailingSpace > 0 else { return frame.text }
+        return String(decoding: frame.text.utf8.dropLast(frame.trailingSpace), as: UTF8.self)
+    }
+
+    private static func value(of frame: Frame) -> any Sendable {
+        if frame.children.isEmpty && frame.attributes.isEmpty {
+            let text = trimmedText(of: frame)
+            if frame.hasCDATA {
+                return text
+            }
+            return scalar(text)
+        }
+        if frame.attributes.isEmpty && frame.children.count == 1,
+           let items = frame.children["item"], trimmedText(of: frame).isEmpty {
+            return items
+        }
+        return map(of: frame)
+    }
+
+    private static func map(of frame: Frame) -> [String: any Sendable] {
+        var result = frame.attributes
+        for (name, values) in frame.children {
+            result[name] = values.count == 1 ? values[0] : values
+        }
+        let text = trimmedText(of: frame)
+        if frame.hasCDATA {
+            result[textKey] = text
+        } else if !text.isEmpty {
+            result[textKey] = scalar(text)
+        }
+        return result
+    }
+
+    /// Same conversion the deserializer has always applied to leaves
+    static func scalar(_ text: String) -> any Sendable {
+        if let intValue = Int(text) {
+            return intValue
+        }
+        if let doubleValue = Double(text) {
+            return doubleValue
+        }
+        if text == "true" { return true }
+        if text == "false" { return false }
+        return text
+    }
+}
@@ -0,0 +1,697 @@
+// YAMLParser.swift - ARO-0040: Format-Aware File I/O
+// Iterative YAML parser
+//
+// The previous parser recursed once per line (blank and comment lines
+// included), trimmed every line into a new String and copied the lines
+// of each sequence item into a synthetic array, so large files such as
+// seed `.store` files recursed deeply and allocated per line. This
+// parser walks the UTF-8 bytes line by line with an explicit stack of
+// open mappings and sequences keyed by indentation. A collection is
+// attached to its parent when a less indented line closes it.
+//
+// Supported: block mappings and sequences (including a sequence at
+// the same indent as its key), literal and folded block scalars, flow
+// collections (`[a, b]`, `{k: v}`, possibly over several lines),
+// anchors and aliases (`&name`, `*name`, `<<` merge keys), comments,
+// and multi-document streams (`---` / `...`), which deserialize to a
+// list of documents. Scalars keep the existing typing rules: booleans,
+// null/~/empty as "", Int, Double, then quoted or plain strings.
+
+import Foundation
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+struct YAMLParser {
+
+    /// One source line as byte offsets
+    private struct Line {
+        /// Excludes the newline and a trailing "\r"
+        let end: Int
+        /// Leading spaces (tabs are not indentation)
+        let indent: Int
+        /// First and past-last non-blank byte
+        let contentStart: Int
+        let contentEnd: Int
+
+        var isBlank: Bool {
+            contentStart == contentEnd
+        }
+    }
+
+    /// A value still owed to a collection: the value of `key` in a
+    /// mapping, or the next item (nil key) of a sequence
+    private struct Pending {
+        let key: String?
+        let anchor: String?
+    }
+
+    private struct Frame {
+        enum Kind { case mapping, sequence }
+
+        let kind: Kind
+        /// Column of the keys or dashes
+        let indent: Int
+        var map: [String: any Sendable] = [:]
+        var list: [any Sendable] = []
+        var pending: Pending?
+    }
+
+    private let base: UnsafePointer<UInt8>
+    private let count: Int
+    /// Start of the next unread line
+    private var cursor = 0
+
+    private var stack: [Frame] = []
+    private var root: (any Sendable)?
+    private var documents: [any Sendable] = []
+    private var anchors: [String: any Sendable] = [:]
+
+    private init(_ buffer: UnsafeBufferPointer<UInt8>) {
+        self.base = buffer.baseAddress ?? UnsafePointer(bitPattern: 1)!
+        self.count = buffer.count
+        if count >= 3 && base[0] == 0xEF && base[1] == 0xBB && base[2] == 0xBF {
+            cursor = 3
+        }
+    }
+
+    /// Parse a YAML stream. One document yields its value, several yield
+    /// a list of documents, and an empty stream yields "".
+    static func parse(_ content: String) -> any Sendable {
+        var content = content
+        return content.withUTF8 { buffer in
+            var parser = YAMLParser(buffer)
+            return parser.parseStream()
+        }
+    }
+
+    private mutating func parseStream() -> any Sendable {
+        while let line = readLine() {
+            if line.isBlank || base[line.contentStart] == UInt8(ascii: "#") {
+                continue
+            }
+            if line.indent == 0, let marker = documentMarker(line) {
+                endDocument()
+                if marker < line.contentEnd {
+                    handle(line, column: marker - line.contentStart, start: marker)
+                }
+                continue
+            }
+            handle(line, column: line.indent, start: line.contentStart)
+        }
+        endDocument()
+
+        switch documents.count {
+        case 0: return ""
+        case 1: return documents[0]
+        default: return documents
+        }
+    }
+
+    // MARK: - Block Structure
+
+    /// Place the text of `line` starting at `start` (column `column`).
+    private mutating func handle(_ line: Line, column: Int, start: Int) {
+        let dash = isDash(start, line.contentEnd)
+        while let indent = stack.last?.indent, indent > column {
+            closeFrame()
+        }
+        // A sequence at its key's indent ends at the next non-dash line
+        while !dash, stack.last?.kind == .sequence, stack.last?.indent == column {
+            closeFrame()
+        }
+
+        // Frames are read in place: a copy would share the collection
+        // being built and force it to be copied on the next insert
+        guard !stack.isEmpty else {
+            if root == nil {
+                beginValue(line, column: column, start: start)
+            }
+            return
+        }
+        let top = stack.count - 1
+        if stack[top].pending != nil {
+            let indent = stack[top].indent
+            if column > indent || (dash && stack[top].kind == .mapping && column == indent) {
+                beginValue(line, column: column, start: start)
+                return
+            }
+            fill("")
+        }
+        addEntry(line, column: column, start: start)
+    }
+
+    /// Start the value for the innermost pending slot (or the document)
+    private mutating func beginValue(_ line: Line, column: Int, start: Int) {
+        if isDash(start, line.contentEnd) {
+            stack.append(Frame(kind: .sequence, indent: column))
+            addEntry(line, column: column, start: start)
+        } else if mappingEntry(start, line.contentEnd) != nil {
+            stack.append(Frame(kind: .mapping, indent: column))
+            addEntry(line, column: column, start: start)
+        } else {
+            fill(inlineValue(line, start: start))
+        }
+    }
+
+    /// Add a `- item` or `key: value` line to the innermost collection.
+    /// Lines that fit neither are skipped, as before.
+    private mutating func addEntry(_ line: Line, column: Int, start: Int) {
+        let end = line.contentEnd
+        switch stack[stack.count - 1].kind {
+        case .sequence:
+            guard isDash(start, end) else { return }
+            let (anchor, rest) = self.anchor(skipSpace(start + 1, end), end)
+            stack[stack.count - 1].pending = Pending(key: nil, anchor: anchor)
+            if !isEmptyValue(rest, end) {
+                beginValue(line, column: column + (rest - start), start: rest)
+            }
+
+        case .mapping:
+            guard !isDash(start, end), let entry = mappingEntry(start, end) else { return }
+            let (anchor, rest) = self.anchor(entry.valueStart, end)
+            stack[stack.count - 1].pending = Pending(key: entry.key, anchor: anchor)
+            if !isEmptyValue(rest, end) {
+                fill(inlineValue(line, start: rest))
+            }
+        }
+    }
+
+    /// Give the innermost pending slot its value
+    private mutating func fill(_ value: any Sendable) {
+        guard !stack.isEmpty else {
+            root = value
+            return
+        }
+        let top = stack.count - 1
+        guard let pending = stack[top].pending else { return }
+        stack[top].pending = nil
+        if let anchor = pending.anchor {
+            anchors[anchor] = value
+        }
+        switch stack[top].kind {
+        case .mapping:
+            Self.insert(value, for: pending.key ?? "", into: &stack[top].map)
+        case .sequence:
+            stack[top].list.append(value)
+        }
+    }
+
+    private mutating func closeFrame() {
+        if stack[stack.count - 1].pending != nil {
+            fill("")
+        }
+        let frame = stack.removeLast()
+        switch frame.kind {
+        case .mapping: fill(frame.map)
+        case .sequence: fill(frame.list)
+        }
+    }
+
+    private mutating func endDocument() {
+        while !stack.isEmpty {
+            closeFrame()
+        }
+        if let root {
+            documents.append(root)
+        }
+        root = nil
+        anchors = [:]
+    }
+
+    /// `<<` merges the keys of a mapping (or list of mappings) that the
+    /// mapping does not set itself
+    private static func insert(_ value: any Sendable, for key: String, into map: inout [String: any Sendable]) {
+        if key == "<<" {
+            let sources = (value as? [String: any Sendable]).map { [$0] }
+                ?? (value as? [any Sendable])?.compactMap { $0 as? [String: any Sendable] }
+            if let sources {
+                for source in sources {
+                    for (sourceKey, sourceValue) in source where map[sourceKey] == nil {
+                        map[sourceKey] = sourceValue
+                    }
+                }
+                return
+            }
+        }
+        map[key] = value
+    }
+
+    // MARK: - Inline Values
+
+    /// The value written on a line from `start`: alias, block scalar,
+    /// flow collection or scalar.
+    private mutating func inlineValue(_ line: Line, start: Int) -> any Sendable {
+        let end = line.contentEnd
+        switch base[start] {
+        case UInt8(ascii: "*"):
+            let name = string(start + 1, scalarEnd(start, end))
+            return anchors[name] ?? "*" + name
+        case UInt8(ascii: "|"), UInt8(ascii: ">"):
+            let indicator = string(start, scalarEnd(start, end))
+            if ["|", "|-", "|+", ">", ">-", ">+"].contains(indicator) {
+                let chomp = indicator.last  // "-" strip, "+" keep, otherwise clip
+                return blockScalar(
+                    parentIndent: line.indent,
+                    folded: indicator.hasPrefix(">"),
+                    chomp: chomp == "-" ? .strip : (chomp == "+" ? .keep : .clip)
+                )
+            }
+        case UInt8(ascii: "["), UInt8(ascii: "{"):
+            var position = start
+            let value = flowValue(&position)
+            // Continue after the line holding the closing bracket
+            if position > line.end {
+                cursor = position
+                _ = readLine()
+            }
+            return value
+        default:
+            break
+        }
+        return Self.scalar(string(start, scalarEnd(start, end)))
+    }
+
+    private enum Chomp { case strip, clip, keep }
+
+    /// Collect a block scalar body from the following lines. The block
+    /// ends at the first non-empty line indented `parentIndent` or less.
+    private mutating func blockScalar(parentIndent: Int, folded: Bool, chomp: Chomp) -> String {
+        var collected: [String] = []
+        var blockIndent: Int?
+
+        while cursor < count {
+            let line = self.line(at: cursor)
+            if line.isBlank {
+                collected.append("")
+                _ = readLine()
+                continue
+            }
+            if line.indent <= parentIndent { break }
+            if blockIndent == nil { blockIndent = line.indent }
+            let strip = min(blockIndent ?? line.indent, line.indent)
+            collected.append(string(cursor + strip, line.end))
+            _ = readLine()
+        }
+
+        // Drop trailing blank lines that came after the last non-blank.
+        var lastNonBlank = collected.count
+        while lastNonBlank > 0 && collected[lastNonBlank - 1].isEmpty {
+            lastNonBlank -= 1
+        }
+
+        let body: String
+        if folded {
+            // Folded: single newlines become spaces, blank lines stay as newlines.
+            var pieces: [String] = []
+            var current = ""
+            for i in 0..<lastNonBlank {
+                let line = collected[i]
+                if line.isEmpty {
+                    pieces.append(current)
+                    pieces.append("")
+                    current = ""
+                } else if current.isEmpty {
+                    current = line
+                } else {
+                    current += " " + line
+                }
+            }
+            pieces.append(current)
+            body = pieces.joined(separator: "\n")
+        } else {
+            body = collected.prefix(lastNonBlank).joined(separator: "\n")
+        }
+
+        switch chomp {
+        case .strip:
+            return body
+        case .clip:
+            return body.isEmpty ? body : body + "\n"
+        case .keep:
+            // Re-append every trailing blank we trimmed.
+            let trailing = collected.count - lastNonBlank
+            return body + String(repeating: "\n", count: trailing + (body.isEmpty ? 0 : 1))
+        }
+    }
+
+    // MARK: - Flow Collections
+
+    /// Parse a flow value at `position`. Line breaks inside brackets are
+    /// whitespace; a collection left open at the end of input is closed.
+    private mutating func flowValue(_ position: inout Int) -> any Sendable {
+        skipFlowSpace(&position)
+        guard position < count else { return "" }
+
+        switch base[position] {
+        case UInt8(ascii: "["):
+            position += 1
+            var list: [any Sendable] = []
+            while true {
+                skipFlowSpace(&position)
+                guard position < count else { break }
+                if base[position] == UInt8(ascii: "]") {
+                    position += 1
+                    break
+                }
+                list.append(flowValue(&position))
+                skipFlowSpace(&position)
+                if position < count && base[position] == UInt8(ascii: ",") {
+                    position += 1
+                } else if position >= count || base[position] != UInt8(ascii: "]") {
+                    break
+                }
+            }
+            return list
+
+        case UInt8(ascii: "{"):
+            position += 1
+            var map: [String: any Sendable] = [:]
+            while true {
+                skipFlowSpace(&position)
+                guard position < count else { break }
+                if base[position] == UInt8(ascii: "}") {
+                    position += 1
+                    break
+                }
+                let key = flowScalarText(&position, isKey: true)
+                skipFlowSpace(&position)
+                var value: any Sendable = ""
+                if position < count && base[position] == UInt8(ascii: ":") {
+                    position += 1
+                    value = flowValue(&position)
+                    skipFlowSpace(&position)
+                }
+                Self.insert(value, for: Self.scalar(key) as? String ?? key, into: &map)
+                if position < count && base[position] == UInt8(ascii: ",") {
+                    position += 1
+                } else if position >= count || base[position] != UInt8(ascii: "}") {
+                    break
+                }
+            }
+            return map
+
+        case UInt8(ascii: "*"):
+            let name = String(flowScalarText(&position, isKey: false).dropFirst())
+            return anchors[name] ?? "*" + name
+
+        case UInt8(ascii: "&"):
+            let (anchor, rest) = self.anchor(position, count)
+            position = rest
+            let value = flowValue(&position)
+            if let anchor {
+                anchors[anchor] = value
+            }
+            return value
+
+        default:
+            return Self.scalar(flowScalarText(&position, isKey: false))
+        }
+    }
+
+    /// A quoted or plain scalar inside a flow collection, as written
+    private func flowScalarText(_ position: inout Int, isKey: Bool) -> String {
+        let start = position
+        if base[position] == UInt8(ascii: "\"") || base[position] == UInt8(ascii: "'") {
+            position = quotedEnd(position, count)
+            return string(start, position)
+        }
+        var end = position
+        while position < count {
+            let c = base[position]
+            if c == UInt8(ascii: ",") || c == UInt8(ascii: "]") || c == UInt8(ascii: "}") || c == 0x0A {
+                break
+            }
+            if c == UInt8(ascii: ":") && isKey && (position + 1 >= count || isSpace(base[position + 1])) {
+                break
+            }
+            if c == UInt8(ascii: "#") && position > start && isSpace(base[position - 1]) {
+                break
+            }
+            position += 1
+            if !isSpace(c) && c != 0x0D {
+                end = position
+            }
+        }
+        return string(start, end)
+    }
+
+    /// Spaces, line breaks and comments between flow tokens
+    private func skipFlowSpace(_ position: inout Int) {
+        while position < count {
+            let c = base[position]
+            if isSpace(c) || c == 0x0A || c == 0x0D {
+                position += 1
+            } else if c == UInt8(ascii: "#") {
+                while position < count && base[position] != 0x0A {
+                    position += 1
+                }
+            } else {
+                return
+            }
+        }
+    }
+
+    // MARK: - Scalars
+
+    /// Scalar typing rules shared by every YAML value
+    static func scalar(_ value: String) -> any Sendable {
+        let trimmed = value.trimmingCharacters(in: .whitespaces)
+
+        // Boolean
+        if trimmed == "true" || trimmed == "True" || trimmed == "TRUE" {
+            return true
+        }
+        if trimmed == "false" || trimmed == "False" || trimmed == "FALSE" {
+            return false
+        }
+
+        // Null
+        if trimmed == "null" || trimmed == "~" || trimmed.isEmpty {
+            return ""
+        }
+
+        // Number
+        if let intValue = Int(trimmed) {
+            return intValue
+        }
+        if let doubleValue = Double(trimmed) {
+            return doubleValue
+        }
+
+        // Double-quoted string: process YAML escape sequences
+        if trimmed.count >= 2 && trimmed.hasPrefix("\"") && trimmed.hasSuffix("\"") {
+            let body = String(trimmed.dropFirst().dropLast())
+            return unescapeDoubleQuoted(body)
+        }
+
+        // Single-quoted string: only `''` -> `'` is significant
+        if trimmed.count >= 2 && trimmed.hasPrefix("'") && trimmed.hasSuffix("'") {
+            let body = String(trimmed.dropFirst().dropLast())
+            return body.replacingOccurrences(of: "''", with: "'")
+        }
+
+        return trimmed
+    }
+
+    private static func unescapeDoubleQuoted(_ s: String) -> String {
+        var out = ""
+        out.reserveCapacity(s.count)
+        var iter = s.makeIterator()
+        while let ch = iter.next() {
+            if ch != "\\" { out.append(ch); continue }
+            guard let esc = iter.next() else { out.append("\\"); break }
+            switch esc {
+            case "n":  out.append("\n")
+            case "t":  out.append("\t")
+            case "r":  out.append("\r")
+            case "0":  out.append("\u{0}")
+            case "\"": out.append("\"")
+            case "'":  out.append("'")
+            case "\\": out.append("\\")
+            case "/":  out.append("/")
+            case "a":  out.append("\u{07}")
+            case "b":  out.append("\u{08}")
+            case "f":  out.append("\u{0C}")
+            case "v":  out.append("\u{0B}")
+            case "e":  out.append("\u{1B}")
+            case " ":  out.append(" ")
+            default:   out.append("\\"); out.append(esc)
+            }
+        }
+        return out
+    }
+
+    // MARK: - Lines
+
+    private func line(at start: Int) -> Line {
+        let newline = memchr(base + start, 0x0A, count - start).map {
+            UnsafeRawPointer(base).distance(to: UnsafeRawPointer($0))
+        } ?? count
+        var end = newline
+        if end > start && base[end - 1] == 0x0D {
+            end -= 1
+        }
+        var indent = 0
+        while start + indent < end && base[start + indent] == 0x20 {
+            indent += 1
+        }
+        var contentStart = start + indent
+        while contentStart < end && isSpace(base[contentStart]) {
+            contentStart += 1
+        }
+        var contentEnd = end
+        while contentEnd > contentStart && isSpace(base[contentEnd - 1]) {
+            contentEnd -= 1
+        }
+        return Line(end: end, indent: indent, contentStart: contentStart, contentEnd: contentEnd)
+    }
+
+    /// The line at `cursor`, advancing past it
+    private mutating func readLine() -> Line? {
+        guard cursor < count else { return nil }
+        let line = self.line(at: cursor)
+        cursor = line.end < count && base[line.end] == 0x0D ? line.end + 2 : line.end + 1
+        return line
+    }
+
+    // MARK: - Scanning
+
+    /// `---` or `...` at the start of `line`; returns where any content
+    /// after the marker starts
+    private func documentMarker(_ line: Line) -> Int? {
+        let s = line.contentStart
+        guard line.contentEnd - s >= 3,
+              (base[s] == UInt8(ascii: "-") && base[s + 1] == UInt8(ascii: "-") && base[s + 2] == UInt8(ascii: "-"))
+                || (base[s] == UInt8(ascii: ".") && base[s + 1] == UInt8(ascii: ".") && base[s + 2] == UInt8(ascii: ".")),
+              s + 3 == line.contentEnd || isSpace(base[s + 3]) else {
+            return nil
+        }
+        let rest = skipSpace(s + 3, line.contentEnd)
+        return rest < line.contentEnd && base[rest] == UInt8(ascii: "#") ? line.contentEnd : rest
+    }
+
+    /// `-` followed by a space or the end of the line
+    private func isDash(_ start: Int, _ end: Int) -> Bool {
+        start < end && base[start] == UInt8(ascii: "-") && (start + 1 == end || isSpace(base[start + 1]))
+    }
+
+    /// Nothing but an optional comment from `start`
+    private func isEmptyValue(_ start: Int, _ end: Int) -> Bool {
+        start >= end || base[start] == UInt8(ascii: "#")
+    }
+
+    /// `key: value` (or `key:`) from `start`; the key may be quoted
+    private func mappingEntry(_ start: Int, _ end: Int) -> (key: String, valueStart: Int)? {
+        let first = base[start]
+        if first == UInt8(ascii: "[") || first == UInt8(ascii: "{") || first == UInt8(ascii: "#")
+            || first == UInt8(ascii: "*") || first == UInt8(ascii: "|") || first == UInt8(ascii: ">") {
+            return nil
+        }
+
+        var keyEnd: Int
+        var colon: Int
+        if first == UInt8(ascii: "\"") || first == UInt8(ascii: "'") {
+            keyEnd = quotedEnd(start, end)
+            colon = skipSpace(keyEnd, end)
+            guard colon < end, base[colon] == UInt8(ascii: ":"),
+                  colon + 1 == end || isSpace(base[colon + 1]) else {
+                return nil
+            }
+        } else {
+            colon = start
+            while true {
+                guard colon < end else { return nil }
+                let c = base[colon]
+                if c == UInt8(ascii: ":") && (colon + 1 == end || isSpace(base[colon + 1])) {
+                    break
+                }
+                if c == UInt8(ascii: "#") && colon > start && isSpace(base[colon - 1]) {
+                    return nil
+                }
+                colon += 1
+            }
+            keyEnd = colon
+            while keyEnd > start && isSpace(base[keyEnd - 1]) {
+                keyEnd -= 1
+            }
+        }
+
+        let rawKey = string(start, keyEnd)
+        let key = first == UInt8(ascii: "\"") || first == UInt8(ascii: "'") ? (Self.scalar(rawKey) as? String ?? rawKey) : rawKey
+        return (key, skipSpace(colon + 1, end))
+    }
+
+    /// `&name` at `start`: the anchor and where the value after it starts
+    private func anchor(_ start: Int, _ end: Int) -> (String?, Int) {
+        guard start < end, base[start] == UInt8(ascii: "&") else { return (nil, start) }
+        var nameEnd = start + 1
+        while nameEnd < end && !isSpace(base[nameEnd]) && base[nameEnd] != 0x0A
+            && base[nameEnd] != UInt8(ascii: ",") && base[nameEnd] != UInt8(ascii: "]") && base[nameEnd] != UInt8(ascii: "}") {
+            nameEnd += 1
+        }
+        return (string(start + 1, nameEnd), skipSpace(nameEnd, end))
+    }
+
+    /// End of the scalar at `start`: after its closing quote, or before a
+    /// ` #` comment for plain scalars
+    private func scalarEnd(_ start: Int, _ end: Int) -> Int {
+        if base[start] == UInt8(ascii: "\"") || base[start] == UInt8(ascii: "'") {
+            return quotedEnd(start, end)
+        }
+        var i = start
+        while i < end {
+            if base[i] == UInt8(ascii: "#") && i > start && isSpace(base[i - 1]) {
+                var trimmed = i
+                while trimmed > start && isSpace(base[trimmed - 1]) {
+                    trimmed -= 1
+                }
+                return trimmed
+            }
+            i += 1
+        }
+        return end
+    }
+
+    /// Past the closing quote of the string opening at `start` (`end`
+    /// if unterminated). `\` escapes in double quotes, `''` in single.
+    private func quotedEnd(_ start: Int, _ end: Int) -> Int {
+        let quote = base[start]
+        var i = start + 1
+        while i < end {
+            let c = base[i]
+            if quote == UInt8(ascii: "\"") && c == UInt8(ascii: "\\") {
+                i += 2
+                continue
+            }
+            if c == quote {
+                if quote == UInt8(ascii: "'") && i + 1 < end && base[i + 1] == quote {
+                    i += 2
+                    continue
+                }
+                return i + 1
+            }
+            i += 1
+        }
+        return end
+    }
+
+    private func skipSpace(_ start: Int, _ end: Int) -> Int {
+        var i = start
+        while i < end && isSpace(base[i]) {
+            i += 1
+        }
+        return i
+    }
+
+    private func isSpace(_ c: UInt8) -> Bool {
+        c == 0x20 || c == 0x09
+    }
+
+    private func string(_ start: Int, _ end: Int) -> String {
+        guard end > start else { return "" }
+        return String(decoding: UnsafeBufferPointer(start: base + start, count: end - start), as: UTF8.self)
+    }
+}
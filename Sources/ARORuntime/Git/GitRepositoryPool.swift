@@ -0,0 +1,218 @@
+// ============================================================
+// GitRepositoryPool.swift
+// ARO Runtime - Pooled libgit2 repository handles (ARO-0080)
+// ============================================================
+//
+// `git_repository_open` reads the repository's config, resolves the
+// git directory and sets up the object database on every call, which
+// dominated short operations such as `status` and `log`. The pool keeps
+// one open handle per repository path:
+//
+//   - Each handle has its own lock. libgit2 objects must not be used
+//     from two threads at once, but operations on different
+//     repositories no longer wait for each other.
+//   - A handle is reopened when `.git/HEAD` or `.git/index` changed on
+//     disk (mtime or size) since it was opened, so checkouts and commits
+//     made by other processes are picked up.
+//   - At most `capacity` handles stay open; the least recently used idle
+//     handle is freed first. Handles in use are never freed from under
+//     their caller.
+
+#if !os(Windows)
+
+import Foundation
+import Clibgit2
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// Keyed pool of open libgit2 repository handles with per-repository locks.
+final class GitRepositoryPool: @unchecked Sendable {
+
+    /// Default number of open handles, overridable with `ARO_GIT_POOL_SIZE`.
+    static let defaultCapacity: Int = {
+        ProcessInfo.processInfo.environment["ARO_GIT_POOL_SIZE"].flatMap(Int.init) ?? 16
+    }()
+
+    let capacity: Int
+
+    /// Guards `entries`, `clock`, `opens` and each entry's pool bookkeeping.
+    private let lock = NSLock()
+    private var entries: [String: Entry] = [:]
+    private var clock: UInt64 = 0
+    private var opens = 0
+
+    init(capacity: Int) {
+        self.capacity = max(1, capacity)
+    }
+
+    deinit {
+        for entry in entries.values {
+            entry.close()
+        }
+    }
+
+    /// Run `body` with the open handle for the repository at `url`. Calls
+    /// for the same repository are serialized; other repositories proceed.
+    func withRepository<T>(at url: URL, _ body: (OpaquePointer) throws -> T) throws -> T {
+        let path = url.standardizedFileURL.path
+        let entry = checkout(path)
+        defer { checkin(entry) }
+
+        entry.lock.lock()
+        defer { entry.lock.unlock() }
+        if try entry.prepare() {
+            lock.withLock { opens += 1 }
+        }
+        return try body(entry.repo!)
+    }
+
+    // MARK: - Introspection (tests)
+
+    /// Number of `git_repository_open` calls made so far
+    var openCount: Int {
+        lock.withLock { opens }
+    }
+
+    /// Paths of the repositories currently in the pool
+    var cachedPaths: Set<String> {
+        lock.withLock { Set(entries.keys) }
+    }
+
+    // MARK: - Leasing
+
+    private func checkout(_ path: String) -> Entry {
+        var evicted: [Entry] = []
+        let entry: Entry = lock.withLock {
+            clock += 1
+            let entry = entries[path] ?? Entry(path: path)
+            entry.leases += 1
+            entry.lastUsed = clock
+            if entries[path] == nil {
+                entries[path] = entry
+                evicted = evictIdle()
+            }
+            return entry
+        }
+        // Evicted entries are unreachable and idle; free outside the pool lock
+        for old in evicted {
+            old.close()
+        }
+        return entry
+    }
+
+    private func checkin(_ entry: Entry) {
+        let shouldClose: Bool = lock.withLock {
+            entry.leases -= 1
+            return entry.isEvicted && entry.leases == 0
+        }
+        if shouldClose {
+            entry.close()
+        }
+    }
+
+    /// Drop least recently used idle entries while over capacity. If every
+    /// entry is leased the pool stays over capacity until one is returned.
+    /// Caller holds `lock`.
+    private func evictIdle() -> [Entry] {
+        var evicted: [Entry] = []
+        while entries.count > capacity {
+            guard let victim = entries.values
+                .filter({ $0.leases == 0 })
+                .min(by: { $0.lastUsed < $1.lastUsed }) else { break }
+            entries[victim.path] = nil
+            victim.isEvicted = true
+            evicted.append(victim)
+        }
+        return evicted
+    }
+
+    // MARK: - Entry
+
+    private final class Entry: @unchecked Sendable {
+        let path: String
+        /// Serializes libgit2 use of `repo`; guards `repo`, `gitDir` and `stamp`
+        let lock = NSLock()
+        var repo: OpaquePointer?
+        var gitDir = ""
+        var stamp = RepositoryStamp()
+
+        // Pool bookkeeping, guarded by the pool lock
+        var leases = 0
+        var lastUsed: UInt64 = 0
+        var isEvicted = false
+
+        init(path: String) {
+            self.path = path
+        }
+
+        /// Open the handle, or reopen it when HEAD or the index changed on
+        /// disk. Returns true when `git_repository_open` was called.
+        /// Caller holds `lock`.
+        func prepare() throws -> Bool {
+            if repo != nil {
+                if RepositoryStamp(gitDir: gitDir) == stamp {
+                    return false
+                }
+                close()
+            }
+
+            var opened: OpaquePointer?
+            let rc = path.withCString { git_repository_open(&opened, $0) }
+            guard rc == 0, let opened else { throw GitServiceError.notARepository(path) }
+            repo = opened
+            gitDir = git_repository_path(opened).map { String(cString: $0) } ?? "\(path)/.git/"
+            stamp = RepositoryStamp(gitDir: gitDir)
+            return true
+        }
+
+        func close() {
+            if let repo {
+                git_repository_free(repo)
+            }
+            repo = nil
+        }
+    }
+}
+
+// MARK: - Repository Stamp
+
+/// On-disk state of `HEAD` and `index` that invalidates a pooled handle.
+private struct RepositoryStamp: Equatable {
+    var head = FileStamp()
+    var index = FileStamp()
+
+    init() {}
+
+    init(gitDir: String) {
+        let dir = gitDir.hasSuffix("/") ? gitDir : gitDir + "/"
+        head = FileStamp(path: dir + "HEAD")
+        index = FileStamp(path: dir + "index")
+    }
+}
+
+private struct FileStamp: Equatable {
+    var seconds = 0
+    var nanoseconds = 0
+    var size: Int64 = -1
+
+    init() {}
+
+    /// A missing file (e.g. no index yet) keeps the empty stamp
+    init(path: String) {
+        var info = stat()
+        guard stat(path, &info) == 0 else { return }
+        #if canImport(Darwin)
+        let mtime = info.st_mtimespec
+        #else
+        let mtime = info.st_mtim
+        #endif
+        seconds = Int(mtime.tv_sec)
+        nanoseconds = Int(mtime.tv_nsec)
+        size = Int64(info.st_size)
+    }
+}
+
+#endif // !os(Windows)
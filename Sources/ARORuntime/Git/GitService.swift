@@ -18,7 +18,8 @@ public final class GitService: @unchecked Sendable {
 
     public static let shared = GitService()
 
-    private let lock = NSRecursiveLock()
+    /// Open repository handles, one lock per repository
+    private let repositories = GitRepositoryPool(capacity: GitRepositoryPool.defaultCapacity)
     private static let initLock = NSLock()
     nonisolated(unsafe) private static var initialized = false
 
@@ -36,15 +37,10 @@ public final class GitService: @unchecked Sendable {
 
     // MARK: - Repository helpers
 
-    /// Open a repository, run `body`, then free it.
+    /// Run `body` with the pooled handle for the repository at `path`.
+    /// Operations on the same repository are serialized.
     private func withRepo<T>(at path: URL, _ body: (OpaquePointer) throws -> T) throws -> T {
-        lock.lock()
-        defer { lock.unlock() }
-        var repo: OpaquePointer?
-        let rc = path.path.withCString { git_repository_open(&repo, $0) }
-        guard rc == 0, let repo else { throw GitServiceError.notARepository(path.path) }
-        defer { git_repository_free(repo) }
-        return try body(repo)
+        try repositories.withRepository(at: path, body)
     }
 
     /// Resolve a repository path from an ARO object qualifier.
@@ -356,9 +352,6 @@ public final class GitService: @unchecked Sendable {
         username: String? = nil,
         token: String? = nil
     ) throws -> GitCommitResult {
-        lock.lock()
-        defer { lock.unlock() }
-
         var opts = git_clone_options()
         git_clone_options_init(&opts, UInt32(GIT_CLONE_OPTIONS_VERSION))
 
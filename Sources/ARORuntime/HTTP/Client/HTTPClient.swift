@@ -63,16 +63,24 @@ public final class AROHTTPClient: HTTPClientService, @unchecked Sendable {
     private let client: HTTPClient
     private let eventBus: EventBus
     private let timeout: TimeAmount
+    private let pipeline: HTTPClientPipeline
 
     // MARK: - Initialization
 
     public init(
         eventBus: EventBus = .shared,
-        timeout: TimeAmount = .seconds(30)
+        timeout: TimeAmount = .seconds(30),
+        pipeline: HTTPClientPipeline = .shared
     ) {
-        self.client = HTTPClient(eventLoopGroupProvider: .singleton)
+        var configuration = HTTPClient.Configuration()
+        configuration.connectionPool = HTTPClient.Configuration.ConnectionPool(
+            idleTimeout: .seconds(60),
+            concurrentHTTP1ConnectionsPerHostSoftLimit: pipeline.tuning.maxConnectionsPerHost
+        )
+        self.client = HTTPClient(eventLoopGroupProvider: .singleton, configuration: configuration)
         self.eventBus = eventBus
         self.timeout = timeout
+        self.pipeline = pipeline
     }
 
     deinit {
@@ -171,11 +179,24 @@ public final class AROHTTPClient: HTTPClientService, @unchecked Sendable {
         return response.bodyString ?? ""
     }
 
+    /// Routes the request through the shared cache / single-flight pipeline
     private func performRequest(
         method: HTTPMethod,
         url: String,
         headers: [String: String],
         body: Data?
+    ) async throws -> HTTPClientResponse {
+        try await pipeline.perform(method: method.rawValue, url: url, headers: headers, body: body) { sendHeaders in
+            try await self.send(method: method, url: url, headers: sendHeaders, body: body)
+        }
+    }
+
+    /// Sends the request upstream
+    private func send(
+        method: HTTPMethod,
+        url: String,
+        headers: [String: String],
+        body: Data?
     ) async throws -> HTTPClientResponse {
         let startTime = Date()
 
@@ -0,0 +1,473 @@
+// ============================================================
+// HTTPResponseCache.swift
+// ARO Runtime - Shared outbound HTTP cache and request coalescing
+// ============================================================
+//
+// Every outbound request — `Request`/`Fetch` in the interpreter,
+// `aro_http_request_execute` in compiled binaries, and both client
+// implementations — goes through `HTTPClientPipeline.shared`:
+//
+//   1. GET/HEAD consult an in-memory cache that honours
+//      Cache-Control (max-age, s-maxage, no-store, no-cache, private),
+//      Expires, Age and Vary. Fresh entries are served without a
+//      network round trip.
+//   2. Stale entries carrying an ETag or Last-Modified are revalidated
+//      with If-None-Match / If-Modified-Since; a 304 refreshes the
+//      entry and returns the cached body.
+//   3. Identical in-flight GETs are coalesced (single-flight): 500
+//      feature sets fetching the same URL make one upstream call.
+//   4. Unsafe methods (POST/PUT/PATCH/DELETE) invalidate the cached
+//      entry for their URL.
+//
+// The cache is a shared cache in the RFC 9111 sense — one runtime
+// serves many callers — so `private` responses and responses to
+// requests carrying Authorization are not stored unless the server
+// explicitly allows it (`public` / `s-maxage`).
+
+import Foundation
+
+// MARK: - Tuning
+
+/// Outbound HTTP tuning. Defaults come from `RuntimeDefaults`; each
+/// value can be overridden with an environment variable, the same way
+/// `ARO_HTTP_CONCURRENCY` bounds in-flight fetches.
+public struct HTTPClientTuning: Sendable {
+    /// Serve and store cacheable responses (`ARO_HTTP_CACHE=0` disables)
+    public var cacheEnabled: Bool
+
+    /// Maximum number of cached responses (`ARO_HTTP_CACHE_ENTRIES`)
+    public var cacheMaxEntries: Int
+
+    /// Largest body that will be cached, in bytes (`ARO_HTTP_CACHE_MAX_BODY`)
+    public var cacheMaxBodyBytes: Int
+
+    /// Coalesce identical in-flight GETs (`ARO_HTTP_COALESCE=0` disables)
+    public var coalesceRequests: Bool
+
+    /// Connections kept open per upstream host (`ARO_HTTP_MAX_CONNECTIONS_PER_HOST`)
+    public var maxConnectionsPerHost: Int
+
+    public init(
+        cacheEnabled: Bool = true,
+        cacheMaxEntries: Int = RuntimeDefaults.httpCacheMaxEntries,
+        cacheMaxBodyBytes: Int = RuntimeDefaults.httpCacheMaxBodyBytes,
+        coalesceRequests: Bool = true,
+        maxConnectionsPerHost: Int = RuntimeDefaults.httpMaxConnectionsPerHost
+    ) {
+        self.cacheEnabled = cacheEnabled
+        self.cacheMaxEntries = max(1, cacheMaxEntries)
+        self.cacheMaxBodyBytes = max(0, cacheMaxBodyBytes)
+        self.coalesceRequests = coalesceRequests
+        self.maxConnectionsPerHost = max(1, maxConnectionsPerHost)
+    }
+
+    /// Tuning for this process: defaults plus environment overrides
+    public static let current: HTTPClientTuning = {
+        let env = ProcessInfo.processInfo.environment
+        func flag(_ name: String) -> Bool? {
+            env[name].map { !["0", "false", "off", "no"].contains($0.lowercased()) }
+        }
+        return HTTPClientTuning(
+            cacheEnabled: flag("ARO_HTTP_CACHE") ?? true,
+            cacheMaxEntries: env["ARO_HTTP_CACHE_ENTRIES"].flatMap(Int.init) ?? RuntimeDefaults.httpCacheMaxEntries,
+            cacheMaxBodyBytes: env["ARO_HTTP_CACHE_MAX_BODY"].flatMap(Int.init) ?? RuntimeDefaults.httpCacheMaxBodyBytes,
+            coalesceRequests: flag("ARO_HTTP_COALESCE") ?? true,
+            maxConnectionsPerHost: env["ARO_HTTP_MAX_CONNECTIONS_PER_HOST"].flatMap(Int.init) ?? RuntimeDefaults.httpMaxConnectionsPerHost
+        )
+    }()
+}
+
+// MARK: - Cache-Control
+
+/// Parsed Cache-Control directives (request or response)
+struct CacheControl: Equatable {
+    var maxAge: TimeInterval?
+    var sharedMaxAge: TimeInterval?
+    var noStore = false
+    var noCache = false
+    var isPrivate = false
+    var isPublic = false
+    var mustRevalidate = false
+
+    init(_ header: String?) {
+        guard let header else { return }
+        for directive in header.split(separator: ",") {
+            let parts = directive.split(separator: "=", maxSplits: 1)
+            let name = parts[0].trimmingCharacters(in: .whitespaces).lowercased()
+            let value = parts.count > 1
+                ? parts[1].trimmingCharacters(in: .whitespaces).trimmingCharacters(in: CharacterSet(charactersIn: "\""))
+                : nil
+            switch name {
+            case "max-age": maxAge = value.flatMap(TimeInterval.init)
+            case "s-maxage": sharedMaxAge = value.flatMap(TimeInterval.init)
+            case "no-store": noStore = true
+            // `no-cache="field"` only restricts those fields; treat any
+            // form as "revalidate every time", which is always safe
+            case "no-cache": noCache = true
+            case "private": isPrivate = true
+            case "public": isPublic = true
+            case "must-revalidate", "proxy-revalidate": mustRevalidate = true
+            default: break
+            }
+        }
+    }
+}
+
+// MARK: - Response Cache
+
+/// Case-insensitive header lookup over the case-preserving dictionaries
+/// used by HTTPClientResponse
+@inline(__always)
+func httpHeader(_ name: String, in headers: [String: String]) -> String? {
+    if let exact = headers[name] { return exact }
+    for (key, value) in headers where key.caseInsensitiveCompare(name) == .orderedSame {
+        return value
+    }
+    return nil
+}
+
+/// In-memory HTTP cache shared by every outbound client
+public final class HTTPResponseCache: @unchecked Sendable {
+    struct Entry {
+        var response: HTTPClientResponse
+        /// Local time the response was received (or last revalidated)
+        var storedAt: Date
+        /// Age the response already had when it arrived (Age header)
+        var initialAge: TimeInterval
+        var freshnessLifetime: TimeInterval
+        var requiresRevalidation: Bool
+        /// Request header values the response varies on (lowercased names)
+        var varyValues: [String: String]
+        var lastAccess: UInt64
+
+        var etag: String? { httpHeader("ETag", in: response.headers) }
+        var lastModified: String? { httpHeader("Last-Modified", in: response.headers) }
+        var hasValidator: Bool { etag != nil || lastModified != nil }
+    }
+
+    /// Result of a cache lookup
+    enum Lookup {
+        /// Serve this response as-is
+        case fresh(HTTPClientResponse)
+        /// Revalidate with these conditional headers, fall back to the entry on 304
+        case stale(conditionalHeaders: [String: String])
+        case miss
+    }
+
+    private let lock = NSLock()
+    private var entries: [String: Entry] = [:]
+    private var accessClock: UInt64 = 0
+    private let tuning: HTTPClientTuning
+    private let now: @Sendable () -> Date
+
+    public init(tuning: HTTPClientTuning = .current, now: @escaping @Sendable () -> Date = { Date() }) {
+        self.tuning = tuning
+        self.now = now
+    }
+
+    /// Number of cached responses
+    public var count: Int {
+        lock.lock(); defer { lock.unlock() }
+        return entries.count
+    }
+
+    /// Drops every cached response
+    public func removeAll() {
+        lock.lock(); defer { lock.unlock() }
+        entries.removeAll()
+    }
+
+    /// Primary cache key. Only GET responses are stored; HEAD is answered from them.
+    static func key(url: String) -> String {
+        "GET " + url
+    }
+
+    func lookup(url: String, requestHeaders: [String: String]) -> Lookup {
+        let requestControl = CacheControl(httpHeader("Cache-Control", in: requestHeaders))
+        if requestControl.noStore { return .miss }
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        let key = Self.key(url: url)
+        guard var entry = entries[key] else { return .miss }
+
+        // Vary: the stored response only answers requests with the same values
+        for (name, value) in entry.varyValues where (httpHeader(name, in: requestHeaders) ?? "") != value {
+            return .miss
+        }
+
+        accessClock &+= 1
+        entry.lastAccess = accessClock
+        entries[key] = entry
+
+        let age = entry.initialAge + max(0, now().timeIntervalSince(entry.storedAt))
+        var lifetime = entry.freshnessLifetime
+        if let requestMaxAge = requestControl.maxAge {
+            lifetime = min(lifetime, requestMaxAge)
+        }
+        if !requestControl.noCache && !entry.requiresRevalidation && age < lifetime {
+            return .fresh(entry.response)
+        }
+
+        guard entry.hasValidator else { return .miss }
+        var conditional: [String: String] = [:]
+        if let etag = entry.etag { conditional["If-None-Match"] = etag }
+        if let lastModified = entry.lastModified { conditional["If-Modified-Since"] = lastModified }
+        return .stale(conditionalHeaders: conditional)
+    }
+
+    /// Stores `response` if its status and headers make it cacheable
+    func store(url: String, requestHeaders: [String: String], response: HTTPClientResponse) {
+        guard Self.cacheableStatuses.contains(response.statusCode) else { return }
+        guard (response.body?.count ?? 0) <= tuning.cacheMaxBodyBytes else { return }
+
+        let requestControl = CacheControl(httpHeader("Cache-Control", in: requestHeaders))
+        let control = CacheControl(httpHeader("Cache-Control", in: response.headers))
+        if requestControl.noStore || control.noStore || control.isPrivate { return }
+
+        // Shared cache: authorized responses only with explicit permission
+        if httpHeader("Authorization", in: requestHeaders) != nil
+            && !(control.isPublic || control.sharedMaxAge != nil || control.mustRevalidate) {
+            return
+        }
+
+        var varyValues: [String: String] = [:]
+        if let vary = httpHeader("Vary", in: response.headers) {
+            for name in vary.split(separator: ",") {
+                let field = name.trimmingCharacters(in: .whitespaces).lowercased()
+                if field == "*" { return }
+                varyValues[field] = httpHeader(field, in: requestHeaders) ?? ""
+            }
+        }
+
+        let received = now()
+        let lifetime = Self.freshnessLifetime(control: control, headers: response.headers)
+        let initialAge = httpHeader("Age", in: response.headers).flatMap(TimeInterval.init) ?? 0
+
+        let hasValidator = httpHeader("ETag", in: response.headers) != nil
+            || httpHeader("Last-Modified", in: response.headers) != nil
+        // Nothing to gain from an entry that is never fresh and can't be revalidated
+        guard lifetime > 0 || hasValidator else { return }
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        accessClock &+= 1
+        entries[Self.key(url: url)] = Entry(
+            response: response,
+            storedAt: received,
+            initialAge: initialAge,
+            freshnessLifetime: lifetime,
+            requiresRevalidation: control.noCache,
+            varyValues: varyValues,
+            lastAccess: accessClock
+        )
+        evictIfNeededLocked()
+    }
+
+    /// Applies a 304 to the stored entry and returns the refreshed response
+    func revalidated(url: String, notModified: HTTPClientResponse) -> HTTPClientResponse? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let key = Self.key(url: url)
+        guard var entry = entries[key] else { return nil }
+
+        // Headers on the 304 replace the stored ones (RFC 9111 §4.3.4)
+        var headers = entry.response.headers
+        for (name, value) in notModified.headers {
+            if let existing = headers.keys.first(where: { $0.caseInsensitiveCompare(name) == .orderedSame }) {
+                headers.removeValue(forKey: existing)
+            }
+            headers[name] = value
+        }
+        let control = CacheControl(httpHeader("Cache-Control", in: headers))
+        entry.response = HTTPClientResponse(statusCode: entry.response.statusCode, headers: headers, body: entry.response.body)
+        entry.storedAt = now()
+        entry.initialAge = httpHeader("Age", in: notModified.headers).flatMap(TimeInterval.init) ?? 0
+        entry.freshnessLifetime = Self.freshnessLifetime(control: control, headers: headers)
+        entry.requiresRevalidation = control.noCache
+        accessClock &+= 1
+        entry.lastAccess = accessClock
+        entries[key] = entry
+        return entry.response
+    }
+
+    /// Invalidates the entry for `url` (after an unsafe method)
+    func invalidate(url: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        entries.removeValue(forKey: Self.key(url: url))
+    }
+
+    // MARK: Policy
+
+    /// Statuses cacheable by default (RFC 9110 §15.1)
+    static let cacheableStatuses: Set<Int> = [200, 203, 204, 300, 301, 308, 404, 405, 410, 414, 501]
+
+    /// DateFormatter isn't Sendable; every use goes through `dateLock`
+    nonisolated(unsafe) private static let httpDateFormatter: DateFormatter = {
+        let f = DateFormatter()
+        f.locale = Locale(identifier: "en_US_POSIX")
+        f.timeZone = TimeZone(identifier: "GMT")
+        f.dateFormat = "EEE, dd MMM yyyy HH:mm:ss zzz"
+        return f
+    }()
+
+    private static let dateLock = NSLock()
+
+    static func parseHTTPDate(_ value: String) -> Date? {
+        dateLock.lock(); defer { dateLock.unlock() }
+        return httpDateFormatter.date(from: value)
+    }
+
+    static func freshnessLifetime(control: CacheControl, headers: [String: String]) -> TimeInterval {
+        if let shared = control.sharedMaxAge { return shared }
+        if let maxAge = control.maxAge { return maxAge }
+        if let expires = httpHeader("Expires", in: headers) {
+            guard let expiresDate = parseHTTPDate(expires) else { return 0 }  // invalid Expires = already expired
+            let date = httpHeader("Date", in: headers).flatMap(parseHTTPDate) ?? Date()
+            return max(0, expiresDate.timeIntervalSince(date))
+        }
+        return 0
+    }
+
+    private func evictIfNeededLocked() {
+        guard entries.count > tuning.cacheMaxEntries else { return }
+        // Evict the least recently used tenth in one pass so the O(n)
+        // scan is amortised over many inserts
+        let excess = entries.count - tuning.cacheMaxEntries + max(1, tuning.cacheMaxEntries / 10)
+        let victims = entries.sorted { $0.value.lastAccess < $1.value.lastAccess }.prefix(excess)
+        for (key, _) in victims {
+            entries.removeValue(forKey: key)
+        }
+    }
+}
+
+// MARK: - Request Coalescing
+
+/// Single-flight for identical in-flight requests: the first caller
+/// performs the fetch, later callers with the same key await its result.
+public final class HTTPRequestCoalescer: @unchecked Sendable {
+    private let lock = NSLock()
+    private var inFlight: [String: Task<HTTPClientResponse, Error>] = [:]
+
+    public init() {}
+
+    /// Number of distinct requests currently in flight
+    public var inFlightCount: Int {
+        lock.lock(); defer { lock.unlock() }
+        return inFlight.count
+    }
+
+    public func run(
+        key: String,
+        _ fetch: @escaping @Sendable () async throws -> HTTPClientResponse
+    ) async throws -> HTTPClientResponse {
+        lock.lock()
+        if let existing = inFlight[key] {
+            lock.unlock()
+            return try await existing.value
+        }
+        // Unstructured so one caller's cancellation doesn't fail everyone
+        // else waiting on the same response
+        let task = Task<HTTPClientResponse, Error> { try await fetch() }
+        inFlight[key] = task
+        lock.unlock()
+
+        defer {
+            lock.lock()
+            inFlight.removeValue(forKey: key)
+            lock.unlock()
+        }
+        return try await task.value
+    }
+}
+
+// MARK: - Pipeline
+
+/// Cache + coalescing front end shared by every outbound HTTP client.
+/// The transport (URLSession, AsyncHTTPClient) is passed in as `fetch`.
+public final class HTTPClientPipeline: Sendable {
+    public static let shared = HTTPClientPipeline()
+
+    public let tuning: HTTPClientTuning
+    public let cache: HTTPResponseCache
+    public let coalescer: HTTPRequestCoalescer
+
+    public init(tuning: HTTPClientTuning = .current, now: @escaping @Sendable () -> Date = { Date() }) {
+        self.tuning = tuning
+        self.cache = HTTPResponseCache(tuning: tuning, now: now)
+        self.coalescer = HTTPRequestCoalescer()
+    }
+
+    /// Performs a request through the cache and single-flight layers.
+    /// `fetch` receives the headers to send (the caller's plus any
+    /// conditional headers added for revalidation).
+    public func perform(
+        method: String,
+        url: String,
+        headers: [String: String],
+        body: Data?,
+        fetch: @escaping @Sendable (_ headers: [String: String]) async throws -> HTTPClientResponse
+    ) async throws -> HTTPClientResponse {
+        let upperMethod = method.uppercased()
+        let isSafe = (upperMethod == "GET" || upperMethod == "HEAD") && body == nil
+
+        guard isSafe else {
+            let response = try await fetch(headers)
+            if tuning.cacheEnabled && (200..<400).contains(response.statusCode) {
+                cache.invalidate(url: url)
+            }
+            return response
+        }
+
+        // HEAD never populates the cache (no body) but may be answered from it
+        var sendHeaders = headers
+        var revalidating = false
+        if tuning.cacheEnabled {
+            switch cache.lookup(url: url, requestHeaders: headers) {
+            case .fresh(let response):
+                return upperMethod == "HEAD"
+                    ? HTTPClientResponse(statusCode: response.statusCode, headers: response.headers, body: nil)
+                    : response
+            case .stale(let conditional):
+                // Caller-supplied validators win; they expect to see the 304 themselves
+                if upperMethod == "GET"
+                    && httpHeader("If-None-Match", in: headers) == nil
+                    && httpHeader("If-Modified-Since", in: headers) == nil {
+                    sendHeaders.merge(conditional) { current, _ in current }
+                    revalidating = true
+                }
+            case .miss:
+                break
+            }
+        }
+
+        let requestHeaders = sendHeaders
+        let wasRevalidating = revalidating
+        let exchange: @Sendable () async throws -> HTTPClientResponse = { [cache, tuning] in
+            let response = try await fetch(requestHeaders)
+            guard tuning.cacheEnabled && upperMethod == "GET" else { return response }
+            if wasRevalidating && response.statusCode == 304 {
+                return cache.revalidated(url: url, notModified: response) ?? response
+            }
+            cache.store(url: url, requestHeaders: headers, response: response)
+            return response
+        }
+
+        guard tuning.coalesceRequests else { return try await exchange() }
+        return try await coalescer.run(key: Self.coalescingKey(method: upperMethod, url: url, headers: sendHeaders), exchange)
+    }
+
+    /// Requests coalesce only when everything that could change the
+    /// response (method, URL, every header) is identical
+    static func coalescingKey(method: String, url: String, headers: [String: String]) -> String {
+        var key = method + " " + url
+        for (name, value) in headers.sorted(by: { $0.key.lowercased() < $1.key.lowercased() }) {
+            key += "\n" + name.lowercased() + ":" + value
+        }
+        return key
+    }
+}
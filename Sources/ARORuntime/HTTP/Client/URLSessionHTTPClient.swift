@@ -23,19 +23,30 @@ public final class URLSessionHTTPClient: HTTPClientService, @unchecked Sendable
     private let session: URLSession
     private let eventBus: EventBus
     private let timeout: TimeInterval
+    private let pipeline: HTTPClientPipeline
+
+    /// Process-wide instance used by the C bridge (`aro_http_request_execute`)
+    public static let shared = URLSessionHTTPClient()
 
     // MARK: - Initialization
 
     public init(
         eventBus: EventBus = .shared,
-        timeout: TimeInterval = 30.0
+        timeout: TimeInterval = 30.0,
+        pipeline: HTTPClientPipeline = .shared
     ) {
         let config = URLSessionConfiguration.default
         config.timeoutIntervalForRequest = timeout
         config.timeoutIntervalForResource = timeout * 2
+        config.httpMaximumConnectionsPerHost = pipeline.tuning.maxConnectionsPerHost
+        // HTTPClientPipeline owns caching; a second URLCache layer would
+        // answer our conditional requests itself and hide 304s from it
+        config.urlCache = nil
+        config.requestCachePolicy = .reloadIgnoringLocalCacheData
         self.session = URLSession(configuration: config)
         self.eventBus = eventBus
         self.timeout = timeout
+        self.pipeline = pipeline
     }
 
     // MARK: - HTTPClientService
@@ -108,14 +119,39 @@ public final class URLSessionHTTPClient: HTTPClientService, @unchecked Sendable
         try await performRequest(method: "PATCH", url: url, headers: headers, body: body, timeout: timeout)
     }
 
+    /// Perform a request with an arbitrary method
+    public func execute(
+        method: String,
+        url: String,
+        headers: [String: String] = [:],
+        body: Data? = nil,
+        timeout: TimeInterval? = nil
+    ) async throws -> HTTPClientResponse {
+        try await performRequest(method: method, url: url, headers: headers, body: body, timeout: timeout)
+    }
+
     // MARK: - Private
 
+    /// Routes the request through the shared cache / single-flight pipeline
     private func performRequest(
         method: String,
         url: String,
         headers: [String: String],
         body: Data?,
         timeout: TimeInterval? = nil
+    ) async throws -> HTTPClientResponse {
+        try await pipeline.perform(method: method, url: url, headers: headers, body: body) { sendHeaders in
+            try await self.send(method: method, url: url, headers: sendHeaders, body: body, timeout: timeout)
+        }
+    }
+
+    /// Sends the request upstream
+    private func send(
+        method: String,
+        url: String,
+        headers: [String: String],
+        body: Data?,
+        timeout: TimeInterval?
     ) async throws -> HTTPClientResponse {
         guard let requestURL = URL(string: url) else {
             throw HTTPError.custom("Invalid URL: \(url)")
@@ -235,6 +235,28 @@ public struct JSONRPCHandler: Sendable {
         return try parseRequest(data)
     }
 
+    /// Parse a JSON-RPC batch (a top-level array). Elements that are not
+    /// valid requests come back as `.invalidRequest` so each one still
+    /// gets its own error response.
+    public func parseBatch(_ data: Data) throws -> [Result<JSONRPCRequest, JSONRPCError>] {
+        let elements: [BatchElement]
+        do {
+            elements = try decoder.decode([BatchElement].self, from: data)
+        } catch {
+            throw JSONRPCError.parseError
+        }
+        return elements.map { $0.request.map(Result.success) ?? .failure(.invalidRequest) }
+    }
+
+    /// Encode a batch of JSON-RPC responses as one array
+    public func encodeResponses(_ responses: [JSONRPCResponse]) throws -> String {
+        let data = try encoder.encode(responses)
+        guard let string = String(data: data, encoding: .utf8) else {
+            throw JSONRPCError.internalError
+        }
+        return string
+    }
+
     /// Encode a JSON-RPC response to string
     public func encodeResponse(_ response: JSONRPCResponse) throws -> String {
         let data = try encoder.encode(response)
@@ -255,6 +277,15 @@ public struct JSONRPCHandler: Sendable {
     }
 }
 
+/// One element of a batch; `request` is nil when it does not decode
+private struct BatchElement: Decodable {
+    let request: JSONRPCRequest?
+
+    init(from decoder: Decoder) throws {
+        request = try? JSONRPCRequest(from: decoder)
+    }
+}
+
 // MARK: - JSONValue Builders
 
 extension JSONValue {
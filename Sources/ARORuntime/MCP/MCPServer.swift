@@ -2,15 +2,45 @@
 // MCPServer.swift
 // ARO MCP - Model Context Protocol Server
 // ============================================================
+//
+// The message loop only reads and dispatches; requests run as their own
+// tasks, so a slow `tools/call` no longer holds up the requests behind
+// it or the `notifications/cancelled` meant for it:
+//
+//   - At most `maxInFlight` requests execute at once (default: the core
+//     count, at least 4, `ARO_MCP_MAX_IN_FLIGHT` overrides). Later ones
+//     wait for a slot in arrival order while the loop keeps reading.
+//   - `notifications/cancelled` cancels the request's task, or drops it
+//     if it is still waiting. A cancelled request gets no response.
+//   - Responses go through one writer task in completion order, one
+//     complete line at a time.
+//   - A JSON-RPC batch (top-level array) runs its requests concurrently
+//     and is answered with one array once all of them finished.
+//
+// On end of input the server lets in-flight requests finish and flushes
+// their responses before it stops the transport.
 
 import Foundation
 
 /// ARO MCP Server
 /// Exposes ARO capabilities to LLMs via the Model Context Protocol
 public actor MCPServer {
-    private let transport: StdioTransport
+    /// Requests executing at once unless `init` says otherwise
+    static let defaultMaxInFlight: Int = {
+        if let configured = ProcessInfo.processInfo.environment["ARO_MCP_MAX_IN_FLIGHT"].flatMap(Int.init),
+           configured > 0 {
+            return configured
+        }
+        return max(4, ProcessInfo.processInfo.activeProcessorCount)
+    }()
+
+    /// Runs a `tools/call`; tests substitute slow and fast tools
+    typealias ToolHandler = @Sendable (_ name: String, _ arguments: JSONValue?) async -> MCPToolCallResult
+
+    private let transport: any MCPTransport
     private let jsonRpc: JSONRPCHandler
     private let toolProvider: MCPToolProvider
+    private let toolHandler: ToolHandler
     private let resourceProvider: MCPResourceProvider
     private let promptProvider: MCPPromptProvider
 
@@ -19,65 +49,126 @@ public actor MCPServer {
     private var verbose: Bool
     private let version: String
 
+    // MARK: Dispatch State
+
+    private let maxInFlight: Int
+    /// Requests holding an execution slot
+    private var running = 0
+    /// Requests waiting for a slot, oldest first
+    private var slotWaiters: [(token: Int, continuation: CheckedContinuation<Bool, Never>)] = []
+    /// Task of every dispatched request that has not finished
+    private var calls: [Int: Task<Void, Never>] = [:]
+    /// Request id → token of the call it names, for cancellation
+    private var tokens: [JSONRPCId: Int] = [:]
+    /// Calls cancelled by the client; their responses are dropped
+    private var cancelled: Set<Int> = []
+    private var nextToken = 0
+    private var batches: [Int: PendingBatch] = [:]
+    private var nextBatch = 0
+    private var outbox: AsyncStream<String>.Continuation?
+
+    /// Where a request's response goes
+    private enum ReplyTarget {
+        case single
+        case batch(Int, index: Int)
+    }
+
+    /// Responses of a batch collected until every request finished
+    private struct PendingBatch {
+        var responses: [JSONRPCResponse?]
+        var remaining: Int
+    }
+
     public init(basePath: String? = nil, verbose: Bool = false, version: String = "0.4.0") {
-        self.transport = StdioTransport()
+        self.init(transport: StdioTransport(), basePath: basePath, verbose: verbose, version: version)
+    }
+
+    init(
+        transport: any MCPTransport,
+        basePath: String? = nil,
+        verbose: Bool = false,
+        version: String = "0.4.0",
+        maxInFlight: Int = MCPServer.defaultMaxInFlight,
+        toolHandler: ToolHandler? = nil
+    ) {
+        let toolProvider = MCPToolProvider()
+        self.transport = transport
         self.jsonRpc = JSONRPCHandler()
-        self.toolProvider = MCPToolProvider()
+        self.toolProvider = toolProvider
+        self.toolHandler = toolHandler ?? { name, arguments in
+            await toolProvider.callTool(name: name, arguments: arguments)
+        }
         self.resourceProvider = basePath.map { MCPResourceProvider(basePath: $0) } ?? MCPResourceProvider()
         self.promptProvider = MCPPromptProvider()
         self.verbose = verbose
         self.version = version
+        self.maxInFlight = max(1, maxInFlight)
     }
 
     /// Start the MCP server
     public func run() async {
         isRunning = true
 
+        let (messages, outbox) = AsyncStream.makeStream(of: String.self)
+        self.outbox = outbox
+        let writer = Task { [transport, verbose] in
+            for await message in messages {
+                if verbose {
+                    Self.log("Sending: \(message)")
+                }
+                do {
+                    try await transport.send(message)
+                } catch {
+                    Self.log("Error: \(error)")
+                }
+            }
+        }
+
         do {
             try await transport.start()
 
             if verbose {
-                await transport.log("ARO MCP Server started")
+                Self.log("ARO MCP Server started")
             }
 
-            // Main message loop
+            // Main message loop: read and dispatch, never wait for a request
             while isRunning {
                 guard let line = try await transport.receive() else {
                     // EOF - stdin closed
                     if verbose {
-                        await transport.log("Input stream closed")
+                        Self.log("Input stream closed")
                     }
                     break
                 }
 
-                if line.isEmpty {
+                if line.allSatisfy(\.isWhitespace) {
                     continue
                 }
 
                 if verbose {
-                    await transport.log("Received: \(line)")
+                    Self.log("Received: \(line)")
                 }
 
-                // Handle the message
-                let response = await handleMessage(line)
-
-                if let response = response {
-                    if verbose {
-                        await transport.log("Sending: \(response)")
-                    }
-                    try await transport.send(response)
-                }
+                dispatch(line)
             }
         } catch {
             if verbose {
-                await transport.log("Error: \(error)")
+                Self.log("Error: \(error)")
             }
         }
 
+        // Let in-flight requests finish, then flush their responses
+        while let call = calls.values.first {
+            await call.value
+        }
+        outbox.finish()
+        self.outbox = nil
+        await writer.value
+
         await transport.stop()
 
         if verbose {
-            await transport.log("ARO MCP Server stopped")
+            Self.log("ARO MCP Server stopped")
         }
     }
 
@@ -88,59 +179,219 @@ public actor MCPServer {
 
     // MARK: - Message Handling
 
-    private func handleMessage(_ message: String) async -> String? {
+    /// Parse one input line and start its request(s)
+    private func dispatch(_ line: String) {
+        if line.first(where: { !$0.isWhitespace }) == "[" {
+            dispatchBatch(line)
+            return
+        }
+
         // Parse first so a valid request's id is preserved on any later error.
         let request: JSONRPCRequest
         do {
-            request = try jsonRpc.parseRequest(message)
+            request = try jsonRpc.parseRequest(line)
         } catch let error as JSONRPCError {
-            let response = jsonRpc.errorResponse(id: nil, error: error)
-            return try? jsonRpc.encodeResponse(response)
+            write(jsonRpc.errorResponse(id: nil, error: error))
+            return
         } catch {
-            let response = jsonRpc.errorResponse(id: nil, error: .parseError)
-            return try? jsonRpc.encodeResponse(response)
+            write(jsonRpc.errorResponse(id: nil, error: .parseError))
+            return
         }
 
         // Notifications don't get responses
         if request.isNotification {
-            await handleNotification(request)
-            return nil
+            handleNotification(request)
+            return
         }
+        start(request, replyTo: .single)
+    }
 
+    private func dispatchBatch(_ line: String) {
+        let elements: [Result<JSONRPCRequest, JSONRPCError>]
+        do {
+            elements = try jsonRpc.parseBatch(Data(line.utf8))
+        } catch {
+            write(jsonRpc.errorResponse(id: nil, error: .parseError))
+            return
+        }
+        guard !elements.isEmpty else {
+            write(jsonRpc.errorResponse(id: nil, error: .invalidRequest))
+            return
+        }
+
+        let batch = nextBatch
+        nextBatch += 1
+        var pending = PendingBatch(responses: Array(repeating: nil, count: elements.count), remaining: 0)
+        var requests: [(index: Int, request: JSONRPCRequest)] = []
+        for (index, element) in elements.enumerated() {
+            switch element {
+            case .failure(let error):
+                pending.responses[index] = jsonRpc.errorResponse(id: nil, error: error)
+            case .success(let request) where request.isNotification:
+                handleNotification(request)
+            case .success(let request):
+                requests.append((index, request))
+            }
+        }
+        pending.remaining = requests.count
+        batches[batch] = pending
+        if requests.isEmpty {
+            completeBatch(batch)
+        }
+        for (index, request) in requests {
+            start(request, replyTo: .batch(batch, index: index))
+        }
+    }
+
+    /// Run `request` as its own task once an execution slot is free
+    private func start(_ request: JSONRPCRequest, replyTo target: ReplyTarget) {
+        let token = nextToken
+        nextToken += 1
+        if let id = request.id {
+            tokens[id] = token
+        }
+        calls[token] = Task {
+            guard await acquireSlot(for: token) else {
+                finish(token, request: request, response: nil, holdsSlot: false, replyTo: target)
+                return
+            }
+            let response = await respond(to: request)
+            finish(token, request: request, response: response, holdsSlot: true, replyTo: target)
+        }
+    }
+
+    private func respond(to request: JSONRPCRequest) async -> JSONRPCResponse {
         do {
             let result = try await handleRequest(request)
-            let response = jsonRpc.successResponse(id: request.id, result: result)
-            return try jsonRpc.encodeResponse(response)
+            return jsonRpc.successResponse(id: request.id, result: result)
         } catch let error as JSONRPCError {
-            let response = jsonRpc.errorResponse(id: request.id, error: error)
-            return try? jsonRpc.encodeResponse(response)
+            return jsonRpc.errorResponse(id: request.id, error: error)
         } catch {
-            let response = jsonRpc.errorResponse(id: request.id, error: .internalError)
-            return try? jsonRpc.encodeResponse(response)
+            return jsonRpc.errorResponse(id: request.id, error: .internalError)
         }
     }
 
-    private func handleNotification(_ request: JSONRPCRequest) async {
+    private func finish(
+        _ token: Int,
+        request: JSONRPCRequest,
+        response: JSONRPCResponse?,
+        holdsSlot: Bool,
+        replyTo target: ReplyTarget
+    ) {
+        calls[token] = nil
+        if let id = request.id, tokens[id] == token {
+            tokens[id] = nil
+        }
+        if holdsSlot {
+            releaseSlot()
+        }
+        // The client gave up on a cancelled request: no response
+        let reply = cancelled.remove(token) == nil ? response : nil
+
+        switch target {
+        case .single:
+            if let reply {
+                write(reply)
+            }
+        case .batch(let batch, let index):
+            batches[batch]?.responses[index] = reply
+            batches[batch]?.remaining -= 1
+            if batches[batch]?.remaining == 0 {
+                completeBatch(batch)
+            }
+        }
+    }
+
+    private func completeBatch(_ batch: Int) {
+        guard let pending = batches.removeValue(forKey: batch) else { return }
+        let responses = pending.responses.compactMap { $0 }
+        // A batch of notifications only gets no response at all
+        guard !responses.isEmpty, let encoded = try? jsonRpc.encodeResponses(responses) else { return }
+        outbox?.yield(encoded)
+    }
+
+    /// Queue a response for the writer task
+    private func write(_ response: JSONRPCResponse) {
+        guard let encoded = try? jsonRpc.encodeResponse(response) else { return }
+        outbox?.yield(encoded)
+    }
+
+    // MARK: - Execution Slots
+
+    /// Wait for one of the `maxInFlight` slots. False when the request
+    /// was cancelled while it waited.
+    private func acquireSlot(for token: Int) async -> Bool {
+        if cancelled.contains(token) {
+            return false
+        }
+        if running < maxInFlight {
+            running += 1
+            return true
+        }
+        return await withCheckedContinuation { continuation in
+            slotWaiters.append((token, continuation))
+        }
+    }
+
+    /// Hand the slot to the oldest waiter, or free it
+    private func releaseSlot() {
+        if slotWaiters.isEmpty {
+            running -= 1
+        } else {
+            slotWaiters.removeFirst().continuation.resume(returning: true)
+        }
+    }
+
+    // MARK: - Notifications
+
+    private func handleNotification(_ request: JSONRPCRequest) {
         switch request.method {
         case "notifications/initialized":
             // Client has completed initialization
             if verbose {
-                await transport.log("Client initialized")
+                Self.log("Client initialized")
             }
 
         case "notifications/cancelled":
-            // Request was cancelled
-            if verbose {
-                await transport.log("Request cancelled")
-            }
+            cancelRequest(request.params?["requestId"])
 
         default:
             if verbose {
-                await transport.log("Unknown notification: \(request.method)")
+                Self.log("Unknown notification: \(request.method)")
             }
         }
     }
 
+    /// Cancel the call a `notifications/cancelled` names. Unknown or
+    /// already answered ids are ignored, as the protocol requires.
+    private func cancelRequest(_ requestId: JSONValue?) {
+        let id: JSONRPCId
+        switch requestId {
+        case .string(let value)?:
+            id = .string(value)
+        case .number(let value)?:
+            id = .number(Int(value))
+        default:
+            return
+        }
+        guard let token = tokens[id] else { return }
+
+        cancelled.insert(token)
+        if let index = slotWaiters.firstIndex(where: { $0.token == token }) {
+            slotWaiters.remove(at: index).continuation.resume(returning: false)
+        } else {
+            calls[token]?.cancel()
+        }
+        if verbose {
+            Self.log("Request cancelled: \(id)")
+        }
+    }
+
+    /// Diagnostics go to stderr; stdout carries the protocol
+    private static func log(_ message: String) {
+        FileHandle.standardError.write(Data("[ARO MCP] \(message)\n".utf8))
+    }
+
     private func handleRequest(_ request: JSONRPCRequest) async throws -> JSONValue {
         switch request.method {
         // Lifecycle
@@ -226,7 +477,7 @@ public actor MCPServer {
         }
 
         let arguments = params["arguments"]
-        let result = await toolProvider.callTool(name: name, arguments: arguments)
+        let result = await toolHandler(name, arguments)
         return result.toJSONValue()
     }
 
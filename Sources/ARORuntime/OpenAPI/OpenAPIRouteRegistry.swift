@@ -23,6 +23,22 @@ public struct OpenAPIRouteRegistry: Sendable {
     private static func buildRoutes(from spec: OpenAPISpec) -> [Route] {
         var routes: [Route] = []
 
+        // Response schemas are compiled here, once, into one program
+        // shared by every route
+        var compiler = SchemaCompiler(components: spec.components)
+        var responseRoots: [[String: Int]] = []
+        func compileSchemas(of operation: Operation) {
+            var responses: [String: Int] = [:]
+            for (status, response) in operation.responses {
+                if let content = response.content,
+                   let mediaType = content["application/json"] ?? content.values.first,
+                   let schema = mediaType.schema?.value {
+                    responses[status] = compiler.add(schema)
+                }
+            }
+            responseRoots.append(responses)
+        }
+
         // Regular paths: keyed by their URL template, dispatched by operationId.
         for (pathTemplate, pathItem) in spec.paths {
             let pattern = PathPattern(template: pathTemplate)
@@ -32,6 +48,7 @@ public struct OpenAPIRouteRegistry: Sendable {
             for (method, operation) in pathItem.allOperations {
                 guard let operationId = operation.operationId else { continue }
 
+                compileSchemas(of: operation)
                 routes.append(Route(
                     method: method.uppercased(),
                     pattern: pattern,
@@ -56,6 +73,7 @@ public struct OpenAPIRouteRegistry: Sendable {
 
             for (method, operation) in item.allOperations {
                 let handlerName = operation.operationId ?? name
+                compileSchemas(of: operation)
                 routes.append(Route(
                     method: method.uppercased(),
                     pattern: pattern,
@@ -67,6 +85,11 @@ public struct OpenAPIRouteRegistry: Sendable {
             }
         }
 
+        let program = compiler.build()
+        for index in routes.indices {
+            routes[index].responseSchemas = responseRoots[index].mapValues(program.schema)
+        }
+
         // Sort routes: more specific patterns first (fewer wildcards)
         routes.sort { $0.pattern.specificity > $1.pattern.specificity }
 
@@ -92,7 +115,8 @@ public struct OpenAPIRouteRegistry: Sendable {
                     operation: route.operation,
                     pathTemplate: route.pattern.template,
                     pathLevelParameters: route.pathParameters,
-                    isWebhook: route.isWebhook
+                    isWebhook: route.isWebhook,
+                    responseSchemas: route.responseSchemas
                 )
             }
         }
@@ -130,6 +154,8 @@ struct Route: Sendable {
     /// True when this route originates from a top-level `webhooks` entry
     /// (OpenAPI 3.1) rather than from `paths`.
     let isWebhook: Bool
+    /// Compiled response schemas keyed by status code ("200", "default")
+    var responseSchemas: [String: CompiledSchema] = [:]
 }
 
 // MARK: - Route Match
@@ -155,13 +181,18 @@ public struct RouteMatch: Sendable {
     /// (OpenAPI 3.1 incoming webhook) rather than from `paths`.
     public let isWebhook: Bool
 
+    /// The operation's response schemas compiled at registration, keyed by
+    /// status code as in `operation.responses`
+    public let responseSchemas: [String: CompiledSchema]
+
     public init(
         operationId: String,
         pathParameters: [String: String],
         operation: Operation,
         pathTemplate: String,
         pathLevelParameters: [Parameter]?,
-        isWebhook: Bool = false
+        isWebhook: Bool = false,
+        responseSchemas: [String: CompiledSchema] = [:]
     ) {
         self.operationId = operationId
         self.pathParameters = pathParameters
@@ -169,6 +200,7 @@ public struct RouteMatch: Sendable {
         self.pathTemplate = pathTemplate
         self.pathLevelParameters = pathLevelParameters
         self.isWebhook = isWebhook
+        self.responseSchemas = responseSchemas
     }
 
     /// Effective parameters: path-level parameters merged with operation-level parameters.
@@ -159,7 +159,7 @@ public struct SchemaBinding {
     /// marker protocol, and a direct `as!` triggers an "always succeeds" warning. Routing through
     /// a generic suppresses the warning while keeping the runtime cast that the original code did.
     @inline(__always)
-    private static func assumeSendable(_ value: Any) -> any Sendable {
+    static func assumeSendable(_ value: Any) -> any Sendable {
         func cast<T>(_ value: Any, to _: T.Type) -> T { value as! T }
         return cast(value, to: (any Sendable).self)
     }
@@ -631,6 +631,30 @@ extension SchemaBinding {
         }
     }
 
+    /// Validate a response body against the response schemas compiled for its route.
+    ///
+    /// Same lookup and result as `validateResponseBody(_:forStatusCode:operation:components:)`;
+    /// `compiled` is `RouteMatch.responseSchemas`.
+    public static func validateResponseBody(
+        _ body: Any,
+        forStatusCode statusCode: Int,
+        operation: Operation,
+        compiled: [String: CompiledSchema]
+    ) -> String? {
+        // A declared status code without a schema does not fall back to "default"
+        let key = operation.responses["\(statusCode)"] != nil ? "\(statusCode)" : "default"
+        guard let schema = compiled[key] else {
+            return nil  // No schema to validate against
+        }
+
+        do {
+            _ = try schema.validate(assumeSendable(body), schemaName: "response")
+            return nil  // Valid
+        } catch {
+            return error.localizedDescription
+        }
+    }
+
     /// Deserialize a query (or path) parameter from its raw string value(s) according
     /// to the OpenAPI `style` and `explode` serialization rules.
     ///
@@ -707,7 +731,7 @@ extension SchemaBinding {
     }
 
     /// Describe the runtime type of a value for error messages
-    private static func describeType(of value: any Sendable) -> String {
+    static func describeType(of value: any Sendable) -> String {
         switch value {
         case is String:
             return "string"
@@ -0,0 +1,863 @@
+// ============================================================
+// SchemaCompiler.swift
+// ARO Runtime - OpenAPI schemas compiled to validator programs
+// ============================================================
+//
+// `SchemaBinding.parseValue` and `validateAgainstSchema` interpret the
+// Schema tree on every call: `$ref` strings are split again, the set of
+// known property names is rebuilt, and every composition keyword is
+// re-tested. The compiler does that work once, when the route and
+// schema registries are built, and produces a flat program:
+//
+//   - Every schema is one node in an array. `$ref`s are resolved to node
+//     indices, so a recursive schema is simply an index cycle.
+//   - A `$ref` chain that loops back on itself (A → B → A) is reported
+//     at compile time; the affected nodes fail with an error instead of
+//     recursing forever. Composition loops (Pet → oneOf Cat → allOf Pet)
+//     may still terminate for some inputs, so their nodes are flagged
+//     and re-entry on the same value is detected at run time.
+//   - Object nodes carry one table for property and required names; the
+//     payload's keys are scanned once and required fields are tracked in
+//     a bitset.
+//   - `enum` and `const` become hash sets.
+//
+// Compiled validators keep the tree walkers' behaviour (coercions,
+// defaults, error cases and their order). The tree walkers remain the
+// reference implementation and serve one-off schemas.
+
+import Foundation
+
+// MARK: - Compiled Schema
+
+/// A schema compiled into a reusable validator program
+public struct CompiledSchema: Sendable {
+    let program: SchemaProgram
+    let root: Int
+
+    init(program: SchemaProgram, root: Int) {
+        self.program = program
+        self.root = root
+    }
+
+    /// Compile a single schema; `components` supplies `$ref` targets
+    public init(_ schema: Schema, components: Components?) {
+        var compiler = SchemaCompiler(components: components)
+        let root = compiler.add(schema)
+        self.init(program: compiler.build(), root: root)
+    }
+
+    /// Same contract as `SchemaBinding.parseValue(json:schema:components:)`
+    public func parseValue(_ json: Any) throws -> Any {
+        try program.parse(root, json)
+    }
+
+    /// Same contract as `SchemaBinding.validateAgainstSchema(value:schemaName:schema:components:)`
+    public func validate(_ value: any Sendable, schemaName: String) throws -> any Sendable {
+        try program.validate(root, value, schemaName: schemaName)
+    }
+}
+
+// MARK: - Compiler
+
+/// Builds a `SchemaProgram`. All component schemas are compiled up front
+/// so refs and discriminator lookups resolve to node indices; `add`
+/// compiles further (inline) schemas into the same program.
+struct SchemaCompiler {
+    private var nodes: [SchemaNode] = []
+    private var componentNodes: [String: Int] = [:]
+    private var nodeNames: [Int: String] = [:]
+    private var compiled: [ObjectIdentifier: Int] = [:]
+
+    init(components: Components?) {
+        let schemas = components?.schemas ?? [:]
+        let names = schemas.keys.sorted()
+        for name in names {
+            let index = reserve()
+            componentNodes[name] = index
+            nodeNames[index] = "#/components/schemas/\(name)"
+        }
+        for name in names {
+            let schema = schemas[name]!.value
+            let index = componentNodes[name]!
+            if let ref = schema.ref {
+                let target = resolve(ref)
+                nodes[index].kind = .alias(target)
+            } else {
+                compiled[ObjectIdentifier(schema)] = index
+                let node = makeNode(schema)
+                nodes[index] = node
+            }
+        }
+    }
+
+    /// Compile `schema` into the program and return its root index
+    mutating func add(_ schema: Schema) -> Int {
+        node(for: schema)
+    }
+
+    /// Resolve aliases, detect cycles and freeze the program
+    func build() -> SchemaProgram {
+        var nodes = self.nodes
+        var cycles: [String] = []
+
+        // Collapse `$ref` alias chains; a chain that revisits a node never
+        // reaches a real schema
+        var target = Array(nodes.indices)
+        for start in nodes.indices {
+            guard case .alias = nodes[start].kind else { continue }
+            var chain: [Int] = []
+            var current = start
+            while case .alias(let next) = nodes[current].kind {
+                if let loopStart = chain.firstIndex(of: current) {
+                    let path = (chain[loopStart...] + [current]).map { nodeNames[$0] ?? "#\($0)" }
+                    let description = "circular $ref: " + path.joined(separator: " -> ")
+                    cycles.append(description)
+                    for index in chain[loopStart...] {
+                        nodes[index] = SchemaNode(kind: .invalidReference(description))
+                    }
+                    break
+                }
+                chain.append(current)
+                current = next
+            }
+            for index in chain where target[index] == index {
+                target[index] = current
+            }
+        }
+        nodes = nodes.map { $0.remapped { target[$0] } }
+
+        // Flag nodes on composition cycles for the run-time re-entry check
+        let edges = nodes.map { $0.compositionTargets }
+        for index in nodes.indices where !edges[index].isEmpty {
+            var stack = edges[index]
+            var seen = Set<Int>()
+            while let next = stack.popLast() {
+                if next == index {
+                    nodes[index].isOnCompositionCycle = true
+                    break
+                }
+                if seen.insert(next).inserted {
+                    stack.append(contentsOf: edges[next])
+                }
+            }
+        }
+
+        return SchemaProgram(
+            nodes: nodes,
+            componentNodes: componentNodes.mapValues { target[$0] },
+            nodeNames: nodeNames,
+            cycles: cycles
+        )
+    }
+
+    // MARK: Nodes
+
+    private mutating func reserve() -> Int {
+        nodes.append(SchemaNode(kind: .untyped))
+        return nodes.count - 1
+    }
+
+    private mutating func node(for schema: Schema) -> Int {
+        if let ref = schema.ref {
+            return resolve(ref)
+        }
+        if let existing = compiled[ObjectIdentifier(schema)] {
+            return existing
+        }
+        let index = reserve()
+        compiled[ObjectIdentifier(schema)] = index
+        let node = makeNode(schema)
+        nodes[index] = node
+        return index
+    }
+
+    private mutating func resolve(_ ref: String) -> Int {
+        if let name = Self.componentName(fromRef: ref), let index = componentNodes[name] {
+            return index
+        }
+        nodes.append(SchemaNode(kind: .invalidReference(ref)))
+        return nodes.count - 1
+    }
+
+    private mutating func makeNode(_ schema: Schema) -> SchemaNode {
+        let kind: SchemaNode.Kind
+        switch schema.type {
+        case nil: kind = .untyped
+        case "string": kind = .string
+        case "number": kind = .number(isInteger: false)
+        case "integer": kind = .number(isInteger: true)
+        case "boolean": kind = .boolean
+        case "array": kind = .array(items: schema.items.map { node(for: $0.value) })
+        case "object": kind = .object(makeLayout(schema))
+        default: kind = .passthrough
+        }
+
+        var node = SchemaNode(kind: kind)
+        node.isNullable = schema.isNullable
+        node.composition = makeComposition(schema)
+        // Untyped schemas skip enum / const, as in the tree walker
+        if schema.type != nil {
+            if let values = schema.enumValues, !values.isEmpty {
+                node.allowed = ValueSet(values, description: values.map { "\($0.anyValue)" }.joined(separator: ", "))
+            }
+            if let constant = schema.const {
+                node.constant = ValueSet([constant], description: "\(constant.anyValue)")
+            }
+        }
+        return node
+    }
+
+    private mutating func makeLayout(_ schema: Schema) -> ObjectLayout {
+        var fields: [String: ObjectLayout.Field] = [:]
+        var defaults: [ObjectLayout.Default] = []
+        for (key, ref) in schema.properties ?? [:] {
+            fields[key, default: ObjectLayout.Field()].property = node(for: ref.value)
+            // The default comes from the property schema itself, not its $ref target
+            if let value = ref.value.defaultValue {
+                defaults.append(ObjectLayout.Default(key: key, value: value))
+            }
+        }
+
+        let required = schema.required ?? []
+        var requiredNames: [String] = []
+        for name in required where fields[name]?.requiredBit == nil {
+            fields[name, default: ObjectLayout.Field()].requiredBit = requiredNames.count
+            requiredNames.append(name)
+        }
+
+        let additional: ObjectLayout.Additional
+        switch schema.additionalProperties {
+        case .allowed(false): additional = .deny
+        case .schema(let ref): additional = .schema(node(for: ref.value))
+        case .allowed(true), nil: additional = .allow
+        }
+
+        return ObjectLayout(
+            fields: fields,
+            hasProperties: schema.properties != nil,
+            required: required,
+            requiredNames: requiredNames,
+            additional: additional,
+            defaults: defaults
+        )
+    }
+
+    private mutating func makeComposition(_ schema: Schema) -> Composition? {
+        // Only the first non-empty keyword applies, in this order
+        if let allOf = schema.allOf, !allOf.isEmpty {
+            return .allOf(allOf.map { node(for: $0.value) })
+        }
+        if let anyOf = schema.anyOf, !anyOf.isEmpty {
+            return .anyOf(anyOf.map { node(for: $0.value) }, makeDiscriminator(schema.discriminator))
+        }
+        if let oneOf = schema.oneOf, !oneOf.isEmpty {
+            return .oneOf(oneOf.map { node(for: $0.value) }, makeDiscriminator(schema.discriminator))
+        }
+        if let not = schema.not {
+            return .not(node(for: not.value))
+        }
+        return nil
+    }
+
+    private mutating func makeDiscriminator(_ discriminator: Discriminator?) -> CompiledDiscriminator? {
+        guard let discriminator else { return nil }
+        var mapping: [String: CompiledDiscriminator.Target] = [:]
+        for (value, ref) in discriminator.mapping ?? [:] {
+            if let name = Self.componentName(fromRef: ref), let index = componentNodes[name] {
+                mapping[value] = .node(index)
+            } else {
+                mapping[value] = .unresolved(ref)
+            }
+        }
+        return CompiledDiscriminator(propertyName: discriminator.propertyName, mapping: mapping)
+    }
+
+    /// The component name in `#/components/schemas/<name>`, split the way
+    /// `SchemaBinding.resolveRef` splits it
+    static func componentName(fromRef ref: String) -> String? {
+        let parts = ref.split(separator: "/")
+        guard parts.count == 4,
+              parts[0] == "#",
+              parts[1] == "components",
+              parts[2] == "schemas" else {
+            return nil
+        }
+        return String(parts[3])
+    }
+}
+
+// MARK: - Program
+
+/// Immutable node array produced by `SchemaCompiler`
+final class SchemaProgram: Sendable {
+    let nodes: [SchemaNode]
+    let componentNodes: [String: Int]
+    let nodeNames: [Int: String]
+    /// Descriptions of `$ref` cycles found at compile time
+    let cycles: [String]
+
+    init(nodes: [SchemaNode], componentNodes: [String: Int], nodeNames: [Int: String], cycles: [String]) {
+        self.nodes = nodes
+        self.componentNodes = componentNodes
+        self.nodeNames = nodeNames
+        self.cycles = cycles
+    }
+
+    /// The compiled schema for `root`, as returned by `SchemaCompiler.add`
+    func schema(_ root: Int) -> CompiledSchema {
+        CompiledSchema(program: self, root: root)
+    }
+
+    /// The compiled `components.schemas` entry named `name`
+    func component(named name: String) -> CompiledSchema? {
+        componentNodes[name].map(schema)
+    }
+
+    // MARK: Parse (SchemaBinding.parseValue semantics)
+
+    /// `trail` holds the cycle-flagged nodes that composed the current
+    /// value; it resets whenever a child value is parsed.
+    func parse(_ index: Int, _ json: Any, trail: [Int] = []) throws -> Any {
+        let node = nodes[index]
+
+        if node.isNullable && json is NSNull {
+            return NSNull()
+        }
+
+        let parsed: Any
+        switch node.kind {
+        case .untyped:
+            if let composition = node.composition {
+                return try compose(composition, json, trail: enter(index, node, trail))
+            }
+            return json
+
+        case .string:
+            guard let str = json as? String else {
+                throw SchemaBindingError.typeMismatch(expected: "string")
+            }
+            parsed = str
+
+        case .number:
+            if let intVal = json as? Int {
+                parsed = Double(intVal)
+            } else if let doubleVal = json as? Double {
+                parsed = doubleVal
+            } else {
+                throw SchemaBindingError.typeMismatch(expected: "number")
+            }
+
+        case .boolean:
+            guard let boolVal = json as? Bool else {
+                throw SchemaBindingError.typeMismatch(expected: "boolean")
+            }
+            parsed = boolVal
+
+        case .array(let items):
+            guard let arr = json as? [Any] else {
+                throw SchemaBindingError.typeMismatch(expected: "array")
+            }
+            if let items {
+                parsed = try arr.map { try parse(items, $0) }
+            } else {
+                parsed = arr
+            }
+
+        case .object(let layout):
+            guard let dict = json as? [String: Any] else {
+                throw SchemaBindingError.typeMismatch(expected: "object")
+            }
+            parsed = try parseObject(dict, layout)
+
+        case .passthrough, .alias:
+            parsed = json
+
+        case .invalidReference(let ref):
+            throw SchemaBindingError.invalidReference(ref)
+        }
+
+        try checkConstraints(node, parsed)
+        if let composition = node.composition {
+            return try compose(composition, parsed, trail: enter(index, node, trail))
+        }
+        return parsed
+    }
+
+    private func parseObject(_ dict: [String: Any], _ layout: ObjectLayout) throws -> Any {
+        guard layout.hasProperties else {
+            if let missing = layout.firstMissing(in: dict) {
+                throw SchemaBindingError.missingRequired(missing)
+            }
+            return dict
+        }
+
+        let scan = layout.scan(dict)
+        if let missing = scan.missing {
+            throw SchemaBindingError.missingRequired(missing)
+        }
+
+        var result: [String: Any] = [:]
+        result.reserveCapacity(dict.count + layout.defaults.count)
+        switch layout.additional {
+        case .deny:
+            if !scan.extras.isEmpty {
+                throw SchemaBindingError.additionalPropertiesNotAllowed(scan.extras.sorted())
+            }
+        case .schema(let extraNode):
+            for key in scan.extras {
+                result[key] = try parse(extraNode, dict[key]!)
+            }
+        case .allow:
+            for key in scan.extras { result[key] = dict[key]! }
+        }
+
+        for match in scan.matches {
+            result[match.key] = try parse(match.node, match.value)
+        }
+        for entry in layout.defaults where result[entry.key] == nil {
+            result[entry.key] = entry.value.anyValue
+        }
+        return result
+    }
+
+    // MARK: Validate (SchemaBinding.validateAgainstSchema semantics)
+
+    func validate(_ index: Int, _ value: any Sendable, schemaName: String) throws -> any Sendable {
+        let node = nodes[index]
+
+        if node.isNullable && value is NSNull {
+            return NSNull()
+        }
+
+        let validated: any Sendable
+        switch node.kind {
+        case .untyped:
+            if let composition = node.composition {
+                return SchemaBinding.assumeSendable(try compose(composition, value, trail: enter(index, node, [])))
+            }
+            return value
+
+        case .string:
+            guard let strVal = value as? String else {
+                throw typeMismatch(schemaName, "string", value)
+            }
+            validated = strVal
+
+        case .number(let isInteger):
+            if let intVal = value as? Int {
+                validated = isInteger ? intVal : Double(intVal)
+            } else if let doubleVal = value as? Double {
+                validated = doubleVal
+            } else {
+                throw typeMismatch(schemaName, isInteger ? "integer" : "number", value)
+            }
+
+        case .boolean:
+            guard let boolVal = value as? Bool else {
+                throw typeMismatch(schemaName, "boolean", value)
+            }
+            validated = boolVal
+
+        case .array(let items):
+            guard let arr = value as? [any Sendable] else {
+                throw typeMismatch(schemaName, "array", value)
+            }
+            if let items {
+                validated = try arr.map { try validate(items, $0, schemaName: schemaName) }
+            } else {
+                validated = arr
+            }
+
+        case .object(let layout):
+            guard let dict = value as? [String: any Sendable] else {
+                throw typeMismatch(schemaName, "object", value)
+            }
+            validated = try validateObject(dict, layout, schemaName: schemaName)
+
+        case .passthrough, .alias:
+            validated = value
+
+        case .invalidReference(let ref):
+            throw SchemaValidationError.invalidSchemaReference(schemaName: schemaName, ref: ref)
+        }
+
+        try checkConstraints(node, validated)
+        if let composition = node.composition {
+            return SchemaBinding.assumeSendable(try compose(composition, validated, trail: enter(index, node, [])))
+        }
+        return validated
+    }
+
+    private func validateObject(
+        _ dict: [String: any Sendable],
+        _ layout: ObjectLayout,
+        schemaName: String
+    ) throws -> any Sendable {
+        let missing: String?
+        let scan: ObjectLayout.Scan<any Sendable>?
+        if layout.hasProperties {
+            scan = layout.scan(dict)
+            missing = scan?.missing
+        } else {
+            scan = nil
+            missing = layout.firstMissing(in: dict)
+        }
+        if let missing {
+            throw SchemaValidationError.missingRequiredProperty(
+                schemaName: schemaName,
+                property: missing,
+                requiredProperties: layout.required
+            )
+        }
+        guard let scan else { return dict }
+
+        var result: [String: any Sendable] = [:]
+        result.reserveCapacity(dict.count)
+        switch layout.additional {
+        case .deny:
+            if !scan.extras.isEmpty {
+                throw SchemaBindingError.additionalPropertiesNotAllowed(scan.extras.sorted())
+            }
+        case .schema(let extraNode):
+            for key in scan.extras {
+                result[key] = try validate(extraNode, dict[key]!, schemaName: schemaName)
+            }
+        case .allow:
+            for key in scan.extras { result[key] = dict[key]! }
+        }
+
+        for match in scan.matches {
+            do {
+                result[match.key] = try validate(match.node, match.value, schemaName: schemaName)
+            } catch SchemaValidationError.typeMismatch(_, let expected, let actual) {
+                // Re-throw with property context for a type mismatch at this level
+                throw SchemaValidationError.invalidPropertyType(
+                    schemaName: schemaName,
+                    property: match.key,
+                    expected: expected,
+                    actual: actual
+                )
+            }
+        }
+        return result
+    }
+
+    private func typeMismatch(_ schemaName: String, _ expected: String, _ value: any Sendable) -> SchemaValidationError {
+        .typeMismatch(schemaName: schemaName, expected: expected, actual: SchemaBinding.describeType(of: value))
+    }
+
+    // MARK: Shared
+
+    private func checkConstraints(_ node: SchemaNode, _ value: Any) throws {
+        if let allowed = node.allowed, !allowed.contains(value) {
+            throw SchemaBindingError.enumViolation(value: "\(value)", allowed: allowed.description)
+        }
+        if let constant = node.constant, !constant.contains(value) {
+            throw SchemaBindingError.enumViolation(value: "\(value)", allowed: constant.description)
+        }
+    }
+
+    /// Extend `trail` with a cycle-flagged node about to compose its value.
+    /// Composing again on the same value would recurse forever.
+    private func enter(_ index: Int, _ node: SchemaNode, _ trail: [Int]) throws -> [Int] {
+        guard node.isOnCompositionCycle else { return trail }
+        if trail.contains(index) {
+            let name = nodeNames[index] ?? "#\(index)"
+            throw SchemaBindingError.compositionFailed("circular schema composition through \(name)")
+        }
+        return trail + [index]
+    }
+
+    /// Composition always uses parse semantics, in both modes
+    private func compose(_ composition: Composition, _ json: Any, trail: [Int]) throws -> Any {
+        switch composition {
+        case .allOf(let subs):
+            // Valid against all sub-schemas; object results are merged
+            if var mergedDict = json as? [String: Any] {
+                for sub in subs {
+                    if let subDict = try parse(sub, json, trail: trail) as? [String: Any] {
+                        mergedDict.merge(subDict) { _, new in new }
+                    }
+                }
+                return mergedDict
+            }
+            var merged = json
+            for sub in subs {
+                merged = try parse(sub, merged, trail: trail)
+            }
+            return merged
+
+        case .anyOf(let subs, let discriminator):
+            if let target = try discriminated(discriminator, json) {
+                return try parse(target, json, trail: trail)
+            }
+            for sub in subs {
+                if let result = try? parse(sub, json, trail: trail) {
+                    return result
+                }
+            }
+            throw SchemaBindingError.compositionFailed("anyOf: value does not match any of the listed schemas")
+
+        case .oneOf(let subs, let discriminator):
+            if let target = try discriminated(discriminator, json) {
+                return try parse(target, json, trail: trail)
+            }
+            var results: [Any] = []
+            for sub in subs {
+                if let result = try? parse(sub, json, trail: trail) {
+                    results.append(result)
+                }
+            }
+            if results.count == 1 { return results[0] }
+            if results.isEmpty {
+                throw SchemaBindingError.compositionFailed("oneOf: value does not match any schema")
+            }
+            throw SchemaBindingError.compositionFailed("oneOf: value matches \(results.count) schemas, expected exactly 1")
+
+        case .not(let sub):
+            if (try? parse(sub, json, trail: trail)) != nil {
+                throw SchemaBindingError.compositionFailed("not: value must not match the 'not' schema")
+            }
+            return json
+        }
+    }
+
+    /// The sub-schema selected by the discriminator, or nil when it does not apply
+    private func discriminated(_ discriminator: CompiledDiscriminator?, _ json: Any) throws -> Int? {
+        guard let discriminator,
+              let dict = json as? [String: Any],
+              let value = dict[discriminator.propertyName] as? String else {
+            return nil
+        }
+        if let target = discriminator.mapping[value] {
+            switch target {
+            case .node(let index): return index
+            case .unresolved(let ref): throw SchemaBindingError.invalidReference(ref)
+            }
+        }
+        if !value.isEmpty, !value.contains("/"), let index = componentNodes[value] {
+            return index
+        }
+        // Uncommon spellings still resolve the way resolveRef splits them
+        let ref = "#/components/schemas/\(value)"
+        guard let name = SchemaCompiler.componentName(fromRef: ref), let index = componentNodes[name] else {
+            throw SchemaBindingError.invalidReference(ref)
+        }
+        return index
+    }
+}
+
+// MARK: - Nodes
+
+struct SchemaNode: Sendable {
+    enum Kind: Sendable {
+        case untyped
+        case string
+        case number(isInteger: Bool)
+        case boolean
+        case array(items: Int?)
+        case object(ObjectLayout)
+        /// Unknown `type` keyword: the value passes through unchanged
+        case passthrough
+        /// A component that is itself a `$ref`; removed by `build()`
+        case alias(Int)
+        /// Unresolvable or circular `$ref`; fails when reached
+        case invalidReference(String)
+    }
+
+    var kind: Kind
+    var isNullable = false
+    var allowed: ValueSet?
+    var constant: ValueSet?
+    var composition: Composition?
+    var isOnCompositionCycle = false
+
+    init(kind: Kind) {
+        self.kind = kind
+    }
+
+    /// Nodes reached without consuming input
+    var compositionTargets: [Int] {
+        switch composition {
+        case .allOf(let subs): return subs
+        case .anyOf(let subs, let discriminator), .oneOf(let subs, let discriminator):
+            return subs + (discriminator?.mappedNodes ?? [])
+        case .not(let sub): return [sub]
+        case nil: return []
+        }
+    }
+
+    func remapped(_ map: (Int) -> Int) -> SchemaNode {
+        var node = self
+        switch kind {
+        case .array(let items): node.kind = .array(items: items.map(map))
+        case .object(let layout): node.kind = .object(layout.remapped(map))
+        default: break
+        }
+        switch composition {
+        case .allOf(let subs): node.composition = .allOf(subs.map(map))
+        case .anyOf(let subs, let d): node.composition = .anyOf(subs.map(map), d?.remapped(map))
+        case .oneOf(let subs, let d): node.composition = .oneOf(subs.map(map), d?.remapped(map))
+        case .not(let sub): node.composition = .not(map(sub))
+        case nil: break
+        }
+        return node
+    }
+}
+
+enum Composition: Sendable {
+    case allOf([Int])
+    case anyOf([Int], CompiledDiscriminator?)
+    case oneOf([Int], CompiledDiscriminator?)
+    case not(Int)
+}
+
+struct CompiledDiscriminator: Sendable {
+    enum Target: Sendable {
+        case node(Int)
+        case unresolved(String)
+    }
+
+    let propertyName: String
+    let mapping: [String: Target]
+
+    var mappedNodes: [Int] {
+        mapping.values.compactMap { if case .node(let index) = $0 { return index } else { return nil } }
+    }
+
+    func remapped(_ map: (Int) -> Int) -> CompiledDiscriminator {
+        CompiledDiscriminator(propertyName: propertyName, mapping: mapping.mapValues { target in
+            if case .node(let index) = target { return .node(map(index)) }
+            return target
+        })
+    }
+}
+
+// MARK: - Object Layout
+
+struct ObjectLayout: Sendable {
+    struct Field: Sendable {
+        var property: Int?
+        var requiredBit: Int?
+    }
+
+    struct Default: Sendable {
+        let key: String
+        let value: AnyCodableValue
+    }
+
+    enum Additional: Sendable {
+        case allow
+        case deny
+        case schema(Int)
+    }
+
+    /// One entry per declared property and per required name
+    let fields: [String: Field]
+    let hasProperties: Bool
+    /// `required` as declared, for error messages
+    let required: [String]
+    /// Distinct required names; bit `i` of the scan bitset is `requiredNames[i]`
+    let requiredNames: [String]
+    let additional: Additional
+    let defaults: [Default]
+
+    /// Result of one pass over a payload's keys
+    struct Scan<Value> {
+        var matches: [(key: String, value: Value, node: Int)] = []
+        var extras: [String] = []
+        var missing: String?
+    }
+
+    func scan<Value>(_ dict: [String: Value]) -> Scan<Value> {
+        var scan = Scan<Value>()
+        scan.matches.reserveCapacity(dict.count)
+        let useBits = requiredNames.count <= 64
+        var seen: UInt64 = 0
+        for (key, value) in dict {
+            guard let field = fields[key] else {
+                scan.extras.append(key)
+                continue
+            }
+            if let bit = field.requiredBit, useBits {
+                seen |= 1 << UInt64(bit)
+            }
+            if let property = field.property {
+                scan.matches.append((key, value, property))
+            } else {
+                scan.extras.append(key)
+            }
+        }
+
+        if useBits {
+            let all: UInt64 = requiredNames.count == 64 ? .max : (1 << UInt64(requiredNames.count)) - 1
+            let unseen = all & ~seen
+            if unseen != 0 {
+                scan.missing = requiredNames[unseen.trailingZeroBitCount]
+            }
+        } else {
+            scan.missing = firstMissing(in: dict)
+        }
+        return scan
+    }
+
+    /// First required name (in declaration order) absent from `dict`
+    func firstMissing<Value>(in dict: [String: Value]) -> String? {
+        requiredNames.first { dict[$0] == nil }
+    }
+
+    func remapped(_ map: (Int) -> Int) -> ObjectLayout {
+        let additional: Additional
+        if case .schema(let index) = self.additional {
+            additional = .schema(map(index))
+        } else {
+            additional = self.additional
+        }
+        return ObjectLayout(
+            fields: fields.mapValues { Field(property: $0.property.map(map), requiredBit: $0.requiredBit) },
+            hasProperties: hasProperties,
+            required: required,
+            requiredNames: requiredNames,
+            additional: additional,
+            defaults: defaults
+        )
+    }
+}
+
+// MARK: - Value Sets
+
+/// Hash-set form of an `enum` / `const` list. Membership matches the
+/// tree walker's element-wise comparison: an `.int` member also accepts
+/// the equal Double, a `.double` member only Doubles.
+struct ValueSet: Sendable {
+    private var strings: Set<String> = []
+    private var ints: Set<Int> = []
+    private var doubles: Set<Double> = []
+    private var bools: Set<Bool> = []
+    private var allowsNull = false
+    /// Allowed values as listed in error messages
+    let description: String
+
+    init(_ values: [AnyCodableValue], description: String) {
+        self.description = description
+        for value in values {
+            switch value {
+            case .string(let s): strings.insert(s)
+            case .int(let i):
+                ints.insert(i)
+                doubles.insert(Double(i))
+            case .double(let d): doubles.insert(d)
+            case .bool(let b): bools.insert(b)
+            case .null: allowsNull = true
+            }
+        }
+    }
+
+    func contains(_ value: Any) -> Bool {
+        if let s = value as? String, strings.contains(s) { return true }
+        if let i = value as? Int, ints.contains(i) { return true }
+        if let d = value as? Double, doubles.contains(d) { return true }
+        if let b = value as? Bool, bools.contains(b) { return true }
+        return allowsNull && value is NSNull
+    }
+}
@@ -33,14 +33,29 @@ public protocol SchemaRegistry: Sendable {
 
     /// Get the components for reference resolution
     var components: Components? { get }
+
+    /// Look up the compiled validator for a schema
+    /// - Parameter name: The schema name (e.g., "ExtractLinksEvent")
+    /// - Returns: The compiled schema, or nil when the registry does not compile schemas
+    func compiledSchema(named name: String) -> CompiledSchema?
+}
+
+extension SchemaRegistry {
+    public func compiledSchema(named name: String) -> CompiledSchema? {
+        nil
+    }
 }
 
 /// Concrete implementation backed by an OpenAPI specification
 public struct OpenAPISchemaRegistry: SchemaRegistry {
     private let spec: OpenAPISpec
 
+    /// Every component schema, compiled once when the registry is built
+    private let program: SchemaProgram
+
     public init(spec: OpenAPISpec) {
         self.spec = spec
+        self.program = SchemaCompiler(components: spec.components).build()
     }
 
     public func schema(named name: String) -> Schema? {
@@ -59,4 +74,8 @@ public struct OpenAPISchemaRegistry: SchemaRegistry {
     public var components: Components? {
         spec.components
     }
+
+    public func compiledSchema(named name: String) -> CompiledSchema? {
+        program.component(named: name)
+    }
 }
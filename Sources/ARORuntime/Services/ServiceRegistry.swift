@@ -53,6 +53,11 @@ public protocol AROService: Sendable {
 
     /// Shutdown the service (optional)
     func shutdown() async
+
+    /// Lowercased names of the methods without side effects (optional).
+    /// Parallel execution only overlaps calls to these; any other call
+    /// keeps its place in source order.
+    static var readOnlyMethods: Set<String> { get }
 }
 
 // MARK: - Default Implementation
@@ -60,6 +65,9 @@ public protocol AROService: Sendable {
 public extension AROService {
     /// Default no-op shutdown
     func shutdown() async {}
+
+    /// By default no method is assumed to be free of side effects
+    static var readOnlyMethods: Set<String> { [] }
 }
 
 // MARK: - Service Errors
@@ -189,6 +197,17 @@ public final class ExternalServiceRegistry: @unchecked Sendable {
         return services[name.lowercased()]
     }
 
+    /// Check if a service declares a method free of side effects
+    /// - Parameters:
+    ///   - name: The service name
+    ///   - method: The method name
+    /// - Returns: true if the service is registered and lists the method
+    ///   in its `readOnlyMethods`
+    public func isReadOnly(_ name: String, method: String) -> Bool {
+        guard let service = service(named: name) else { return false }
+        return type(of: service).readOnlyMethods.contains(method.lowercased())
+    }
+
     // MARK: - Service Invocation
 
     /// Call a method on a service
@@ -240,6 +259,7 @@ public final class ExternalServiceRegistry: @unchecked Sendable {
 /// Built-in HTTP client service using URLSession
 public struct BuiltInHTTPService: AROService {
     public static let name = "http"
+    public static let readOnlyMethods: Set<String> = ["get"]
 
     private let session: URLSession
 
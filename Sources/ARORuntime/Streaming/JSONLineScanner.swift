@@ -0,0 +1,542 @@
+// JSONLineScanner.swift
+// ARO Streaming Execution Engine
+//
+// Byte-level JSONL reader used by `JSONStreamParser`.
+//
+// The file is read straight into one reusable buffer. `memchr` (which
+// libc vectorizes) finds the newlines, and each complete line is parsed
+// in place from the buffer: no per-byte loop, no line copy, and no
+// `JSONSerialization` / `NSNumber` round trip. `JSONByteParser` builds
+// the runtime's value types directly, with the same mapping
+// `SendableConverter.fromJSON` applies to Foundation objects (integers
+// as Int, other numbers as Double, null as "null").
+//
+// With `parallelism > 1` the lines of each filled buffer are split into
+// contiguous blocks parsed concurrently, then emitted in file order.
+
+import Foundation
+import Dispatch
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+enum JSONLineScanner {
+
+    /// Bytes read per refill, per parsing thread
+    static let chunkSize = 1 << 20
+
+    /// Outcome of one line
+    enum LineResult {
+        case row([String: any Sendable])
+        case skipped
+        case malformed(String)
+        case tooLong
+    }
+
+    /// Read `path` and call `emit` with each row, in file order.
+    /// Throws for I/O errors, and for malformed or overlong lines unless
+    /// `config.skipMalformed` is set.
+    static func scan(
+        path: String,
+        config: JSONStreamParser.Config,
+        emit: ([String: any Sendable]) -> Void
+    ) throws {
+        let handle = try FileHandle(forReadingFrom: URL(fileURLWithPath: path))
+        defer { try? handle.close() }
+        let fd = handle.fileDescriptor
+
+        let parallelism = max(1, config.parallelism)
+        var capacity = chunkSize * parallelism
+        var buffer = UnsafeMutableRawPointer.allocate(byteCount: capacity, alignment: 16)
+        defer { buffer.deallocate() }
+
+        var filled = 0
+        var lineNumber = 0
+        /// Inside an overlong line that is being skipped
+        var discarding = false
+
+        func apply(_ result: LineResult) throws {
+            lineNumber += 1
+            switch result {
+            case .row(let row):
+                emit(row)
+            case .skipped:
+                break
+            case .malformed(let detail):
+                if !config.skipMalformed {
+                    throw JSONStreamError.malformedJSON("line \(lineNumber): \(detail)")
+                }
+            case .tooLong:
+                if !config.skipMalformed {
+                    throw JSONStreamError.lineTooLong(config.maxLineLength)
+                }
+            }
+        }
+
+        while true {
+            let count = read(fd, buffer + filled, capacity - filled)
+            if count < 0 {
+                if errno == EINTR { continue }
+                throw POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+            }
+            let atEnd = count == 0
+            filled += count
+
+            var start = 0
+            if discarding {
+                guard let newline = memchr(buffer, 0x0A, filled) else {
+                    filled = 0
+                    if atEnd { break }
+                    continue
+                }
+                start = buffer.distance(to: newline) + 1
+                discarding = false
+                try apply(.tooLong)
+            }
+
+            // Complete lines in this buffer (the last one too at EOF)
+            var lines: [Range<Int>] = []
+            while start < filled, let newline = memchr(buffer + start, 0x0A, filled - start) {
+                let end = buffer.distance(to: newline)
+                lines.append(start..<end)
+                start = end + 1
+            }
+            if atEnd && start < filled {
+                lines.append(start..<filled)
+                start = filled
+            }
+
+            for result in parse(lines, in: UnsafeRawPointer(buffer), config: config, parallelism: parallelism) {
+                try apply(result)
+            }
+
+            // Keep the partial line at the front of the buffer
+            let remaining = filled - start
+            if remaining > 0 && start > 0 {
+                memmove(buffer, buffer + start, remaining)
+            }
+            filled = remaining
+            if atEnd { break }
+
+            if filled == capacity {
+                if filled > config.maxLineLength {
+                    // Drop what we have and skip to the next newline
+                    filled = 0
+                    discarding = true
+                    if !config.skipMalformed {
+                        throw JSONStreamError.lineTooLong(config.maxLineLength)
+                    }
+                } else {
+                    let grown = min(capacity * 2, config.maxLineLength + 1)
+                    let larger = UnsafeMutableRawPointer.allocate(byteCount: grown, alignment: 16)
+                    larger.copyMemory(from: buffer, byteCount: filled)
+                    buffer.deallocate()
+                    buffer = larger
+                    capacity = grown
+                }
+            }
+        }
+    }
+
+    /// Parse `lines` of `base`, on this thread or in contiguous blocks
+    /// across threads. Results are in line order either way.
+    static func parse(
+        _ lines: [Range<Int>],
+        in base: UnsafeRawPointer,
+        config: JSONStreamParser.Config,
+        parallelism: Int
+    ) -> [LineResult] {
+        let blocks = parallelism > 1 && lines.count >= 2 * minimumBlock
+            ? min(parallelism, lines.count / minimumBlock)
+            : 1
+        guard blocks > 1 else {
+            return lines.map { parseLine(base, $0, config: config) }
+        }
+
+        let results = UnsafeMutableBufferPointer<LineResult>.allocate(capacity: lines.count)
+        defer {
+            results.baseAddress!.deinitialize(count: lines.count)
+            results.deallocate()
+        }
+        DispatchQueue.concurrentPerform(iterations: blocks) { block in
+            let range = (block * lines.count / blocks)..<((block + 1) * lines.count / blocks)
+            for index in range {
+                (results.baseAddress! + index).initialize(to: parseLine(base, lines[index], config: config))
+            }
+        }
+        return Array(results)
+    }
+
+    /// Lines per parallel block; fewer are not worth a dispatch
+    private static let minimumBlock = 256
+
+    /// Parse one line in place. Blank lines and `#` / `//` comments are
+    /// skipped; a trailing `\r` is ignored.
+    static func parseLine(
+        _ base: UnsafeRawPointer,
+        _ range: Range<Int>,
+        config: JSONStreamParser.Config
+    ) -> LineResult {
+        guard range.count <= config.maxLineLength else { return .tooLong }
+        let bytes = base.assumingMemoryBound(to: UInt8.self)
+
+        var first = range.lowerBound
+        var end = range.upperBound
+        while first < end, bytes[first] == 0x20 || bytes[first] == 0x09 {
+            first += 1
+        }
+        while end > first, bytes[end - 1] == 0x0D || bytes[end - 1] == 0x20 || bytes[end - 1] == 0x09 {
+            end -= 1
+        }
+        if first == end || bytes[first] == UInt8(ascii: "#")
+            || (bytes[first] == UInt8(ascii: "/") && first + 1 < end && bytes[first + 1] == UInt8(ascii: "/")) {
+            return .skipped
+        }
+
+        var parser = JSONByteParser(bytes + first, count: end - first)
+        do {
+            return .row(try parser.parseObjectLine())
+        } catch let error as JSONByteParser.SyntaxError {
+            return .malformed("\(error.message) at column \(error.offset + 1)")
+        } catch {
+            return .malformed("\(error)")
+        }
+    }
+}
+
+// MARK: - JSONByteParser
+
+/// Recursive-descent JSON parser over raw UTF-8 bytes that produces the
+/// runtime's value types.
+struct JSONByteParser {
+    struct SyntaxError: Error {
+        let message: String
+        /// Byte offset in the parsed text
+        let offset: Int
+    }
+
+    /// Deeper nesting is rejected rather than risking the stack
+    private static let maxDepth = 512
+
+    private let bytes: UnsafePointer<UInt8>
+    private let count: Int
+    private var position = 0
+    private var depth = 0
+
+    init(_ bytes: UnsafePointer<UInt8>, count: Int) {
+        self.bytes = bytes
+        self.count = count
+    }
+
+    /// A whole line holding exactly one object
+    mutating func parseObjectLine() throws -> [String: any Sendable] {
+        skipWhitespace()
+        guard position < count, bytes[position] == UInt8(ascii: "{") else {
+            throw fail("expected an object")
+        }
+        let object = try parseObject()
+        skipWhitespace()
+        guard position == count else {
+            throw fail("unexpected data after the object")
+        }
+        return object
+    }
+
+    // MARK: Values
+
+    private mutating func parseValue() throws -> any Sendable {
+        skipWhitespace()
+        guard position < count else {
+            throw fail("unexpected end of input")
+        }
+        switch bytes[position] {
+        case UInt8(ascii: "{"):
+            return try parseObject()
+        case UInt8(ascii: "["):
+            return try parseArray()
+        case UInt8(ascii: "\""):
+            return try parseString()
+        case UInt8(ascii: "t"):
+            try expectLiteral("true")
+            return true
+        case UInt8(ascii: "f"):
+            try expectLiteral("false")
+            return false
+        case UInt8(ascii: "n"):
+            try expectLiteral("null")
+            return "null"   // as SendableConverter maps NSNull
+        case UInt8(ascii: "-"), UInt8(ascii: "0")...UInt8(ascii: "9"):
+            return try parseNumber()
+        default:
+            throw fail("unexpected character")
+        }
+    }
+
+    private mutating func parseObject() throws -> [String: any Sendable] {
+        try enter()
+        defer { depth -= 1 }
+        position += 1   // {
+
+        var object: [String: any Sendable] = [:]
+        skipWhitespace()
+        if position < count, bytes[position] == UInt8(ascii: "}") {
+            position += 1
+            return object
+        }
+        while true {
+            skipWhitespace()
+            guard position < count, bytes[position] == UInt8(ascii: "\"") else {
+                throw fail("expected a string key")
+            }
+            let key = try parseString()
+            skipWhitespace()
+            guard position < count, bytes[position] == UInt8(ascii: ":") else {
+                throw fail("expected ':'")
+            }
+            position += 1
+            object[key] = try parseValue()
+
+            skipWhitespace()
+            guard position < count else {
+                throw fail("unterminated object")
+            }
+            if bytes[position] == UInt8(ascii: ",") {
+                position += 1
+            } else if bytes[position] == UInt8(ascii: "}") {
+                position += 1
+                return object
+            } else {
+                throw fail("expected ',' or '}'")
+            }
+        }
+    }
+
+    private mutating func parseArray() throws -> [any Sendable] {
+        try enter()
+        defer { depth -= 1 }
+        position += 1   // [
+
+        var array: [any Sendable] = []
+        skipWhitespace()
+        if position < count, bytes[position] == UInt8(ascii: "]") {
+            position += 1
+            return array
+        }
+        while true {
+            array.append(try parseValue())
+            skipWhitespace()
+            guard position < count else {
+                throw fail("unterminated array")
+            }
+            if bytes[position] == UInt8(ascii: ",") {
+                position += 1
+            } else if bytes[position] == UInt8(ascii: "]") {
+                position += 1
+                return array
+            } else {
+                throw fail("expected ',' or ']'")
+            }
+        }
+    }
+
+    // MARK: Strings
+
+    private mutating func parseString() throws -> String {
+        position += 1   // opening quote
+        let start = position
+        while position < count {
+            let byte = bytes[position]
+            if byte == UInt8(ascii: "\"") {
+                let string = String(decoding: UnsafeBufferPointer(start: bytes + start, count: position - start), as: UTF8.self)
+                position += 1
+                return string
+            }
+            if byte == UInt8(ascii: "\\") {
+                return try parseEscapedString(from: start)
+            }
+            if byte < 0x20 {
+                throw fail("control character in string")
+            }
+            position += 1
+        }
+        throw fail("unterminated string", at: start - 1)
+    }
+
+    /// Slow path once a backslash is seen: the bytes so far are copied
+    /// and the rest is decoded escape by escape.
+    private mutating func parseEscapedString(from start: Int) throws -> String {
+        var utf8 = Array(UnsafeBufferPointer(start: bytes + start, count: position - start))
+        while position < count {
+            let byte = bytes[position]
+            position += 1
+            switch byte {
+            case UInt8(ascii: "\""):
+                return String(decoding: utf8, as: UTF8.self)
+            case UInt8(ascii: "\\"):
+                guard position < count else { break }
+                let escape = bytes[position]
+                position += 1
+                switch escape {
+                case UInt8(ascii: "\""), UInt8(ascii: "\\"), UInt8(ascii: "/"):
+                    utf8.append(escape)
+                case UInt8(ascii: "b"): utf8.append(0x08)
+                case UInt8(ascii: "f"): utf8.append(0x0C)
+                case UInt8(ascii: "n"): utf8.append(0x0A)
+                case UInt8(ascii: "r"): utf8.append(0x0D)
+                case UInt8(ascii: "t"): utf8.append(0x09)
+                case UInt8(ascii: "u"):
+                    utf8.append(contentsOf: String(try parseUnicodeEscape()).utf8)
+                default:
+                    throw fail("invalid escape", at: position - 2)
+                }
+            case 0..<0x20:
+                throw fail("control character in string", at: position - 1)
+            default:
+                utf8.append(byte)
+            }
+        }
+        throw fail("unterminated string", at: start - 1)
+    }
+
+    /// `\uXXXX`, combining a surrogate pair; a lone surrogate becomes U+FFFD
+    private mutating func parseUnicodeEscape() throws -> Character {
+        let high = try parseHex4()
+        if (0xD800..<0xDC00).contains(high),
+           position + 1 < count,
+           bytes[position] == UInt8(ascii: "\\"),
+           bytes[position + 1] == UInt8(ascii: "u") {
+            let saved = position
+            position += 2
+            let low = try parseHex4()
+            if (0xDC00..<0xE000).contains(low) {
+                let scalar = 0x10000 + ((high - 0xD800) << 10) + (low - 0xDC00)
+                return Character(Unicode.Scalar(scalar) ?? "\u{FFFD}")
+            }
+            position = saved
+        }
+        return Character(Unicode.Scalar(high) ?? "\u{FFFD}")
+    }
+
+    private mutating func parseHex4() throws -> UInt32 {
+        guard position + 4 <= count else {
+            throw fail("truncated \\u escape")
+        }
+        var value: UInt32 = 0
+        for _ in 0..<4 {
+            let byte = bytes[position]
+            let digit: UInt8
+            switch byte {
+            case UInt8(ascii: "0")...UInt8(ascii: "9"): digit = byte - UInt8(ascii: "0")
+            case UInt8(ascii: "a")...UInt8(ascii: "f"): digit = byte - UInt8(ascii: "a") + 10
+            case UInt8(ascii: "A")...UInt8(ascii: "F"): digit = byte - UInt8(ascii: "A") + 10
+            default: throw fail("invalid \\u escape")
+            }
+            value = value << 4 | UInt32(digit)
+            position += 1
+        }
+        return value
+    }
+
+    // MARK: Numbers
+
+    /// Integers that fit become Int; fractions, exponents and larger
+    /// integers become Double.
+    private mutating func parseNumber() throws -> any Sendable {
+        let start = position
+        var negative = false
+        if bytes[position] == UInt8(ascii: "-") {
+            negative = true
+            position += 1
+        }
+        guard position < count, isDigit(bytes[position]) else {
+            throw fail("invalid number", at: start)
+        }
+
+        var integer = 0
+        var overflow = false
+        if bytes[position] == UInt8(ascii: "0") {
+            position += 1
+            if position < count, isDigit(bytes[position]) {
+                throw fail("leading zero in number", at: start)
+            }
+        } else {
+            while position < count, isDigit(bytes[position]) {
+                let digit = Int(bytes[position] - UInt8(ascii: "0"))
+                let (shifted, o1) = integer.multipliedReportingOverflow(by: 10)
+                let (next, o2) = negative
+                    ? shifted.subtractingReportingOverflow(digit)
+                    : shifted.addingReportingOverflow(digit)
+                overflow = overflow || o1 || o2
+                integer = next
+                position += 1
+            }
+        }
+
+        var isInteger = true
+        if position < count, bytes[position] == UInt8(ascii: ".") {
+            isInteger = false
+            position += 1
+            guard position < count, isDigit(bytes[position]) else {
+                throw fail("expected digits after '.'")
+            }
+            while position < count, isDigit(bytes[position]) { position += 1 }
+        }
+        if position < count, bytes[position] == UInt8(ascii: "e") || bytes[position] == UInt8(ascii: "E") {
+            isInteger = false
+            position += 1
+            if position < count, bytes[position] == UInt8(ascii: "+") || bytes[position] == UInt8(ascii: "-") {
+                position += 1
+            }
+            guard position < count, isDigit(bytes[position]) else {
+                throw fail("expected exponent digits")
+            }
+            while position < count, isDigit(bytes[position]) { position += 1 }
+        }
+
+        if isInteger && !overflow {
+            return integer
+        }
+        let text = String(decoding: UnsafeBufferPointer(start: bytes + start, count: position - start), as: UTF8.self)
+        guard let double = Double(text) else {
+            throw fail("invalid number", at: start)
+        }
+        return double
+    }
+
+    // MARK: Helpers
+
+    private func isDigit(_ byte: UInt8) -> Bool {
+        byte >= UInt8(ascii: "0") && byte <= UInt8(ascii: "9")
+    }
+
+    private mutating func skipWhitespace() {
+        while position < count {
+            switch bytes[position] {
+            case 0x20, 0x09, 0x0A, 0x0D: position += 1
+            default: return
+            }
+        }
+    }
+
+    private mutating func expectLiteral(_ literal: StaticString) throws {
+        let length = literal.utf8CodeUnitCount
+        guard position + length <= count,
+              memcmp(bytes + position, literal.utf8Start, length) == 0 else {
+            throw fail("invalid literal")
+        }
+        position += length
+    }
+
+    private mutating func enter() throws {
+        depth += 1
+        if depth > Self.maxDepth {
+            throw fail("nesting too deep")
+        }
+    }
+
+    private func fail(_ message: String, at offset: Int? = nil) -> SyntaxError {
+        SyntaxError(message: message, offset: offset ?? position)
+    }
+}
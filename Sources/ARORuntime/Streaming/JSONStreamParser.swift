@@ -27,14 +27,19 @@ public struct JSONStreamParser: Sendable {
         /// Maximum line length for JSONL mode (prevents memory exhaustion)
         public let maxLineLength: Int
 
+        /// Threads parsing JSONL lines; rows are still yielded in file order
+        public let parallelism: Int
+
         public init(
             jsonlMode: Bool = false,
             skipMalformed: Bool = true,
-            maxLineLength: Int = 10_000_000  // 10MB max line
+            maxLineLength: Int = 10_000_000,  // 10MB max line
+            parallelism: Int = 1
         ) {
             self.jsonlMode = jsonlMode
             self.skipMalformed = skipMalformed
             self.maxLineLength = maxLineLength
+            self.parallelism = max(1, parallelism)
         }
 
         /// Default config for JSONL files
@@ -78,7 +83,7 @@ public struct JSONStreamParser: Sendable {
         }
     }
 
-    /// Streams JSONL file line by line
+    /// Streams JSONL file line by line (see `JSONLineScanner`)
     private static func streamJSONL(
         path: String,
         config: Config
@@ -87,47 +92,9 @@ public struct JSONStreamParser: Sendable {
             AsyncThrowingStream { continuation in
                 Task {
                     do {
-                        let url = URL(fileURLWithPath: path)
-                        let handle = try FileHandle(forReadingFrom: url)
-                        defer { try? handle.close() }
-
-                        var lineBuffer = Data()
-                        let chunkSize = 65536
-
-                        while let chunk = try handle.read(upToCount: chunkSize), !chunk.isEmpty {
-                            // Process chunk byte by byte looking for newlines
-                            for byte in chunk {
-                                if byte == UInt8(ascii: "\n") {
-                                    // End of line - parse it
-                                    if !lineBuffer.isEmpty {
-                                        if let dict = parseJSONLine(lineBuffer, config: config) {
-                                            continuation.yield(dict)
-                                        }
-                                        lineBuffer.removeAll(keepingCapacity: true)
-                                    }
-                                } else {
-                                    lineBuffer.append(byte)
-
-                                    // Check max line length
-                                    if lineBuffer.count > config.maxLineLength {
-                                        if !config.skipMalformed {
-                                            continuation.finish(throwing: JSONStreamError.lineTooLong(config.maxLineLength))
-                                            return
-                                        }
-                                        // Skip this line
-                                        lineBuffer.removeAll(keepingCapacity: true)
-                                    }
-                                }
-                            }
-                        }
-
-                        // Handle final line without trailing newline
-                        if !lineBuffer.isEmpty {
-                            if let dict = parseJSONLine(lineBuffer, config: config) {
-                                continuation.yield(dict)
-                            }
+                        try JSONLineScanner.scan(path: path, config: config) { row in
+                            continuation.yield(row)
                         }
-
                         continuation.finish()
                     } catch {
                         continuation.finish(throwing: error)
@@ -137,32 +104,6 @@ public struct JSONStreamParser: Sendable {
         }
     }
 
-    /// Parses a single JSONL line
-    private static func parseJSONLine(
-        _ data: Data,
-        config: Config
-    ) -> [String: any Sendable]? {
-        // Skip empty lines and comments
-        guard let str = String(data: data, encoding: .utf8)?.trimmingCharacters(in: .whitespaces),
-              !str.isEmpty,
-              !str.hasPrefix("#"),
-              !str.hasPrefix("//") else {
-            return nil
-        }
-
-        do {
-            if let json = try JSONSerialization.jsonObject(with: data) as? [String: Any] {
-                return convertToSendable(json)
-            }
-            return nil
-        } catch {
-            if config.skipMalformed {
-                return nil
-            }
-            return nil  // In streaming context, we can't throw here
-        }
-    }
-
     /// Streams JSON array file, yielding each element
     private static func streamJSONArray(
         path: String,
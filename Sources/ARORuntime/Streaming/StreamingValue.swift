@@ -161,6 +161,21 @@ public struct AnyStreamingValue: Sendable {
             value.asStream().map { $0 as any Sendable }
         }
     }
+
+    /// The elements of `value` if it is a stream that has not been
+    /// materialized: a lazy variable or a bare row stream
+    public static func lazyStream(from value: (any Sendable)?) -> AROStream<any Sendable>? {
+        switch value {
+        case let streaming as AnyStreamingValue where !streaming.isMaterialized:
+            return streaming.asStream()
+        case let stream as AROStream<any Sendable>:
+            return stream
+        case let stream as AROStream<[String: any Sendable]>:
+            return stream.map { $0 as any Sendable }
+        default:
+            return nil
+        }
+    }
 }
 
 // MARK: - Convenience Extensions
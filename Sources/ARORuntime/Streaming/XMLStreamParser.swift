@@ -0,0 +1,88 @@
+// XMLStreamParser.swift
+// ARO Streaming Execution Engine
+//
+// Streams the repeated elements of an XML file as records.
+
+import Foundation
+
+/// Streams repeated XML elements (`<row>`, `<entry>`, ...) one at a time.
+///
+/// The file is memory-mapped and tokenized in one pass by
+/// `XMLTokenizer`. Only the element being yielded is built, so memory
+/// stays proportional to one record however long the file is.
+///
+/// Each record is a map in the `FormatDeserializer` shape (child
+/// elements by name, attributes as "@name", text as "#text"):
+///
+/// ```swift
+/// // <users><user id="1"><name>Ann</name></user>...</users>
+/// for try await user in XMLStreamParser.stream(path: "users.xml").stream {
+///     print(user["@id"], user["name"])
+/// }
+/// ```
+public enum XMLStreamParser {
+
+    /// Parser configuration
+    public struct Config: Sendable {
+        /// Local name of the elements to yield, at whatever depth they
+        /// appear (nested matches belong to the outer record). When nil,
+        /// each child of the root element is yielded.
+        public let recordElement: String?
+
+        public init(recordElement: String? = nil) {
+            self.recordElement = recordElement
+        }
+    }
+
+    /// Creates a stream of records from an XML file. Malformed XML
+    /// ends the stream with an `XMLSyntaxError`.
+    public static func stream(
+        path: String,
+        config: Config = Config()
+    ) -> AROStream<[String: any Sendable]> {
+        AROStream {
+            AsyncThrowingStream { continuation in
+                Task {
+                    do {
+                        let data = try Data(contentsOf: URL(fileURLWithPath: path), options: .alwaysMapped)
+                        try data.withUnsafeBytes { raw in
+                            try scan(raw.bindMemory(to: UInt8.self), config: config) { record in
+                                continuation.yield(record)
+                            }
+                        }
+                        continuation.finish()
+                    } catch {
+                        continuation.finish(throwing: error)
+                    }
+                }
+            }
+        }
+    }
+
+    /// Tokenize `bytes` and call `emit` with each selected record
+    static func scan(
+        _ bytes: UnsafeBufferPointer<UInt8>,
+        config: Config,
+        emit: ([String: any Sendable]) -> Void
+    ) throws {
+        var tokenizer = XMLTokenizer(bytes)
+        var builder = XMLTreeBuilder(selection: config.recordElement.map { .name($0) } ?? .depth(1))
+        while let event = try tokenizer.next() {
+            if let record = builder.handle(event) as? [String: any Sendable] {
+                emit(record)
+            }
+        }
+    }
+}
+
+// MARK: - AROStream Extension
+
+extension AROStream where Element == [String: any Sendable] {
+    /// Creates a stream of repeated elements from an XML file
+    public static func fromXML(
+        path: String,
+        recordElement: String? = nil
+    ) -> AROStream<[String: any Sendable]> {
+        XMLStreamParser.stream(path: path, config: .init(recordElement: recordElement))
+    }
+}
@@ -126,7 +126,7 @@ public struct ANSIRenderer: Sendable {
         }
     }
 
-    /// Reset styling (outputs the complete sequence, used by ShadowBuffer)
+    /// Reset styling (outputs the complete sequence)
     public static func resetStyles() {
         print("\(CSI)0m", terminator: "")
     }
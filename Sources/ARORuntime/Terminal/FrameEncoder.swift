@@ -0,0 +1,142 @@
+//
+//  FrameEncoder.swift
+//  ARORuntime
+//
+//  Byte-level frame encoding for the terminal shadow buffer
+//  Part of ARO-0053: Terminal Shadow Buffer Optimization
+//
+
+import Foundation
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// Encodes one terminal frame (cursor moves, SGR changes, glyphs) into a
+/// single reusable byte buffer.
+///
+/// ShadowBuffer appends everything a frame needs here and hands the bytes
+/// to the output sink in one call, instead of issuing a `print` per cell.
+/// The backing storage keeps its capacity between frames, so steady-state
+/// rendering does not allocate.
+public struct FrameEncoder: Sendable {
+    /// Encoded bytes for the current frame
+    public private(set) var bytes: [UInt8]
+
+    /// Creates an encoder with room for `capacity` bytes
+    public init(capacity: Int = 4096) {
+        self.bytes = []
+        self.bytes.reserveCapacity(capacity)
+    }
+
+    /// Whether nothing has been encoded since the last reset
+    public var isEmpty: Bool {
+        bytes.isEmpty
+    }
+
+    /// Discards the encoded frame, keeping the allocated capacity
+    public mutating func reset() {
+        bytes.removeAll(keepingCapacity: true)
+    }
+
+    // MARK: - Primitives
+
+    @inline(__always)
+    public mutating func append(byte: UInt8) {
+        bytes.append(byte)
+    }
+
+    /// Appends the UTF-8 encoding of a glyph (ASCII fast path)
+    @inline(__always)
+    public mutating func append(character: Character) {
+        if let ascii = character.asciiValue {
+            bytes.append(ascii)
+        } else {
+            bytes.append(contentsOf: character.utf8)
+        }
+    }
+
+    /// Appends a static escape sequence
+    public mutating func append(_ sequence: StaticString) {
+        sequence.withUTF8Buffer { bytes.append(contentsOf: $0) }
+    }
+
+    /// Appends a non-negative integer in decimal without going through String
+    public mutating func append(decimal value: Int) {
+        guard value > 0 else {
+            bytes.append(UInt8(ascii: "0"))
+            return
+        }
+        var divisor = 1
+        while divisor <= value / 10 { divisor *= 10 }
+        var remaining = value
+        while divisor > 0 {
+            bytes.append(UInt8(ascii: "0") &+ UInt8(remaining / divisor))
+            remaining %= divisor
+            divisor /= 10
+        }
+    }
+
+    // MARK: - Control Sequences
+
+    /// CSI row;col H (1-indexed)
+    public mutating func appendMoveCursor(row: Int, column: Int) {
+        append("\u{1B}[")
+        append(decimal: row)
+        append(byte: UInt8(ascii: ";"))
+        append(decimal: column)
+        append(byte: UInt8(ascii: "H"))
+    }
+
+    /// CSI n C - cheaper than an absolute move when skipping a few cells on the same row
+    public mutating func appendCursorForward(_ count: Int) {
+        append("\u{1B}[")
+        if count != 1 { append(decimal: count) }
+        append(byte: UInt8(ascii: "C"))
+    }
+
+    /// CSI 0 m
+    public mutating func appendResetStyles() {
+        append("\u{1B}[0m")
+    }
+
+    /// Begin synchronized update (DEC private mode 2026). Terminals without
+    /// support ignore unknown private modes, so this is safe to emit blindly.
+    public mutating func appendBeginSynchronizedUpdate() {
+        append("\u{1B}[?2026h")
+    }
+
+    /// End synchronized update (DEC private mode 2026)
+    public mutating func appendEndSynchronizedUpdate() {
+        append("\u{1B}[?2026l")
+    }
+
+    // MARK: - Output
+
+    /// Writes a raw buffer fully to `fd` with a single `write(2)` in the
+    /// common case, retrying only on partial writes and EINTR.
+    public static func writeAll(_ raw: UnsafeRawBufferPointer, to fd: Int32) {
+        guard let base = raw.baseAddress, raw.count > 0 else { return }
+        #if canImport(Darwin) || canImport(Glibc)
+        var cursor = base
+        var remaining = raw.count
+        while remaining > 0 {
+            #if canImport(Darwin)
+            let written = Darwin.write(fd, cursor, remaining)
+            #else
+            let written = Glibc.write(fd, cursor, remaining)
+            #endif
+            if written < 0 {
+                if errno == EINTR { continue }
+                return
+            }
+            remaining -= written
+            cursor = cursor.advanced(by: written)
+        }
+        #else
+        FileHandle(fileDescriptor: fd, closeOnDealloc: false).write(Data(raw))
+        #endif
+    }
+}
@@ -2,7 +2,7 @@
 //  ShadowBuffer.swift
 //  ARORuntime
 //
-//  Terminal UI double buffering with dirty region tracking
+//  Terminal UI double buffering with per-row dirty span tracking
 //  Part of ARO-0053: Terminal Shadow Buffer Optimization
 //
 
@@ -18,16 +18,27 @@ import Glibc
 /// Maintains current and previous screen state to minimize terminal I/O
 /// NOTE: Not Sendable - must only be used within TerminalService actor's isolation
 public final class ShadowBuffer {
+    // MARK: - Types
+
+    /// Receives each encoded frame. The default sink flushes stdio and
+    /// issues one `write(2)` to stdout; tests inject their own.
+    public typealias FrameSink = (UnsafeRawBufferPointer) -> Void
+
     // MARK: - Properties
 
-    /// Current screen buffer
-    private var buffer: [[ScreenCell]]
+    /// Current screen cells, row-major (`row * cols + col`)
+    private var cells: [ScreenCell]
+
+    /// Previously rendered cells (for diffing), same layout as `cells`
+    private var previousCells: [ScreenCell]
 
-    /// Previous screen buffer (for diffing)
-    private var previousBuffer: [[ScreenCell]]
+    /// Per-row dirty span (inclusive). A row is clean when start > end.
+    private var dirtyStart: [Int]
+    private var dirtyEnd: [Int]
 
-    /// Regions that need rendering
-    private var dirtyRegions: Set<DirtyRegion>
+    /// Bounds of the rows that have a dirty span (clean when minDirtyRow > maxDirtyRow)
+    private var minDirtyRow: Int
+    private var maxDirtyRow: Int
 
     /// Terminal dimensions
     private let rows: Int
@@ -36,31 +47,43 @@ public final class ShadowBuffer {
     /// Terminal state tracking (avoids redundant ANSI codes)
     private var terminalState: TerminalState
 
-    /// Batch rendering settings
-    private let maxBatchSize = 64
-    private var pendingUpdates: [(row: Int, col: Int, cell: ScreenCell)]
+    /// Reusable frame buffer - one write per render
+    private var frame: FrameEncoder
+
+    /// Destination for encoded frames
+    private let sink: FrameSink
+
+    /// Wrap each frame in synchronized-update markers (DEC mode 2026) so
+    /// supporting terminals present it atomically instead of mid-draw
+    public var synchronizedOutput: Bool
 
     // MARK: - Initialization
 
     /// Creates a shadow buffer with specified dimensions
-    public init(rows: Int, cols: Int) {
-        self.rows = rows
-        self.cols = cols
+    public init(
+        rows: Int, cols: Int,
+        synchronizedOutput: Bool = true,
+        sink: FrameSink? = nil
+    ) {
+        self.rows = max(0, rows)
+        self.cols = max(0, cols)
 
         // Initialize buffers with empty cells
-        let emptyCell = ScreenCell()
-        self.buffer = Array(
-            repeating: Array(repeating: emptyCell, count: cols),
-            count: rows
-        )
-        self.previousBuffer = self.buffer
+        let cellCount = self.rows * self.cols
+        self.cells = Array(repeating: ScreenCell(), count: cellCount)
+        self.previousCells = self.cells
+
+        self.dirtyStart = Array(repeating: self.cols, count: self.rows)
+        self.dirtyEnd = Array(repeating: -1, count: self.rows)
+        self.minDirtyRow = self.rows
+        self.maxDirtyRow = -1
 
-        self.dirtyRegions = []
         self.terminalState = TerminalState()
-        self.pendingUpdates = []
+        self.synchronizedOutput = synchronizedOutput
+        self.sink = sink ?? ShadowBuffer.writeToStdout
 
-        // Pre-allocate capacity for common batch sizes
-        pendingUpdates.reserveCapacity(maxBatchSize)
+        // Roughly one byte per cell plus escape overhead covers a typical full redraw
+        self.frame = FrameEncoder(capacity: max(4096, cellCount * 2))
     }
 
     /// Convenience initializer with current terminal size
@@ -95,9 +118,10 @@ public final class ShadowBuffer {
         )
 
         // Only update if changed (key optimization)
-        if buffer[row][col] != newCell {
-            buffer[row][col] = newCell
-            addDirtyRegion(row: row, col: col)
+        let index = row * cols + col
+        if cells[index] != newCell {
+            cells[index] = newCell
+            markDirty(row: row, from: col, to: col)
         }
     }
 
@@ -114,9 +138,10 @@ public final class ShadowBuffer {
     ) {
         guard row >= 0 && row < rows else { return }
 
+        let base = row * cols
         var currentCol = col
-        var hasChanges = false
-        let startCol = max(0, col)
+        var firstChanged = cols
+        var lastChanged = -1
 
         for char in text {
             guard currentCol < cols else { break }
@@ -131,20 +156,17 @@ public final class ShadowBuffer {
                     strikethrough: strikethrough
                 )
 
-                if buffer[row][currentCol] != newCell {
-                    buffer[row][currentCol] = newCell
-                    hasChanges = true
+                if cells[base + currentCol] != newCell {
+                    cells[base + currentCol] = newCell
+                    if currentCol < firstChanged { firstChanged = currentCol }
+                    lastChanged = currentCol
                 }
             }
             currentCol += 1
         }
 
-        if hasChanges {
-            let endCol = min(cols - 1, col + text.count - 1)
-            dirtyRegions.insert(DirtyRegion(
-                startRow: row, endRow: row,
-                startCol: startCol, endCol: max(startCol, endCol)
-            ))
+        if firstChanged <= lastChanged {
+            markDirty(row: row, from: firstChanged, to: lastChanged)
         }
     }
 
@@ -178,15 +200,12 @@ public final class ShadowBuffer {
         )
 
         for row in sRow...eRow {
+            let base = row * cols
             for col in sCol...eCol {
-                buffer[row][col] = fillCell
+                cells[base + col] = fillCell
             }
+            markDirty(row: row, from: sCol, to: eCol)
         }
-
-        dirtyRegions.insert(DirtyRegion(
-            startRow: sRow, endRow: eRow,
-            startCol: sCol, endCol: eCol
-        ))
     }
 
     /// Draws a horizontal line
@@ -206,14 +225,12 @@ public final class ShadowBuffer {
 
         let lineCell = ScreenCell(char: char, fgColor: fgColor, bgColor: bgColor, bold: bold)
 
+        let base = row * cols
         for col in sCol...eCol {
-            buffer[row][col] = lineCell
+            cells[base + col] = lineCell
         }
 
-        dirtyRegions.insert(DirtyRegion(
-            startRow: row, endRow: row,
-            startCol: sCol, endCol: eCol
-        ))
+        markDirty(row: row, from: sCol, to: eCol)
     }
 
     /// Draws a vertical line
@@ -234,105 +251,94 @@ public final class ShadowBuffer {
         let lineCell = ScreenCell(char: char, fgColor: fgColor, bgColor: bgColor, bold: bold)
 
         for row in sRow...eRow {
-            buffer[row][col] = lineCell
+            cells[row * cols + col] = lineCell
+            markDirty(row: row, from: col, to: col)
         }
-
-        dirtyRegions.insert(DirtyRegion(
-            startRow: sRow, endRow: eRow,
-            startCol: col, endCol: col
-        ))
     }
 
     // MARK: - Rendering
 
-    /// Renders only dirty regions to the terminal (key optimization)
+    /// Renders only dirty spans to the terminal (key optimization)
+    ///
+    /// Rows are visited top to bottom and each dirty span left to right, so
+    /// cells come out already in cursor order - no sorting. The whole frame
+    /// (cursor moves, SGR changes, glyphs) is encoded into `frame` and handed
+    /// to the sink in one call.
     public func render() {
-        guard !dirtyRegions.isEmpty else { return }
-
-        pendingUpdates.removeAll(keepingCapacity: true)
+        guard minDirtyRow <= maxDirtyRow else { return }
 
-        // Collect all changed cells in dirty regions
-        for region in dirtyRegions {
-            for row in region.startRow...region.endRow {
-                for col in region.startCol...region.endCol {
-                    guard isValid(row: row, col: col) else { continue }
-
-                    let currentCell = buffer[row][col]
-                    let previousCell = previousBuffer[row][col]
-
-                    // Only render if cell actually changed
-                    if currentCell != previousCell {
-                        pendingUpdates.append((row: row, col: col, cell: currentCell))
-
-                        // Batch rendering when we have enough updates
-                        if pendingUpdates.count >= maxBatchSize {
-                            flushPendingUpdates()
-                        }
+        frame.reset()
+        if synchronizedOutput {
+            frame.appendBeginSynchronizedUpdate()
+        }
+        let headerLength = frame.bytes.count
+
+        // Where the terminal cursor sits after the last glyph (-1 = unknown)
+        var cursorRow = -1
+        var cursorCol = -1
+
+        for row in minDirtyRow...maxDirtyRow {
+            let start = dirtyStart[row]
+            let end = dirtyEnd[row]
+            guard start <= end else { continue }
+
+            dirtyStart[row] = cols
+            dirtyEnd[row] = -1
+
+            let base = row * cols
+            for col in start...end {
+                let index = base + col
+                let cell = cells[index]
+
+                // Only render if cell actually changed
+                guard cell != previousCells[index] else { continue }
+                previousCells[index] = cell
+
+                // Skip cursor movement for sequential writes (major optimization)
+                if row != cursorRow || col != cursorCol {
+                    if row == cursorRow && col > cursorCol && col - cursorCol <= 4 {
+                        frame.appendCursorForward(col - cursorCol)
+                    } else {
+                        frame.appendMoveCursor(row: row + 1, column: col + 1)
                     }
                 }
-            }
-        }
 
-        // Flush remaining updates
-        if !pendingUpdates.isEmpty {
-            flushPendingUpdates()
-        }
-
-        // Copy dirty regions to previous buffer
-        for region in dirtyRegions {
-            for row in region.startRow...region.endRow {
-                for col in region.startCol...region.endCol {
-                    guard isValid(row: row, col: col) else { continue }
-                    previousBuffer[row][col] = buffer[row][col]
-                }
-            }
-        }
-
-        // Clear dirty regions
-        dirtyRegions.removeAll()
+                // Only emit ANSI codes if state changed (major optimization)
+                terminalState.encodeTransition(
+                    fgColor: cell.fgColor,
+                    bgColor: cell.bgColor,
+                    bold: cell.bold,
+                    italic: cell.italic,
+                    underline: cell.underline,
+                    strikethrough: cell.strikethrough,
+                    into: &frame
+                )
 
-        // Reset terminal state and flush output
-        ANSIRenderer.resetStyles()
-        terminalState.reset()
-        flushOutput()
-    }
+                frame.append(character: cell.char)
 
-    /// Flushes pending updates with optimized cursor movement
-    private func flushPendingUpdates() {
-        // Sort by row, then column for sequential cursor movement (major optimization)
-        pendingUpdates.sort { first, second in
-            if first.row != second.row {
-                return first.row < second.row
+                cursorRow = row
+                cursorCol = col + 1
             }
-            return first.col < second.col
         }
 
-        var lastRow = -1
-        var lastCol = -1
-
-        for update in pendingUpdates {
-            // Skip cursor movement for sequential writes (major optimization)
-            if update.row != lastRow || update.col != lastCol + 1 {
-                print(ANSIRenderer.moveCursor(row: update.row + 1, column: update.col + 1), terminator: "")
-            }
+        // Clear dirty spans
+        minDirtyRow = rows
+        maxDirtyRow = -1
 
-            // Only emit ANSI codes if state changed (major optimization)
-            terminalState.updateIfNeeded(
-                fgColor: update.cell.fgColor,
-                bgColor: update.cell.bgColor,
-                bold: update.cell.bold,
-                italic: update.cell.italic,
-                underline: update.cell.underline,
-                strikethrough: update.cell.strikethrough
-            )
-
-            print(update.cell.char, terminator: "")
+        // Nothing actually changed on screen - skip the write entirely
+        guard frame.bytes.count > headerLength else {
+            terminalState.reset()
+            return
+        }
 
-            lastRow = update.row
-            lastCol = update.col
+        // Reset terminal state so text printed outside the buffer is unstyled
+        frame.appendResetStyles()
+        terminalState.reset()
+        if synchronizedOutput {
+            frame.appendEndSynchronizedUpdate()
         }
 
-        pendingUpdates.removeAll(keepingCapacity: true)
+        frame.bytes.withUnsafeBytes { sink($0) }
     }
 
     // MARK: - Screen Management
@@ -340,33 +346,20 @@ public final class ShadowBuffer {
     /// Clears the entire buffer
     public func clear() {
         let emptyCell = ScreenCell()
-        for row in 0..<rows {
-            for col in 0..<cols {
-                buffer[row][col] = emptyCell
-            }
+        for index in cells.indices {
+            cells[index] = emptyCell
         }
-        dirtyRegions.removeAll()
-        dirtyRegions.insert(DirtyRegion(
-            startRow: 0, endRow: rows - 1,
-            startCol: 0, endCol: cols - 1
-        ))
+        markAllDirty()
     }
 
     /// Forces a full screen refresh (invalidates entire previous buffer)
     public func forceRefresh() {
-        dirtyRegions.removeAll()
-        dirtyRegions.insert(DirtyRegion(
-            startRow: 0, endRow: rows - 1,
-            startCol: 0, endCol: cols - 1
-        ))
-
         // Clear previous buffer to force all cells to redraw
         let nullCell = ScreenCell(char: "\0")
-        for row in 0..<rows {
-            for col in 0..<cols {
-                previousBuffer[row][col] = nullCell
-            }
+        for index in previousCells.indices {
+            previousCells[index] = nullCell
         }
+        markAllDirty()
 
         render()
     }
@@ -387,7 +380,11 @@ public final class ShadowBuffer {
 
     /// Creates a new buffer with specified size, preserving content
     public func resizedBuffer(rows newRows: Int, cols newCols: Int) -> ShadowBuffer {
-        let newBuffer = ShadowBuffer(rows: newRows, cols: newCols)
+        let newBuffer = ShadowBuffer(
+            rows: newRows, cols: newCols,
+            synchronizedOutput: synchronizedOutput,
+            sink: sink
+        )
 
         // Copy existing content to new buffer (preserving what fits)
         let copyRows = min(self.rows, newRows)
@@ -395,8 +392,8 @@ public final class ShadowBuffer {
 
         for row in 0..<copyRows {
             for col in 0..<copyCols {
-                let cell = self.buffer[row][col]
-                if cell.char != " " || cell.fgColor != nil || cell.bgColor != nil || cell.bold {
+                let cell = self.cells[row * cols + col]
+                if cell != ScreenCell() {
                     newBuffer.setCell(
                         row: row, col: col,
                         char: cell.char,
@@ -421,24 +418,47 @@ public final class ShadowBuffer {
         return (rows: rows, cols: cols)
     }
 
+    /// Returns the cell currently held at a position (nil if out of bounds)
+    public func cell(row: Int, col: Int) -> ScreenCell? {
+        guard isValid(row: row, col: col) else { return nil }
+        return cells[row * cols + col]
+    }
+
     /// Validates row/col coordinates
     @inline(__always)
     private func isValid(row: Int, col: Int) -> Bool {
         return row >= 0 && row < rows && col >= 0 && col < cols
     }
 
-    /// Adds a dirty region (single cell)
-    private func addDirtyRegion(row: Int, col: Int) {
-        dirtyRegions.insert(DirtyRegion(row: row, col: col))
+    /// Widens a row's dirty span to cover `from...to` (columns already clamped)
+    @inline(__always)
+    private func markDirty(row: Int, from: Int, to: Int) {
+        if from < dirtyStart[row] { dirtyStart[row] = from }
+        if to > dirtyEnd[row] { dirtyEnd[row] = to }
+        if row < minDirtyRow { minDirtyRow = row }
+        if row > maxDirtyRow { maxDirtyRow = row }
+    }
+
+    /// Marks every cell dirty
+    private func markAllDirty() {
+        guard rows > 0 && cols > 0 else { return }
+        for row in 0..<rows {
+            dirtyStart[row] = 0
+            dirtyEnd[row] = cols - 1
+        }
+        minDirtyRow = 0
+        maxDirtyRow = rows - 1
     }
 
-    /// Flushes output to terminal
-    private func flushOutput() {
+    /// Default sink: drain anything already buffered in stdio (so ordering
+    /// with `print`-based output is kept), then one `write(2)` for the frame
+    private static func writeToStdout(_ bytes: UnsafeRawBufferPointer) {
         // fflush(nil) flushes all open output streams; avoids referencing the C global 'stdout'
         #if canImport(Darwin)
         Darwin.fflush(nil)
         #elseif canImport(Glibc)
         Glibc.fflush(nil)
         #endif
+        FrameEncoder.writeAll(bytes, to: 1)
     }
 }
@@ -48,6 +48,30 @@ public struct TerminalState: Sendable {
         italic: Bool,
         underline: Bool,
         strikethrough: Bool
+    ) {
+        var frame = FrameEncoder(capacity: 32)
+        encodeTransition(
+            fgColor: fgColor, bgColor: bgColor,
+            bold: bold, italic: italic,
+            underline: underline, strikethrough: strikethrough,
+            into: &frame
+        )
+        if !frame.isEmpty {
+            print(String(decoding: frame.bytes, as: UTF8.self), terminator: "")
+        }
+    }
+
+    /// Appends the SGR sequence needed to reach the given style to `frame`
+    /// (nothing if the style is already current) and updates the tracked state.
+    /// Used by ShadowBuffer so a whole frame is encoded without String building.
+    public mutating func encodeTransition(
+        fgColor: TerminalColor?,
+        bgColor: TerminalColor?,
+        bold: Bool,
+        italic: Bool,
+        underline: Bool,
+        strikethrough: Bool,
+        into frame: inout FrameEncoder
     ) {
         // Check if any state differs
         let needsUpdate =
@@ -60,49 +84,58 @@ public struct TerminalState: Sendable {
 
         guard needsUpdate else { return }
 
-        // Build ANSI code for new state
-        var codes: [String] = []
+        var emitted = false
+        func param(_ code: Int) {
+            frame.append(byte: emitted ? UInt8(ascii: ";") : UInt8(ascii: "["))
+            frame.append(decimal: code)
+            emitted = true
+        }
+        func color(_ color: TerminalColor, base: Int) {
+            param(base)
+            param(5)
+            param(color.code)
+        }
 
         // Reset if we're turning off any styles
         let turningOffBold = currentBold && !bold
         let turningOffItalic = currentItalic && !italic
         let turningOffUnderline = currentUnderline && !underline
         let turningOffStrikethrough = currentStrikethrough && !strikethrough
+        let resetting = turningOffBold || turningOffItalic || turningOffUnderline || turningOffStrikethrough
 
-        if turningOffBold || turningOffItalic || turningOffUnderline || turningOffStrikethrough {
-            codes.append("0")  // Reset all
+        frame.append(byte: 0x1B)
+        if resetting {
+            param(0)  // Reset all
             // Need to re-apply any styles we want to keep
-            if bold { codes.append("1") }
-            if italic { codes.append("3") }
-            if underline { codes.append("4") }
-            if strikethrough { codes.append("9") }
+            if bold { param(1) }
+            if italic { param(3) }
+            if underline { param(4) }
+            if strikethrough { param(9) }
         } else {
             // Only add codes for styles being turned on
-            if bold && !currentBold { codes.append("1") }
-            if italic && !currentItalic { codes.append("3") }
-            if underline && !currentUnderline { codes.append("4") }
-            if strikethrough && !currentStrikethrough { codes.append("9") }
+            if bold && !currentBold { param(1) }
+            if italic && !currentItalic { param(3) }
+            if underline && !currentUnderline { param(4) }
+            if strikethrough && !currentStrikethrough { param(9) }
         }
 
-        // Foreground color
-        if fgColor != currentFgColor {
-            if let fg = fgColor {
-                codes.append(ANSIRenderer.colorCode(fg, foreground: true))
-            }
+        // Colors: a reset clears them, so re-apply whatever is wanted
+        if let fg = fgColor, resetting || fg != currentFgColor {
+            color(fg, base: 38)
         }
-
-        // Background color
-        if bgColor != currentBgColor {
-            if let bg = bgColor {
-                codes.append(ANSIRenderer.colorCode(bg, foreground: false))
-            }
+        if let bg = bgColor, resetting || bg != currentBgColor {
+            color(bg, base: 48)
         }
 
-        // Emit ANSI codes if we have any
-        if !codes.isEmpty {
-            print("\u{1B}[\(codes.joined(separator: ";"))m", terminator: "")
+        // Going back to the default color needs an explicit 39/49
+        if !resetting {
+            if fgColor == nil && currentFgColor != nil { param(39) }
+            if bgColor == nil && currentBgColor != nil { param(49) }
         }
 
+        // needsUpdate guarantees at least one parameter was written
+        frame.append(byte: UInt8(ascii: "m"))
+
         // Update state
         currentFgColor = fgColor
         currentBgColor = bgColor
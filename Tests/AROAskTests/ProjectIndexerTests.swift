@@ -0,0 +1,110 @@
+// ============================================================
+// ProjectIndexerTests.swift
+// AROAskTests - incremental project indexing + hashing embedder
+// ============================================================
+
+import Foundation
+import Testing
+@testable import AROAsk
+
+private func makeProject(_ files: [String: String]) throws -> URL {
+    let root = FileManager.default.temporaryDirectory.appendingPathComponent("aro-index-\(UUID().uuidString)")
+    for (path, text) in files {
+        let url = root.appendingPathComponent(path)
+        try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+        try Data(text.utf8).write(to: url)
+    }
+    return root
+}
+
+private func setModified(_ url: URL, _ date: Date) throws {
+    try FileManager.default.setAttributes([.modificationDate: date], ofItemAtPath: url.path)
+}
+
+@Suite("Project indexer")
+struct ProjectIndexerTests {
+
+    @Test("only changed and deleted files appear in the delta")
+    func incrementalDelta() async throws {
+        let root = try makeProject([
+            "main.aro": "(Application-Start: Demo) { <Return> an <OK: status>. }",
+            "docs/guide.md": "# Guide\nsearch the index",
+            "notes.md": "to be removed",
+            ".hidden/skip.md": "never indexed",
+        ])
+        defer { try? FileManager.default.removeItem(at: root) }
+        let indexer = ProjectIndexer(root: root, embedder: HashingEmbedder())
+
+        let full = try await indexer.update(from: nil)
+        #expect(full.isFullRebuild)
+        #expect(Set(full.chunks.map(\.path)) == ["main.aro", "docs/guide.md", "notes.md"])
+
+        let unchanged = try await indexer.update(from: full.manifest)
+        #expect(unchanged.isEmpty)
+        #expect(!unchanged.isFullRebuild)
+
+        let guide = root.appendingPathComponent("docs/guide.md")
+        try Data("# Guide\nrewritten".utf8).write(to: guide)
+        try setModified(guide, Date().addingTimeInterval(60))
+        try FileManager.default.removeItem(at: root.appendingPathComponent("notes.md"))
+
+        let delta = try await indexer.update(from: full.manifest)
+        #expect(delta.chunks.map(\.path) == ["docs/guide.md"])
+        #expect(delta.replacedPaths == ["docs/guide.md", "notes.md"])
+        #expect(delta.manifest.files.keys.sorted() == ["docs/guide.md", "main.aro"])
+    }
+
+    @Test("touched files with identical content are not re-embedded")
+    func touchedFileKeepsChunks() async throws {
+        let root = try makeProject(["a.aro": "one\ntwo"])
+        defer { try? FileManager.default.removeItem(at: root) }
+        let indexer = ProjectIndexer(root: root, embedder: HashingEmbedder())
+
+        let full = try await indexer.update(from: nil)
+        let file = root.appendingPathComponent("a.aro")
+        try setModified(file, Date().addingTimeInterval(120))
+
+        let delta = try await indexer.update(from: full.manifest)
+        #expect(delta.isEmpty)
+        #expect(delta.manifest.files["a.aro"]?.contentHash == full.manifest.files["a.aro"]?.contentHash)
+        #expect(delta.manifest.files["a.aro"]?.modified != full.manifest.files["a.aro"]?.modified)
+    }
+
+    @Test("a manifest from another embedder forces a full rebuild")
+    func embedderChangeRebuilds() async throws {
+        let root = try makeProject(["a.aro": "text"])
+        defer { try? FileManager.default.removeItem(at: root) }
+
+        let full = try await ProjectIndexer(root: root, embedder: HashingEmbedder(dimension: 64)).update(from: nil)
+        let rebuilt = try await ProjectIndexer(root: root, embedder: HashingEmbedder()).update(from: full.manifest)
+        #expect(rebuilt.isFullRebuild)
+        #expect(rebuilt.chunks.count == 1)
+    }
+
+    @Test("store update drops replaced paths and appends new chunks")
+    func storeUpdate() async throws {
+        let embedder = HashingEmbedder(dimension: 32)
+        func chunk(_ path: String, _ text: String) async throws -> IndexChunk {
+            IndexChunk(path: path, startLine: 1, endLine: 1, text: text, vector: try await embedder.embed(text))
+        }
+        let store = VectorStore(storeURL: FileManager.default.temporaryDirectory.appendingPathComponent("unused/vectors.json"))
+        await store.replaceAll([try await chunk("a", "alpha beta"), try await chunk("b", "gamma delta"), try await chunk("a", "alpha again")])
+
+        await store.update(replacingPaths: ["a"], with: [try await chunk("c", "epsilon zeta")])
+        #expect(await store.count == 2)
+        let hit = await store.search(query: try await embedder.embed("epsilon zeta"), k: 1).first
+        #expect(hit?.chunk.path == "c")
+        #expect(await store.search(query: try await embedder.embed("gamma delta"), k: 1).first?.chunk.path == "b")
+    }
+
+    @Test("hashing embedder is deterministic and normalized")
+    func hashingEmbedder() async throws {
+        let embedder = HashingEmbedder()
+        let first = try await embedder.embed("Extract the <user> from the request")
+        let second = try await embedder.embed("extract THE <user> from the request")
+        #expect(first == second)
+        let norm = first.reduce(0) { $0 + $1 * $1 }.squareRoot()
+        #expect(abs(norm - 1) < 1e-5)
+        #expect(try await embedder.embed("   ").allSatisfy { $0 == 0 })
+    }
+}
@@ -0,0 +1,180 @@
+// ============================================================
+// VectorStoreTests.swift
+// AROAskTests - binary vector store, top-k scoring, IVF index
+// ============================================================
+
+import Foundation
+import Testing
+@testable import AROAsk
+
+/// Deterministic vectors so results are reproducible across runs.
+private struct SeededGenerator: RandomNumberGenerator {
+    var state: UInt64
+
+    mutating func next() -> UInt64 {
+        state = state &* 6364136223846793005 &+ 1442695040888963407
+        return state
+    }
+}
+
+private func randomChunks(count: Int, dimension: Int, seed: UInt64 = 42) -> [IndexChunk] {
+    var rng = SeededGenerator(state: seed)
+    return (0..<count).map { i in
+        IndexChunk(
+            path: "src/file\(i % 17).aro",
+            startLine: i + 1,
+            endLine: i + 40,
+            text: "chunk \(i)",
+            vector: (0..<dimension).map { _ in Float.random(in: -1...1, using: &rng) }
+        )
+    }
+}
+
+private func cosine(_ a: [Float], _ b: [Float]) -> Float {
+    var dot: Float = 0, normA: Float = 0, normB: Float = 0
+    for i in a.indices {
+        dot += a[i] * b[i]
+        normA += a[i] * a[i]
+        normB += b[i] * b[i]
+    }
+    return dot / (normA.squareRoot() * normB.squareRoot())
+}
+
+private func temporaryStoreURL() -> URL {
+    FileManager.default.temporaryDirectory
+        .appendingPathComponent("aro-vectors-\(UUID().uuidString)")
+        .appendingPathComponent("vectors.json")
+}
+
+@Suite("Vector store")
+struct VectorStoreTests {
+
+    @Test("flat search matches an exhaustive cosine ranking")
+    func flatSearchMatchesCosine() async {
+        let chunks = randomChunks(count: 500, dimension: 37)
+        let store = VectorStore(storeURL: temporaryStoreURL())
+        await store.replaceAll(chunks)
+
+        let query = randomChunks(count: 1, dimension: 37, seed: 7)[0].vector
+        let expected = chunks.indices
+            .map { (index: $0, score: cosine(query, chunks[$0].vector)) }
+            .sorted { $0.score > $1.score }
+            .prefix(10)
+
+        let results = await store.search(query: query, k: 10)
+        #expect(results.map(\.chunk.startLine) == expected.map { chunks[$0.index].startLine })
+        for (result, reference) in zip(results, expected) {
+            #expect(abs(result.score - reference.score) < 1e-4)
+        }
+    }
+
+    @Test("top-k heap keeps the best entries in order")
+    func topKHeap() {
+        var heap = TopKHeap(capacity: 3)
+        for (index, score) in [Float(0.1), 0.9, 0.5, 0.9, 0.2, 0.7].enumerated() {
+            heap.offer(score: score, index: index)
+        }
+        #expect(heap.sorted().map(\.index) == [1, 3, 5])
+    }
+
+    @Test("binary index round-trips and replaces the legacy JSON file")
+    func saveAndLoad() async throws {
+        let url = temporaryStoreURL()
+        defer { try? FileManager.default.removeItem(at: url.deletingLastPathComponent()) }
+        let chunks = randomChunks(count: 50, dimension: 16)
+
+        try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+        try JSONEncoder().encode(chunks).write(to: url)
+
+        let migrated = VectorStore(storeURL: url)
+        try await migrated.load()
+        #expect(await migrated.count == 50)
+        try await migrated.save()
+        #expect(!FileManager.default.fileExists(atPath: url.path))
+
+        let reloaded = VectorStore(storeURL: url)
+        try await reloaded.load()
+        let hit = try #require(await reloaded.search(query: chunks[23].vector, k: 1).first)
+        #expect(hit.chunk.path == chunks[23].path)
+        #expect(hit.chunk.startLine == 24)
+        #expect(hit.chunk.text == "chunk 23")
+        #expect(abs(hit.score - 1) < 1e-5)
+    }
+
+    @Test("truncated vector files are rejected")
+    func rejectsTruncatedFile() async throws {
+        let url = temporaryStoreURL()
+        defer { try? FileManager.default.removeItem(at: url.deletingLastPathComponent()) }
+        let store = VectorStore(storeURL: url)
+        await store.replaceAll(randomChunks(count: 10, dimension: 8))
+        try await store.save()
+
+        let matrixURL = url.deletingLastPathComponent().appendingPathComponent("vectors.f32")
+        let bytes = try Data(contentsOf: matrixURL)
+        try bytes.prefix(bytes.count - 4).write(to: matrixURL)
+
+        await #expect(throws: VectorIndexError.self) {
+            try await VectorStore(storeURL: url).load()
+        }
+    }
+
+    @Test("a damaged metadata record is skipped instead of failing the load")
+    func skipsDamagedMetadataRecord() async throws {
+        let url = temporaryStoreURL()
+        defer { try? FileManager.default.removeItem(at: url.deletingLastPathComponent()) }
+        let chunks = randomChunks(count: 10, dimension: 8)
+        let store = VectorStore(storeURL: url)
+        await store.replaceAll(chunks)
+        try await store.save()
+
+        // Give record 3 a path length that runs past its end
+        let metadataURL = url.deletingLastPathComponent().appendingPathComponent("chunks.meta")
+        var bytes = try Data(contentsOf: metadataURL)
+        let offset = bytes.withUnsafeBytes { Int(UInt64(littleEndian: $0.loadUnaligned(fromByteOffset: 16 + 3 * 8, as: UInt64.self))) }
+        bytes.replaceSubrange((offset + 8)..<(offset + 12), with: [0xFF, 0xFF, 0x00, 0x00])
+        try bytes.write(to: metadataURL)
+
+        let reloaded = VectorStore(storeURL: url)
+        try await reloaded.load()
+        #expect(await reloaded.search(query: chunks[3].vector, k: 10).allSatisfy { $0.chunk.text != "chunk 3" })
+        #expect(await reloaded.search(query: chunks[4].vector, k: 1).first?.chunk.text == "chunk 4")
+
+        await reloaded.update(replacingPaths: [], with: [])
+        #expect(await reloaded.count == 9)
+    }
+
+    @Test("metadata whose offset table doesn't span the file is rejected")
+    func rejectsInconsistentMetadata() async throws {
+        let url = temporaryStoreURL()
+        defer { try? FileManager.default.removeItem(at: url.deletingLastPathComponent()) }
+        let store = VectorStore(storeURL: url)
+        await store.replaceAll(randomChunks(count: 10, dimension: 8))
+        try await store.save()
+
+        let metadataURL = url.deletingLastPathComponent().appendingPathComponent("chunks.meta")
+        try (try Data(contentsOf: metadataURL) + Data([0])).write(to: metadataURL)
+
+        await #expect(throws: VectorIndexError.self) {
+            try await VectorStore(storeURL: url).load()
+        }
+    }
+
+    @Test("IVF search finds stored vectors and survives a reload")
+    func ivfSearch() async throws {
+        let url = temporaryStoreURL()
+        defer { try? FileManager.default.removeItem(at: url.deletingLastPathComponent()) }
+        let chunks = randomChunks(count: 2_000, dimension: 24)
+        let store = VectorStore(storeURL: url, ivfThreshold: 1_000, probes: 4)
+        await store.replaceAll(chunks)
+        #expect(await store.usesIVF)
+        try await store.save()
+
+        let reloaded = VectorStore(storeURL: url, ivfThreshold: 1_000, probes: 4)
+        try await reloaded.load()
+        #expect(await reloaded.usesIVF)
+        for row in stride(from: 0, to: 2_000, by: 97) {
+            let hit = await reloaded.search(query: chunks[row].vector, k: 1).first
+            #expect(hit?.chunk.startLine == row + 1)
+        }
+    }
+}
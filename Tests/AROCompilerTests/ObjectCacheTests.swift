@@ -0,0 +1,350 @@
+// ============================================================
+// ObjectCacheTests.swift
+// AROCompiler Tests - Split Code Generation and Object Cache
+// ============================================================
+
+import XCTest
+@testable import AROCompiler
+@testable import AROParser
+
+#if !os(Windows)
+
+/// Tests that `generateModules` splits a program into linkable modules
+/// and that `LLVMObjectCache` only compiles modules whose IR changed.
+/// The compiler is a stub that counts calls, so no llc is needed; only
+/// the benchmark's ARO_BENCHMARKS run uses the real one.
+final class ObjectCacheTests: XCTestCase {
+
+    private var directory: String!
+
+    override func setUpWithError() throws {
+        directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("aro-cache-\(UUID())").path
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(atPath: directory)
+    }
+
+    // MARK: - Helpers
+
+    /// Counts compiler invocations and writes a placeholder object
+    private final class CompileCounter: @unchecked Sendable {
+        private let lock = NSLock()
+        private var calls = 0
+
+        var count: Int {
+            lock.lock()
+            defer { lock.unlock() }
+            return calls
+        }
+
+        func compile(_ irPath: String, _ outputPath: String) throws {
+            lock.lock()
+            calls += 1
+            lock.unlock()
+            let ir = try String(contentsOfFile: irPath, encoding: .utf8)
+            try Data(ir.utf8.prefix(64)).write(to: URL(fileURLWithPath: outputPath))
+        }
+    }
+
+    /// A cache with the stub compiler. Retention defaults to 0, so every
+    /// object the build doesn't reference is evicted.
+    private func cache(
+        _ counter: CompileCounter,
+        optimize: LLVMEmitter.OptimizationLevel = .none,
+        compiler: String = "stub",
+        retention: TimeInterval = 0
+    ) -> LLVMObjectCache {
+        LLVMObjectCache(directory: directory, optimize: optimize, compiler: compiler, retention: retention) { irPath, outputPath in
+            try counter.compile(irPath, outputPath)
+        }
+    }
+
+    /// Pretend every object in the cache was last used `age` ago
+    private func age(by age: TimeInterval) throws {
+        let past = Date().addingTimeInterval(-age)
+        for file in try FileManager.default.contentsOfDirectory(atPath: directory) where file.hasSuffix(".o") {
+            let path = (directory as NSString).appendingPathComponent(file)
+            try FileManager.default.setAttributes([.modificationDate: past], ofItemAtPath: path)
+        }
+    }
+
+    /// Compile ARO source to one module per feature set plus main
+    private func generateModules(_ source: String, file: StaticString = #filePath, line: UInt = #line) throws -> [LLVMCodeGenerationUnit] {
+        let result = Compiler().compile(source)
+        let errors = result.diagnostics.filter { $0.severity == .error }
+        guard errors.isEmpty else {
+            XCTFail("Compilation failed: \(errors.map(\.message).joined(separator: "; "))", file: file, line: line)
+            return []
+        }
+        return try LLVMCodeGenerator().generateModules(program: result.analyzedProgram)
+    }
+
+    private func program(greeting: String = "Hello") -> String {
+        """
+        (Application-Start: Cache App) {
+            Log "Starting" to the <console>.
+            Emit a <UserCreated: event> with { name: "Ann" }.
+            Return an <OK: status> for the <startup>.
+        }
+
+        (Greet User: UserCreated Handler) {
+            Extract the <name> from the <event: name>.
+            Log "\(greeting)" to the <console>.
+            Return an <OK: status> for the <greeting>.
+        }
+
+        (Audit User: UserCreated Handler) {
+            Extract the <items> from the <event: items>.
+            For each <item> in <items> {
+                Log <item> to the <console>.
+            }
+            Return an <OK: status> for the <audit>.
+        }
+        """
+    }
+
+    /// Names of the functions a module defines
+    private func definedFunctions(_ ir: String) -> [String] {
+        ir.split(separator: "\n").compactMap { line -> String? in
+            guard line.hasPrefix("define "), let at = line.firstIndex(of: "@") else { return nil }
+            let name = line[line.index(after: at)...].prefix { $0 != "(" }
+            return String(name).trimmingCharacters(in: CharacterSet(charactersIn: "\""))
+        }
+    }
+
+    // MARK: - Module Split
+
+    func testOneModulePerFeatureSetPlusMain() throws {
+        let units = try generateModules(program())
+        XCTAssertEqual(units.map(\.name), [
+            "aro_fs_application_start_cache_app",
+            "aro_fs_greet_user",
+            "aro_fs_audit_user",
+            "aro_main",
+        ])
+        XCTAssertTrue(definedFunctions(units.last!.irText).contains("main"))
+    }
+
+    func testModulesDefineEachSymbolOnce() throws {
+        let units = try generateModules(program())
+        var owners: [String: String] = [:]
+        for unit in units {
+            for function in definedFunctions(unit.irText) {
+                XCTAssertNil(owners[function], "\(function) defined in \(owners[function] ?? "") and \(unit.name)")
+                owners[function] = unit.name
+            }
+        }
+        for unit in units.dropLast() {
+            XCTAssertEqual(owners[unit.name], unit.name, "\(unit.name) should define its feature set")
+        }
+    }
+
+    func testModuleGenerationIsDeterministic() throws {
+        let first = try generateModules(program())
+        let second = try generateModules(program())
+        XCTAssertEqual(first.map(\.irText), second.map(\.irText))
+    }
+
+    // MARK: - Object Cache
+
+    func testUnchangedRebuildCompilesNothing() throws {
+        let counter = CompileCounter()
+        let first = try cache(counter).objects(for: try generateModules(program()))
+        XCTAssertEqual(first.compiledCount, 4)
+        XCTAssertEqual(counter.count, 4)
+
+        let second = try cache(counter).objects(for: try generateModules(program()))
+        XCTAssertEqual(second.compiledCount, 0)
+        XCTAssertEqual(counter.count, 4, "a no-change rebuild must not run the compiler")
+        XCTAssertEqual(second.objectPaths, first.objectPaths)
+    }
+
+    func testEditingOneFeatureSetRecompilesOnlyIt() throws {
+        let counter = CompileCounter()
+        let before = try cache(counter).objects(for: try generateModules(program()))
+        let after = try cache(counter).objects(for: try generateModules(program(greeting: "Welcome")))
+
+        XCTAssertEqual(after.compiledCount, 1)
+        let changed = zip(before.objectPaths, after.objectPaths).enumerated().filter { $0.element.0 != $0.element.1 }
+        XCTAssertEqual(changed.map(\.offset), [1], "only the Greet User object should change")
+    }
+
+    func testOptimizationLevelIsPartOfKey() throws {
+        let counter = CompileCounter()
+        let units = try generateModules(program())
+        _ = try cache(counter).objects(for: units)
+        let optimized = try cache(counter, optimize: .o2).objects(for: units)
+        XCTAssertEqual(optimized.compiledCount, units.count)
+    }
+
+    func testCompilerIsPartOfKey() throws {
+        let counter = CompileCounter()
+        let units = try generateModules(program())
+        _ = try cache(counter, compiler: "/usr/bin/llc 19.1.7").objects(for: units)
+        let upgraded = try cache(counter, compiler: "/usr/bin/llc 20.1.8").objects(for: units)
+        XCTAssertEqual(upgraded.compiledCount, units.count)
+        let moved = try cache(counter, compiler: "/opt/llvm/bin/llc 20.1.8").objects(for: units)
+        XCTAssertEqual(moved.compiledCount, units.count)
+    }
+
+    func testRebuildEvictsUnreferencedObjects() throws {
+        let counter = CompileCounter()
+        let before = try cache(counter).objects(for: try generateModules(program()))
+        XCTAssertEqual(before.evictedCount, 0)
+        let after = try cache(counter).objects(for: try generateModules(program(greeting: "Welcome")))
+
+        XCTAssertEqual(after.evictedCount, 1)
+        XCTAssertFalse(FileManager.default.fileExists(atPath: before.objectPaths[1]))
+        let files = try FileManager.default.contentsOfDirectory(atPath: directory)
+        XCTAssertEqual(Set(files), Set(after.objectPaths.map { ($0 as NSString).lastPathComponent }))
+    }
+
+    func testProjectsSharingTheDirectoryKeepEachOthersObjects() throws {
+        let counter = CompileCounter()
+        let retention = LLVMObjectCache.defaultRetention
+        let first = try cache(counter, retention: retention).objects(for: try generateModules(program()))
+        let second = try cache(counter, retention: retention).objects(for: try generateModules(program(greeting: "Welcome")))
+        XCTAssertEqual(second.evictedCount, 0)
+
+        let again = try cache(counter, retention: retention).objects(for: try generateModules(program()))
+        XCTAssertEqual(again.compiledCount, 0, "the other project's build must not evict these objects")
+        XCTAssertEqual(again.objectPaths, first.objectPaths)
+    }
+
+    func testObjectsUnusedForTheRetentionPeriodAreEvicted() throws {
+        let counter = CompileCounter()
+        let retention = LLVMObjectCache.defaultRetention
+        let before = try cache(counter, retention: retention).objects(for: try generateModules(program()))
+        try age(by: retention + 60)
+
+        // The rebuild reuses and refreshes three of the old objects; only
+        // the edited feature set's old object is past the retention
+        let after = try cache(counter, retention: retention).objects(for: try generateModules(program(greeting: "Welcome")))
+        XCTAssertEqual(after.compiledCount, 1)
+        XCTAssertEqual(after.evictedCount, 1)
+        XCTAssertFalse(FileManager.default.fileExists(atPath: before.objectPaths[1]))
+        for path in after.objectPaths {
+            XCTAssertTrue(FileManager.default.fileExists(atPath: path), path)
+        }
+    }
+
+    func testEvictionKeepsFilesThatAreNotObjects() throws {
+        let counter = CompileCounter()
+        try FileManager.default.createDirectory(atPath: directory, withIntermediateDirectories: true)
+        let kept = ["notes.txt", String(repeating: "0", count: 32) + ".ll", String(repeating: "0", count: 32) + ".partial.o"]
+        for name in kept {
+            try Data().write(to: URL(fileURLWithPath: directory).appendingPathComponent(name))
+        }
+        let result = try cache(counter).objects(for: try generateModules(program()))
+
+        XCTAssertEqual(result.evictedCount, 0)
+        let files = Set(try FileManager.default.contentsOfDirectory(atPath: directory))
+        XCTAssertTrue(files.isSuperset(of: kept), "\(files)")
+    }
+
+    func testObjectsAreNamedByKeyAndIntermediatesRemoved() throws {
+        let counter = CompileCounter()
+        let units = try generateModules(program())
+        let objectCache = cache(counter)
+        let result = try objectCache.objects(for: units)
+
+        for (unit, path) in zip(units, result.objectPaths) {
+            XCTAssertEqual((path as NSString).lastPathComponent, objectCache.key(for: unit.irText) + ".o")
+        }
+        let files = try FileManager.default.contentsOfDirectory(atPath: directory)
+        XCTAssertEqual(files.filter { $0.hasSuffix(".o") }.count, units.count)
+        XCTAssertEqual(files.count, units.count, "only objects should remain: \(files)")
+    }
+
+    func testFailedCompileKeepsIR() throws {
+        struct Boom: Error {}
+        let units = try generateModules(program())
+        let failing = LLVMObjectCache(directory: directory, compiler: "stub") { irPath, outputPath in
+            if try String(contentsOfFile: irPath, encoding: .utf8).contains("define ptr @aro_fs_greet_user") {
+                throw Boom()
+            }
+            try Data().write(to: URL(fileURLWithPath: outputPath))
+        }
+
+        do {
+            _ = try failing.objects(for: units)
+            XCTFail("expected a compile error")
+        } catch let error as LLVMObjectCache.CompileError {
+            XCTAssertTrue(error.underlying is Boom)
+            XCTAssertTrue(FileManager.default.fileExists(atPath: error.irPath))
+        }
+
+        // The other modules were cached; the retry compiles only the failed one
+        let counter = CompileCounter()
+        let retry = try cache(counter).objects(for: units)
+        XCTAssertEqual(retry.compiledCount, 1)
+    }
+
+    // MARK: - Benchmark
+
+    func testBenchmarkFiveHundredFeatureSets() throws {
+        let featureSetCount = 500
+        func source(edited: Int? = nil) -> String {
+            var text = """
+            (Application-Start: Bench App) {
+                Log "Starting" to the <console>.
+                Return an <OK: status> for the <startup>.
+            }
+
+            """
+            for i in 0..<featureSetCount {
+                let message = i == edited ? "edited \(i)" : "handled \(i)"
+                text += """
+
+                (Handle Event \(i): Event\(i) Handler) {
+                    Extract the <value> from the <event: value>.
+                    Compute the <doubled> from <value> * 2.
+                    Log "\(message)" to the <console>.
+                    Return an <OK: status> for the <event>.
+                }
+
+                """
+            }
+            return text
+        }
+
+        func run(_ label: String, _ makeCache: () -> LLVMObjectCache) throws {
+            func build(_ text: String) throws -> (LLVMObjectCache.Result, TimeInterval) {
+                let start = Date()
+                let result = try makeCache().objects(for: try generateModules(text))
+                return (result, Date().timeIntervalSince(start))
+            }
+
+            let (cold, coldTime) = try build(source())
+            let (warm, warmTime) = try build(source())
+            let (edited, editedTime) = try build(source(edited: 250))
+            print("""
+                \(featureSetCount) feature sets (\(label)): cold \(cold.compiledCount) compiled in \(String(format: "%.2f", coldTime)) s, \
+                no-change \(warm.compiledCount) in \(String(format: "%.2f", warmTime)) s, \
+                one edit \(edited.compiledCount) in \(String(format: "%.2f", editedTime)) s
+                """)
+
+            XCTAssertEqual(cold.compiledCount, featureSetCount + 2, label)
+            XCTAssertEqual(warm.compiledCount, 0, label)
+            XCTAssertEqual(edited.compiledCount, 1, label)
+            XCTAssertEqual(edited.evictedCount, 1, label)
+        }
+
+        let counter = CompileCounter()
+        try run("stub compiler") { cache(counter) }
+
+        // The real compiler takes minutes for a cold build, so it only
+        // runs with ARO_BENCHMARKS set and llc (clang on macOS) installed
+        guard ProcessInfo.processInfo.environment["ARO_BENCHMARKS"] != nil,
+              let compiler = try? LLVMEmitter().compilerIdentity() else {
+            print("\(featureSetCount) feature sets (llc): skipped; set ARO_BENCHMARKS=1 with llc installed")
+            return
+        }
+        try FileManager.default.removeItem(atPath: directory)
+        try run(compiler) { LLVMObjectCache(directory: directory, retention: 0) }
+    }
+}
+
+#endif
@@ -0,0 +1,281 @@
+// ============================================================
+// OptimizationPipelineTests.swift
+// AROCompiler Tests - IR Optimization Passes and Bridge Attributes
+// ============================================================
+
+import XCTest
+@testable import AROCompiler
+@testable import AROParser
+
+#if !os(Windows)
+
+/// FileCheck-style tests over the IR produced at each optimization
+/// level, plus a benchmark comparing the examples at -O0 and -O2.
+final class OptimizationPipelineTests: XCTestCase {
+
+    // MARK: - Helpers
+
+    private func generateIR(
+        _ source: String,
+        level: LLVMEmitter.OptimizationLevel,
+        file: StaticString = #filePath,
+        line: UInt = #line
+    ) throws -> String {
+        let result = Compiler().compile(source)
+        let errors = result.diagnostics.filter { $0.severity == .error }
+        guard errors.isEmpty else {
+            XCTFail("Compilation failed: \(errors.map(\.message).joined(separator: "; "))", file: file, line: line)
+            return ""
+        }
+        return try LLVMCodeGenerator(optimizationLevel: level).generate(program: result.analyzedProgram).irText
+    }
+
+    /// A small subset of LLVM's FileCheck. `CHECK:` and `CHECK-LABEL:`
+    /// match the next line containing the pattern, `CHECK-NEXT:` the
+    /// line right after the previous match, and `CHECK-NOT:` must not
+    /// match between the previous and the next positive match (or the
+    /// end). `{{...}}` embeds a regular expression.
+    private func fileCheck(_ ir: String, _ checks: String, file: StaticString = #filePath, line: UInt = #line) {
+        let lines = ir.components(separatedBy: "\n")
+        var position = 0
+        var forbidden: [String] = []
+
+        func matches(_ text: String, _ pattern: String) -> Bool {
+            var regex = ""
+            var rest = Substring(pattern)
+            while let open = rest.range(of: "{{"), let close = rest[open.upperBound...].range(of: "}}") {
+                regex += NSRegularExpression.escapedPattern(for: String(rest[..<open.lowerBound]))
+                regex += rest[open.upperBound..<close.lowerBound]
+                rest = rest[close.upperBound...]
+            }
+            regex += NSRegularExpression.escapedPattern(for: String(rest))
+            return text.range(of: regex, options: .regularExpression) != nil
+        }
+
+        func checkForbidden(upTo end: Int) -> Bool {
+            for pattern in forbidden {
+                if let hit = lines[position..<end].first(where: { matches($0, pattern) }) {
+                    XCTFail("CHECK-NOT: \(pattern) matched: \(hit)", file: file, line: line)
+                    return false
+                }
+            }
+            forbidden.removeAll()
+            return true
+        }
+
+        for check in checks.components(separatedBy: "\n") {
+            let check = check.trimmingCharacters(in: .whitespaces)
+            guard let colon = check.firstIndex(of: ":"), check.hasPrefix("CHECK") else { continue }
+            let directive = check[..<colon]
+            let pattern = check[check.index(after: colon)...].trimmingCharacters(in: .whitespaces)
+
+            switch directive {
+            case "CHECK-NOT":
+                forbidden.append(pattern)
+            case "CHECK-NEXT":
+                guard position < lines.count, matches(lines[position], pattern) else {
+                    XCTFail("CHECK-NEXT: \(pattern) did not match: \(position < lines.count ? lines[position] : "<end>")",
+                            file: file, line: line)
+                    return
+                }
+                position += 1
+            default:
+                guard let index = lines[position...].firstIndex(where: { matches($0, pattern) }) else {
+                    XCTFail("\(directive): \(pattern) not found", file: file, line: line)
+                    return
+                }
+                guard checkForbidden(upTo: index) else { return }
+                position = index + 1
+            }
+        }
+        _ = checkForbidden(upTo: lines.count)
+    }
+
+    private let source = """
+        (Application-Start: Test App) {
+            Extract the <items> from the <request: body>.
+            Compute the <total> from 2 * 21.
+            Log <total> to the <console>.
+            Return an <OK: status> for the <startup>.
+        }
+
+        (Audit Items: ItemsChanged Handler) {
+            Extract the <count> from the <event: count>.
+            Log <count> to the <console>.
+            Return an <OK: status> for the <audit>.
+        }
+        """
+
+    // MARK: - Bridge Attributes
+
+    func testBridgeDeclarationsAreNounwind() throws {
+        let ir = try generateIR(source, level: .none)
+        fileCheck(ir, """
+            CHECK: declare ptr @aro_runtime_init() #{{[0-9]+}}
+            CHECK: declare {{.*}}@aro_action_extract({{.*}}) #{{[0-9]+}}
+            CHECK: attributes #{{[0-9]+}} = { nounwind }
+            """)
+    }
+
+    /// Attribute group number on the declaration of `function`
+    private func attributeGroup(of function: String, in ir: String) -> String? {
+        ir.split(separator: "\n")
+            .first { $0.hasPrefix("declare ") && $0.contains("@\(function)(") }
+            .flatMap { line in line.range(of: "#[0-9]+$", options: .regularExpression).map { String(line[$0]) } }
+    }
+
+    /// The queries lock or retain, so none of them may be `memory(read)`
+    func testBridgeQueriesAreNotReadOnly() throws {
+        let ir = try generateIR(source, level: .none)
+        let group = try XCTUnwrap(attributeGroup(of: "aro_runtime_init", in: ir))
+        for function in ["aro_has_keep_alive", "aro_context_has_error", "aro_array_count"] {
+            XCTAssertEqual(try XCTUnwrap(attributeGroup(of: function, in: ir)), group, function)
+        }
+        fileCheck(ir, "CHECK: attributes \(group) = { nounwind }")
+    }
+
+    func testFeatureSetsHaveNoBridgeAttributes() throws {
+        let ir = try generateIR(source, level: .none)
+        let definitions = ir.split(separator: "\n").filter { $0.hasPrefix("define ") }
+        XCTAssertFalse(definitions.isEmpty)
+        for definition in definitions {
+            XCTAssertNil(definition.range(of: "#[0-9]+", options: .regularExpression), String(definition))
+        }
+    }
+
+    // MARK: - Pipeline
+
+    func testNoPassesRunAtO0() throws {
+        let ir = try generateIR(source, level: .none)
+        fileCheck(ir, """
+            CHECK-LABEL: define ptr @aro_fs_audit_items(ptr %0)
+            CHECK: alloca ptr
+            CHECK: store ptr null
+            CHECK: load ptr
+            CHECK: ret ptr
+            """)
+    }
+
+    func testO2PromotesResultSlotToRegisters() throws {
+        let ir = try generateIR(source, level: .o2)
+        fileCheck(ir, """
+            CHECK-LABEL: define ptr @aro_fs_audit_items(ptr
+            CHECK-NOT: alloca ptr,
+            CHECK: call {{.*}}@aro_action_extract
+            CHECK: ret ptr
+            """)
+    }
+
+    func testO2KeepsEveryEntryPoint() throws {
+        let ir = try generateIR(source, level: .o2)
+        fileCheck(ir, """
+            CHECK: define {{.*}}@aro_fs_application_start_test_app(
+            CHECK: define {{.*}}@aro_fs_audit_items(
+            CHECK: define {{.*}}@main(
+            """)
+        XCTAssertEqual(ir, try generateIR(source, level: .o2), "optimized IR should be deterministic")
+    }
+
+    func testSplitModulesAreOptimized() throws {
+        let result = Compiler().compile(source)
+        let units = try LLVMCodeGenerator(optimizationLevel: .o2).generateModules(program: result.analyzedProgram)
+        for unit in units.dropLast() {
+            fileCheck(unit.irText, """
+                CHECK-LABEL: define ptr @\(unit.name)(ptr
+                CHECK-NOT: alloca ptr,
+                CHECK: ret ptr
+                """)
+        }
+    }
+
+    // MARK: - Benchmark
+
+    private static func repoRoot(file: StaticString = #filePath) -> URL {
+        URL(fileURLWithPath: "\(file)")
+            .deletingLastPathComponent()
+            .deletingLastPathComponent()
+            .deletingLastPathComponent()
+    }
+
+    /// Instructions and bridge calls in the function bodies of `ir`
+    private static func measure(_ ir: String) -> (instructions: Int, calls: Int) {
+        var instructions = 0
+        var calls = 0
+        var inFunction = false
+        for line in ir.split(separator: "\n", omittingEmptySubsequences: true) {
+            if line.hasPrefix("define ") { inFunction = true; continue }
+            if line.hasPrefix("}") { inFunction = false; continue }
+            guard inFunction, line.hasPrefix("  ") else { continue }
+            instructions += 1
+            if line.contains("call ") && line.contains("@aro_") { calls += 1 }
+        }
+        return (instructions, calls)
+    }
+
+    /// Compiles every example's main.aro at -O0 and -O2 and reports IR
+    /// size, bridge calls and, when llc is installed, llc time and
+    /// object size. Running the binaries needs the linked runtime, so
+    /// end-to-end timings come from `aro build --optimize` instead.
+    func testBenchmarkExamplesO0VersusO2() throws {
+        let examples = Self.repoRoot().appendingPathComponent("Examples")
+        let directories = try FileManager.default.contentsOfDirectory(atPath: examples.path).sorted()
+        let scratch = FileManager.default.temporaryDirectory.appendingPathComponent("aro-opt-\(UUID())")
+        try FileManager.default.createDirectory(at: scratch, withIntermediateDirectories: true)
+        defer { try? FileManager.default.removeItem(at: scratch) }
+
+        var llcAvailable = true
+        var totals: [LLVMEmitter.OptimizationLevel: (instructions: Int, calls: Int, objectBytes: Int, llcSeconds: Double)] = [:]
+        var measured = 0
+
+        for name in directories {
+            let mainFile = examples.appendingPathComponent(name).appendingPathComponent("main.aro")
+            guard let text = try? String(contentsOf: mainFile, encoding: .utf8) else { continue }
+            let compiled = Compiler().compile(text)
+            guard !compiled.diagnostics.contains(where: { $0.severity == .error }) else { continue }
+
+            var irByLevel: [LLVMEmitter.OptimizationLevel: String] = [:]
+            for level in [LLVMEmitter.OptimizationLevel.none, .o2] {
+                irByLevel[level] = try? LLVMCodeGenerator(optimizationLevel: level)
+                    .generate(program: compiled.analyzedProgram).irText
+            }
+            guard let o0 = irByLevel[.none], let o2 = irByLevel[.o2] else { continue }
+            measured += 1
+
+            for (level, ir) in [(LLVMEmitter.OptimizationLevel.none, o0), (.o2, o2)] {
+                let counts = Self.measure(ir)
+                var entry = totals[level] ?? (0, 0, 0, 0)
+                entry.instructions += counts.instructions
+                entry.calls += counts.calls
+
+                if llcAvailable {
+                    let irPath = scratch.appendingPathComponent("\(name)\(level.rawValue).ll").path
+                    let objectPath = scratch.appendingPathComponent("\(name)\(level.rawValue).o").path
+                    try ir.write(toFile: irPath, atomically: true, encoding: .utf8)
+                    let start = Date()
+                    do {
+                        try LLVMEmitter().emitObject(irPath: irPath, to: objectPath, optimize: level)
+                        entry.llcSeconds += Date().timeIntervalSince(start)
+                        entry.objectBytes += (try? FileManager.default.attributesOfItem(atPath: objectPath)[.size] as? Int) ?? 0
+                    } catch {
+                        llcAvailable = false
+                    }
+                }
+                totals[level] = entry
+            }
+
+            // Optimizing must never add work
+            XCTAssertLessThanOrEqual(Self.measure(o2).instructions, Self.measure(o0).instructions, name)
+        }
+
+        XCTAssertGreaterThan(measured, 10, "examples not found under \(examples.path)")
+        for level in [LLVMEmitter.OptimizationLevel.none, .o2] {
+            guard let entry = totals[level] else { continue }
+            let llc = llcAvailable
+                ? ", llc \(String(format: "%.2f", entry.llcSeconds)) s, objects \(entry.objectBytes >> 10) KB"
+                : ", llc not available"
+            print("\(level.rawValue) over \(measured) examples: \(entry.instructions) instructions, \(entry.calls) bridge calls\(llc)")
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,90 @@
+// ============================================================
+// StatementDependencyGraphTests.swift
+// ARO Parser - statement dependency DAG for parallel execution
+// ============================================================
+
+import Testing
+@testable import AROParser
+
+@Suite("Statement Dependency Graph")
+struct StatementDependencyGraphTests {
+
+    private func analyzeFirst(_ source: String) throws -> AnalyzedFeatureSet {
+        let program = try Parser.parse(source)
+        let analyzer = DataFlowAnalyzer(diagnostics: DiagnosticCollector())
+        return analyzer.analyzeFeatureSet(program.featureSets[0])
+    }
+
+    @Test("Independent requests form one batch; the consumer depends on both")
+    func independentRequests() throws {
+        let analyzed = try analyzeFirst("""
+        (Dashboard: Aggregator) {
+            Request the <users> from the <user-api>.
+            Request the <orders> from the <order-api>.
+            Compute the <summary> from <users> with <orders>.
+            Return an <OK: status> with <summary>.
+        }
+        """)
+        let graph = analyzed.dependencyGraph
+
+        #expect(graph.parallelBatches == [0..<2])
+        #expect(graph.predecessors[1].isEmpty)
+        #expect(Set(graph.predecessors[2]).isSuperset(of: [0, 1]))
+        #expect(graph.predecessors[3].contains(2))
+    }
+
+    @Test("A request that reads another request's result is not batched with it")
+    func dependentRequests() throws {
+        let analyzed = try analyzeFirst("""
+        (Profile: Aggregator) {
+            Request the <user> from the <user-api>.
+            Request the <avatar> from the <user>.
+        }
+        """)
+        #expect(analyzed.dependencyGraph.parallelBatches.isEmpty)
+        #expect(analyzed.dependencyGraph.predecessors[1] == [0])
+    }
+
+    @Test("Side effects are barriers between requests")
+    func sideEffectBarrier() throws {
+        let analyzed = try analyzeFirst("""
+        (Sync: Aggregator) {
+            Request the <first> from the <first-api>.
+            Log "between" to the <console>.
+            Request the <second> from the <second-api>.
+        }
+        """)
+        let graph = analyzed.dependencyGraph
+        #expect(graph.parallelBatches.isEmpty)
+        #expect(graph.predecessors[1] == [0])
+        // Ordered after the first request through the barrier, not directly
+        #expect(graph.predecessors[2] == [1])
+    }
+
+    @Test("Only requests known to be GETs are batched")
+    func nonGetRequestsAreBarriers() throws {
+        let posted = try analyzeFirst("""
+        (Checkout: Aggregator) {
+            Request the <cart> from the <cart-api>.
+            Request the <order> to the <order-api>.
+        }
+        """)
+        #expect(posted.dependencyGraph.parallelBatches.isEmpty)
+
+        let configured = try analyzeFirst("""
+        (Checkout: Aggregator) {
+            Request the <cart> from the <cart-api> with { method: "GET" }.
+            Request the <order> from the <order-api> with { method: "DELETE" }.
+        }
+        """)
+        #expect(configured.dependencyGraph.parallelBatches.isEmpty)
+
+        let fetched = try analyzeFirst("""
+        (Checkout: Aggregator) {
+            Request the <cart> from the <cart-api> with { method: "GET" }.
+            Request the <prices> via the <price-api: get>.
+        }
+        """)
+        #expect(fetched.dependencyGraph.parallelBatches == [0..<2])
+    }
+}
@@ -0,0 +1,34 @@
+// ============================================================
+// BenchmarkGate.swift
+// ARO Runtime Tests - Opt-in switch for large benchmarks
+// ============================================================
+
+import Foundation
+import XCTest
+
+/// Benchmarks that generate hundreds of megabytes or millions of records
+/// run only when `ARO_BENCHMARKS` is set, so a plain `swift test` (and CI)
+/// stays fast:
+///
+/// ```
+/// ARO_BENCHMARKS=1 swift test --filter Benchmark
+/// ```
+enum BenchmarkGate {
+    static var isEnabled: Bool {
+        ProcessInfo.processInfo.environment["ARO_BENCHMARKS"] != nil
+    }
+
+    /// Skip the calling test unless benchmarks are enabled
+    static func require() throws {
+        guard isEnabled else {
+            throw XCTSkip("Large benchmark; set ARO_BENCHMARKS=1 to run it")
+        }
+    }
+
+    /// Input size in bytes: `ARO_BENCHMARK_MB` megabytes when set,
+    /// otherwise `defaultMegabytes`
+    static func bytes(defaultMegabytes: Int) -> Int {
+        let megabytes = ProcessInfo.processInfo.environment["ARO_BENCHMARK_MB"].flatMap(Int.init) ?? defaultMegabytes
+        return max(1, megabytes) << 20
+    }
+}
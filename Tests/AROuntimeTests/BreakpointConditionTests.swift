@@ -0,0 +1,212 @@
+// ============================================================
+// BreakpointConditionTests.swift
+// ARO Runtime - Compiled conditional breakpoint predicates
+// ============================================================
+//
+// Grouping is checked through the condition's parenthesized
+// description; quoting and operator characters inside values are
+// checked by evaluating against both a live context and snapshots.
+
+import XCTest
+@testable import ARORuntime
+
+final class BreakpointConditionTests: XCTestCase {
+
+    private func grouping(_ source: String) throws -> String {
+        try BreakpointCondition(source).description
+    }
+
+    private func parseError(_ source: String) -> BreakpointConditionError? {
+        do {
+            _ = try BreakpointCondition(source)
+            return nil
+        } catch {
+            return error as? BreakpointConditionError
+        }
+    }
+
+    // MARK: - Precedence
+
+    func testAndBindsTighterThanOr() throws {
+        XCTAssertEqual(
+            try grouping("<a> == 1 || <b> == 2 && <c> == 3"),
+            "((<a> == 1) || ((<b> == 2) && (<c> == 3)))"
+        )
+        XCTAssertEqual(
+            try grouping("<a> == 1 && <b> == 2 || <c> == 3"),
+            "(((<a> == 1) && (<b> == 2)) || (<c> == 3))"
+        )
+    }
+
+    func testKeywordsMatchSymbols() throws {
+        XCTAssertEqual(
+            try grouping("<a> == 1 or <b> == 2 and not <c>"),
+            try grouping("<a> == 1 || <b> == 2 && !<c>")
+        )
+    }
+
+    func testNotAppliesToTheComparison() throws {
+        XCTAssertEqual(try grouping("not <a> == 1 and <b>"), "(!(<a> == 1) && <b>)")
+        XCTAssertEqual(try grouping("!!<a>"), "!!<a>")
+        XCTAssertEqual(try grouping("<a> != 1"), "(<a> != 1)")
+    }
+
+    func testParenthesesOverridePrecedence() throws {
+        XCTAssertEqual(
+            try grouping("(<a> || <b>) && !(<c> < <d>)"),
+            "((<a> || <b>) && !(<c> < <d>))"
+        )
+        XCTAssertEqual(try grouping("<count> <= -2.5"), "(<count> <= -2.5)")
+        XCTAssertEqual(try grouping("<user: role> >= 3"), "(<user: role> >= 3)")
+    }
+
+    // MARK: - Quoting
+
+    func testQuotedOperatorCharactersStayInTheValue() throws {
+        XCTAssertEqual(try grouping(#"<s> == "a && b || c""#), #"(<s> == "a && b || c")"#)
+        XCTAssertEqual(try grouping("<s> == 'x|y' && <t> == '&'"), #"((<s> == "x|y") && (<t> == "&"))"#)
+        XCTAssertEqual(try grouping(#"<s> == "say \"hi\"""#), #"(<s> == "say \"hi\"")"#)
+        XCTAssertEqual(try grouping(#"<s> == 'it\'s'"#), #"(<s> == "it's")"#)
+        XCTAssertEqual(try grouping(#"<s> == "or and not""#), #"(<s> == "or and not")"#)
+    }
+
+    // MARK: - Evaluation
+
+    func testValuesContainingOperatorsAgainstLiveContext() async throws {
+        let context = RuntimeContext(featureSetName: "Test")
+        context.bind("query", value: "a&&b||c")
+        context.bind("count", value: 41)
+
+        let matches = [
+            #"<query> == "a&&b||c""#,
+            "<query> != 'a' && <count> == 41",
+            "<count> > 40 and not <count> >= 42",
+            "<count> == 1 || <query> == 'a&&b||c'",
+            "<missing> == 1 || <count> < 100",
+        ]
+        for source in matches {
+            let condition = try BreakpointCondition(source)
+            let result = await condition.evaluate(context: context)
+            XCTAssertTrue(result, source)
+        }
+
+        let misses = [
+            "<query> == 'a'",
+            "<query> == 'a&&b'",
+            "<count> == '41' && <count> > 41",
+            "<missing> == 1",
+            "<query> > 3",
+        ]
+        for source in misses {
+            let condition = try BreakpointCondition(source)
+            let result = await condition.evaluate(context: context)
+            XCTAssertFalse(result, source)
+        }
+    }
+
+    func testValuesContainingOperatorsAgainstSnapshots() async throws {
+        let symbols = [
+            SymbolSnapshot(name: "query", typeName: "String", valuePreview: "x|y&z"),
+            SymbolSnapshot(name: "flag", typeName: "Boolean", valuePreview: "false"),
+        ]
+        let hit = try BreakpointCondition(#"<query> == "x|y&z" && !<flag>"#)
+        let hitResult = await hit.evaluate(symbols: symbols)
+        XCTAssertTrue(hitResult)
+
+        let miss = try BreakpointCondition("<query> == 'x' || <query> == 'y&z'")
+        let missResult = await miss.evaluate(symbols: symbols)
+        XCTAssertFalse(missResult)
+    }
+
+    func testTruthinessMatchesTheExpressionEvaluator() async throws {
+        let context = RuntimeContext(featureSetName: "Test")
+        context.bind("word", value: "false")
+        context.bind("digit", value: "0")
+        context.bind("empty", value: "")
+        context.bind("off", value: false)
+        context.bind("zero", value: 0)
+
+        for name in ["word", "digit", "empty", "off", "zero"] {
+            let condition = try BreakpointCondition("<\(name)>")
+            let result = await condition.evaluate(context: context)
+            let expected = ExpressionEvaluator().asBool(context.resolveAny(name)!)
+            XCTAssertEqual(result, expected, name)
+        }
+        let word = try await BreakpointCondition("<word>").evaluate(context: context)
+        XCTAssertTrue(word, "a non-empty string is truthy, whatever it says")
+
+        let symbols = [
+            SymbolSnapshot(name: "word", typeName: "String", valuePreview: "false"),
+            SymbolSnapshot(name: "zero", typeName: "Integer", valuePreview: "0"),
+        ]
+        let snapshotWord = try await BreakpointCondition("<word>").evaluate(symbols: symbols)
+        XCTAssertTrue(snapshotWord)
+        let snapshotZero = try await BreakpointCondition("<zero>").evaluate(symbols: symbols)
+        XCTAssertFalse(snapshotZero)
+    }
+
+    // MARK: - Errors
+
+    func testParseErrorsReportTheColumn() {
+        XCTAssertEqual(parseError("   ")?.message, "empty condition")
+        XCTAssertEqual(parseError("<a> = 1")?.column, 5)
+        XCTAssertEqual(parseError(#"<a> == "abc"#)?.column, 8)
+        XCTAssertEqual(parseError("<a> == abc")?.column, 8)
+        XCTAssertEqual(parseError("<a> & <b>")?.column, 5)
+        XCTAssertEqual(parseError("(<a> || <b>")?.message, "expected ')'")
+        XCTAssertEqual(parseError("<a> == 1 ||")?.message, "expected a value")
+        XCTAssertEqual(parseError("<a == 1")?.column, 1)
+        XCTAssertNil(parseError("<a> == 1"))
+    }
+
+    func testControllerRejectsInvalidConditions() async throws {
+        let controller = DebugController(frontend: DebugControllerTests.ScriptedFrontend(modes: [.continue]))
+        do {
+            try await controller.addConditionalBreakpoint(file: "", line: 3, condition: "<a> ==")
+            XCTFail("expected a parse error")
+        } catch is BreakpointConditionError {
+            // expected
+        }
+        let rejected = await controller.listBreakpoints()
+        XCTAssertTrue(rejected.isEmpty)
+
+        try await controller.addConditionalBreakpoint(file: "", line: 3, condition: "<a> == 'b|c'")
+        let added = await controller.listBreakpoints()
+        XCTAssertEqual(added, [.conditionalLocation(file: "", line: 3, predicate: "<a> == 'b|c'")])
+    }
+
+    func testDAPReportsInvalidConditionsOnTheBreakpoint() async throws {
+        let input = Pipe()
+        let output = Pipe()
+        let frontend = DAPFrontend(input: input.fileHandleForReading, output: output.fileHandleForWriting)
+        let controller = DebugController(frontend: frontend)
+        await frontend.attach(controller: controller)
+
+        let request = DAPMessage(
+            seq: 1, kind: .request, name: "setBreakpoints",
+            arguments: [
+                "source": ["name": "users.aro"],
+                "breakpoints": [
+                    ["line": 5],
+                    ["line": 7, "condition": "<user: role> == 'a||b'"],
+                    ["line": 9, "condition": "<user: role> = 'admin'"],
+                ] as [[String: Any]]
+            ]
+        )
+        try input.fileHandleForWriting.write(contentsOf: try request.encode())
+        try input.fileHandleForWriting.close()
+        await frontend.runMessageLoop()
+
+        let response = try XCTUnwrap(DAPReader(handle: output.fileHandleForReading).read())
+        let breakpoints = try XCTUnwrap(response.body?["breakpoints"] as? [[String: Any]])
+        XCTAssertEqual(breakpoints.map { $0["verified"] as? Bool }, [true, true, false])
+        let message = try XCTUnwrap(breakpoints[2]["message"] as? String)
+        XCTAssertTrue(message.contains("column 14"), message)
+
+        let installed = await controller.listBreakpoints()
+        XCTAssertEqual(installed, [
+            .location(file: "users.aro", line: 5),
+            .conditionalLocation(file: "users.aro", line: 7, predicate: "<user: role> == 'a||b'"),
+        ])
+    }
+}
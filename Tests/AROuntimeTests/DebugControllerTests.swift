@@ -298,4 +298,124 @@ final class DebugControllerTests: XCTestCase {
         }
         XCTAssertEqual(breakpointPauses.count, 1, "expected exactly one conditional bp hit on line 3")
     }
+
+    // MARK: - Stop gate
+
+    func testStopGateFollowsBreakpointsAndStepMode() async throws {
+        let result = Compiler().compile("""
+        (Application-Start: Probe) {
+            Log "a" to the <console>.
+            Log "b" to the <console>.
+            Return an <OK: status> for the <application>.
+        }
+        """)
+        XCTAssertTrue(result.isSuccess)
+        let statements = try XCTUnwrap(result.analyzedProgram.featureSets.first).featureSet.statements
+        let controller = DebugController(frontend: ScriptedFrontend(modes: [.continue]))
+        let gate = controller.stopGate
+
+        // The entry pause is pending until the first checkpoint
+        XCTAssertTrue(gate.mayStop(at: statements[1], sourceFile: "probe.aro"))
+        try await controller.checkpoint(
+            statement: statements[0],
+            featureSetName: "Application-Start",
+            businessActivity: "Probe",
+            sourceFile: "probe.aro",
+            symbols: []
+        )
+        XCTAssertFalse(gate.mayStop(at: statements[1], sourceFile: "probe.aro"))
+
+        // Line 3 in files ending in probe.aro only
+        await controller.addBreakpoint(.location(file: "probe.aro", line: 3))
+        XCTAssertTrue(gate.mayStop(at: statements[1], sourceFile: "/srv/app/probe.aro"))
+        XCTAssertFalse(gate.mayStop(at: statements[1], sourceFile: "/srv/app/other.aro"))
+        XCTAssertFalse(gate.mayStop(at: statements[0], sourceFile: "/srv/app/probe.aro"))
+
+        await controller.addBreakpoint(.conditionalLocation(file: "", line: 2, predicate: "<x> == 1"))
+        XCTAssertTrue(gate.mayStop(at: statements[0], sourceFile: "/srv/app/other.aro"))
+
+        await controller.addBreakpoint(.verb("Return"))
+        XCTAssertTrue(gate.mayStop(at: statements[2], sourceFile: ""))
+
+        await controller.clearBreakpoints()
+        for statement in statements {
+            XCTAssertFalse(gate.mayStop(at: statement, sourceFile: "/srv/app/probe.aro"))
+        }
+    }
+
+    // MARK: - Idle debugger overhead (benchmark)
+    //
+    // The same loop-heavy feature set detached, attached with nothing to
+    // stop at, and attached with a breakpoint in another file. The three
+    // should measure within a few percent of each other.
+
+    private static let idleBenchmarkSource = """
+    (Idle Benchmark: Debugging) {
+        Create the <items> with [1, 2, 3, 4, 5, 6, 7, 8, 9, 10].
+        Compute the <i> from 0.
+        while <i> < 1000 {
+            Compute the <i> from <i> + 1.
+        }
+        for <n> from 0 to 100 {
+            for each <item> in <items> {
+                Compute the <product> from <n> * <item>.
+            }
+        }
+        Return an <OK: status> with <i>.
+    }
+    """
+
+    private static func runIdleBenchmark(_ analyzed: AnalyzedFeatureSet, controller: DebugController?) async throws {
+        let eventBus = EventBus()
+        let context = RuntimeContext(
+            featureSetName: analyzed.featureSet.name,
+            businessActivity: analyzed.featureSet.businessActivity,
+            eventBus: eventBus
+        )
+        let executor = FeatureSetExecutor(
+            actionRegistry: .shared,
+            eventBus: eventBus,
+            globalSymbols: GlobalSymbolStorage()
+        )
+        try await Debug.$controller.withValue(controller) {
+            try await Debug.$currentSourceFile.withValue("/srv/app/idle.aro") {
+                _ = try await executor.execute(analyzed, context: context)
+            }
+        }
+    }
+
+    private func measureIdle(_ controller: DebugController?) throws {
+        let result = Compiler().compile(Self.idleBenchmarkSource)
+        XCTAssertTrue(result.isSuccess)
+        let analyzed = try XCTUnwrap(result.analyzedProgram.featureSets.first)
+        measure {
+            runBlocking { try? await Self.runIdleBenchmark(analyzed, controller: controller) }
+        }
+    }
+
+    /// Run `body` to completion from a synchronous test, so `measure`
+    /// never nests inside an async test
+    private func runBlocking(_ body: @escaping @Sendable () async -> Void) {
+        let done = expectation(description: "async work")
+        Task {
+            await body()
+            done.fulfill()
+        }
+        wait(for: [done], timeout: 60)
+    }
+
+    func testBenchmarkWithoutDebugger() throws {
+        try measureIdle(nil)
+    }
+
+    func testBenchmarkIdleDebugger() throws {
+        // Continue from the entry pause; nothing stops after that
+        try measureIdle(DebugController(frontend: ScriptedFrontend(modes: [.continue])))
+    }
+
+    func testBenchmarkIdleDebuggerWithBreakpointElsewhere() throws {
+        let controller = DebugController(frontend: ScriptedFrontend(modes: [.continue]))
+        runBlocking { await controller.addBreakpoint(.location(file: "other.aro", line: 5)) }
+        try measureIdle(controller)
+    }
 }
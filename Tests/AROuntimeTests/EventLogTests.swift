@@ -0,0 +1,181 @@
+// ============================================================
+// EventLogTests.swift
+// ARO Runtime - Binary event log write/read/seek tests
+// ============================================================
+
+import Foundation
+import Testing
+@testable import ARORuntime
+
+@Suite("Event Log Tests")
+struct EventLogTests {
+
+    private func temporaryLogPath() -> String {
+        NSTemporaryDirectory() + "aro-eventlog-\(UUID().uuidString).\(EventLogFormat.fileExtension)"
+    }
+
+    private func cleanup(_ path: String) {
+        try? FileManager.default.removeItem(atPath: path)
+        try? FileManager.default.removeItem(atPath: path + ".idx")
+    }
+
+    @Test("Records round-trip through the binary format")
+    func testRoundTrip() throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+
+        let writer = try EventLogWriter(path: path, applicationName: "Order Service")
+        writer.append(FeatureSetStartedEvent(featureSetName: "placeOrder", businessActivity: "Orders", executionId: "e1"))
+        writer.append(HTTPResponseSentEvent(requestId: "r1", statusCode: 201, durationMs: 1.5))
+        writer.append(ApplicationStartedEvent(applicationName: "reflected"))
+        writer.close()
+
+        let reader = try EventLogReader(path: path)
+        let records = Array(reader.records())
+
+        #expect(reader.applicationName == "Order Service")
+        #expect(records.count == 3)
+        #expect(records.map(\.sequence) == [0, 1, 2])
+        #expect(records[0].eventType == "featureset.started")
+        #expect(records[0].fields.first { $0.key == "featureSetName" }?.value == "placeOrder")
+        #expect(records[1].fields.first { $0.key == "statusCode" }?.value == "201")
+        // Events without a RecordableEvent conformance fall back to reflection
+        #expect(records[2].fields.first { $0.key == "applicationName" }?.value == "reflected")
+    }
+
+    @Test("Seeking by sequence and time uses the sparse index")
+    func testSeek() throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+
+        let base = Date(timeIntervalSince1970: 1_800_000_000)
+        let writer = try EventLogWriter(path: path, flushThreshold: 512)
+        for i in 0..<1_000 {
+            writer.append(eventType: "tick", timestamp: base.addingTimeInterval(Double(i)), fields: [("i", String(i))])
+        }
+        writer.close()
+
+        let reader = try EventLogReader(path: path)
+        #expect(reader.index.count == (1_000 + EventLogFormat.indexStride - 1) / EventLogFormat.indexStride)
+
+        let bySequence = reader.records(from: reader.seek(toSequence: 700)).first { _ in true }
+        #expect(bySequence?.sequence == 700)
+
+        let byTime = reader.records(from: reader.seek(toTime: base.addingTimeInterval(512.5))).first { _ in true }
+        #expect(byTime?.sequence == 513)
+
+        #expect(reader.records(from: reader.seek(toSequence: 5_000)).first { _ in true } == nil)
+    }
+
+    @Test("A missing index is rebuilt and a torn tail record is ignored")
+    func testRecoveryFromPartialFiles() throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+
+        let writer = try EventLogWriter(path: path)
+        for i in 0..<300 {
+            writer.append(eventType: "tick", timestamp: Date(), fields: [("i", String(i))])
+        }
+        writer.close()
+
+        try FileManager.default.removeItem(atPath: path + ".idx")
+        let handle = try #require(FileHandle(forWritingAtPath: path))
+        handle.seekToEndOfFile()
+        // Length prefix promising more bytes than the file holds
+        handle.write(Data([0xFF, 0x00, 0x00, 0x00, 0x01, 0x02]))
+        handle.closeFile()
+
+        let reader = try EventLogReader(path: path)
+        #expect(reader.index.count == 2)
+        #expect(Array(reader.records()).count == 300)
+        #expect(reader.records(from: reader.seek(toSequence: 299)).first { _ in true }?.sequence == 299)
+    }
+
+    @Test("EventReplayer loads binary logs into an EventRecording")
+    func testReplayerLoadsBinaryLog() async throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+
+        let writer = try EventLogWriter(path: path, applicationName: "App")
+        writer.append(eventType: "domain", timestamp: Date(), fields: [("domainEventType", "UserCreated")])
+        writer.close()
+
+        let recording = try await EventReplayer().loadFromFile(path)
+        #expect(recording.application == "App")
+        #expect(recording.events.count == 1)
+        #expect(recording.events[0].payload == #"{"domainEventType":"UserCreated"}"#)
+    }
+
+    @Test("An idle writer flushes staged records on its own")
+    func testIdleFlush() async throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+
+        let writer = try EventLogWriter(path: path, flushInterval: 0.05)
+        defer { writer.close() }
+        writer.append(eventType: "tick", timestamp: Date(), fields: [("i", "0")])
+
+        var records = 0
+        for _ in 0..<200 where records == 0 {
+            try await Task.sleep(nanoseconds: 10_000_000)
+            records = Array(try EventLogReader(path: path).records()).count
+        }
+        #expect(records == 1)
+    }
+
+    @Test("Out-of-order timestamps are clamped so seeking by time stays exact")
+    func testNonMonotonicTimestamps() throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+
+        let base = Date(timeIntervalSince1970: 1_800_000_000)
+        let writer = try EventLogWriter(path: path, flushThreshold: 512)
+        for i in 0..<1_000 {
+            // Every 7th event arrives late, stamped 30 s in the past
+            let offset = i % 7 == 3 ? Double(i) - 30 : Double(i)
+            writer.append(eventType: "tick", timestamp: base.addingTimeInterval(offset), fields: [("i", String(i))])
+        }
+        writer.close()
+
+        let reader = try EventLogReader(path: path)
+        let records = Array(reader.records())
+        #expect(records.count == 1_000)
+        #expect(zip(records, records.dropFirst()).allSatisfy { $0.timestamp <= $1.timestamp })
+
+        for seconds in stride(from: -40.0, through: 1_010, by: 13.5) {
+            let target = base.addingTimeInterval(seconds)
+            let expected = records.first { $0.timestamp >= target }?.sequence
+            let found = reader.records(from: reader.seek(toTime: target)).first { _ in true }?.sequence
+            #expect(found == expected, "seek to \(seconds) s")
+        }
+    }
+
+    @Test("Fast replay of a binary log starts at the requested time")
+    func testReplayFastFromTime() async throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+
+        let base = Date(timeIntervalSince1970: 1_800_000_000)
+        let writer = try EventLogWriter(path: path)
+        for i in 0..<600 {
+            writer.append(eventType: "tick", timestamp: base.addingTimeInterval(Double(i)), fields: [("i", String(i))])
+        }
+        writer.close()
+
+        let log = try EventLogReader(path: path)
+        let replayer = EventReplayer(eventBus: EventBus())
+        #expect(await replayer.replayFast(log) == 600)
+        #expect(await replayer.replayFast(log, from: base.addingTimeInterval(450)) == 150)
+    }
+
+    @Test("Non-log files are rejected")
+    func testRejectsForeignFiles() throws {
+        let path = temporaryLogPath()
+        defer { cleanup(path) }
+        try Data("{\"events\": []}".utf8).write(to: URL(fileURLWithPath: path))
+
+        #expect(throws: EventLogError.self) {
+            _ = try EventLogReader(path: path)
+        }
+    }
+}
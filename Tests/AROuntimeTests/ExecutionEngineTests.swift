@@ -51,9 +51,9 @@ struct GlobalSymbolStorageTests {
     func testPublishAndResolve() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "user", value: "John", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
+        storage.publish(name: "user", value: "John", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
 
-        let value: String? = await storage.resolve("user", forBusinessActivity: "Activity1")
+        let value: String? = storage.resolve("user", forBusinessActivity: "Activity1")
         #expect(value == "John")
     }
 
@@ -61,9 +61,9 @@ struct GlobalSymbolStorageTests {
     func testBusinessActivityIsolation() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "user", value: "John", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
+        storage.publish(name: "user", value: "John", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
 
-        let value: String? = await storage.resolve("user", forBusinessActivity: "Activity2")
+        let value: String? = storage.resolve("user", forBusinessActivity: "Activity2")
         #expect(value == nil)
     }
 
@@ -71,9 +71,9 @@ struct GlobalSymbolStorageTests {
     func testEmptyBusinessActivityAccessible() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "config", value: "value", fromFeatureSet: "Framework", businessActivity: "", executionId: "exec-test")
+        storage.publish(name: "config", value: "value", fromFeatureSet: "Framework", businessActivity: "", executionId: "exec-test")
 
-        let value: String? = await storage.resolve("config", forBusinessActivity: "AnyActivity")
+        let value: String? = storage.resolve("config", forBusinessActivity: "AnyActivity")
         #expect(value == "value")
     }
 
@@ -81,9 +81,9 @@ struct GlobalSymbolStorageTests {
     func testResolveAny() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "count", value: 42, fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
+        storage.publish(name: "count", value: 42, fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
 
-        let value = await storage.resolveAny("count", forBusinessActivity: "Activity1")
+        let value = storage.resolveAny("count", forBusinessActivity: "Activity1")
         #expect(value != nil)
         #expect(value as? Int == 42)
     }
@@ -92,10 +92,10 @@ struct GlobalSymbolStorageTests {
     func testIsPublished() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "item", value: "data", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
+        storage.publish(name: "item", value: "data", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
 
-        let isPublished1 = await storage.isPublished("item", forBusinessActivity: "Activity1")
-        let isPublished2 = await storage.isPublished("other", forBusinessActivity: "Activity1")
+        let isPublished1 = storage.isPublished("item", forBusinessActivity: "Activity1")
+        let isPublished2 = storage.isPublished("other", forBusinessActivity: "Activity1")
         #expect(isPublished1 == true)
         #expect(isPublished2 == false)
     }
@@ -104,10 +104,10 @@ struct GlobalSymbolStorageTests {
     func testSourceFeatureSet() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "data", value: "test", fromFeatureSet: "SourceFS", businessActivity: "Activity", executionId: "exec-test")
+        storage.publish(name: "data", value: "test", fromFeatureSet: "SourceFS", businessActivity: "Activity", executionId: "exec-test")
 
-        let sourceFS1 = await storage.sourceFeatureSet(for: "data")
-        let sourceFS2 = await storage.sourceFeatureSet(for: "unknown")
+        let sourceFS1 = storage.sourceFeatureSet(for: "data")
+        let sourceFS2 = storage.sourceFeatureSet(for: "unknown")
         #expect(sourceFS1 == "SourceFS")
         #expect(sourceFS2 == nil)
     }
@@ -116,10 +116,10 @@ struct GlobalSymbolStorageTests {
     func testBusinessActivityTracking() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "config", value: "test", fromFeatureSet: "FS", businessActivity: "MyActivity", executionId: "exec-test")
+        storage.publish(name: "config", value: "test", fromFeatureSet: "FS", businessActivity: "MyActivity", executionId: "exec-test")
 
-        let activity1 = await storage.businessActivity(for: "config")
-        let activity2 = await storage.businessActivity(for: "unknown")
+        let activity1 = storage.businessActivity(for: "config")
+        let activity2 = storage.businessActivity(for: "unknown")
         #expect(activity1 == "MyActivity")
         #expect(activity2 == nil)
     }
@@ -128,11 +128,11 @@ struct GlobalSymbolStorageTests {
     func testIsAccessDenied() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "private", value: "secret", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
+        storage.publish(name: "private", value: "secret", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
 
-        let denied1 = await storage.isAccessDenied("private", forBusinessActivity: "Activity2")
-        let denied2 = await storage.isAccessDenied("private", forBusinessActivity: "Activity1")
-        let denied3 = await storage.isAccessDenied("nonexistent", forBusinessActivity: "Activity1")
+        let denied1 = storage.isAccessDenied("private", forBusinessActivity: "Activity2")
+        let denied2 = storage.isAccessDenied("private", forBusinessActivity: "Activity1")
+        let denied3 = storage.isAccessDenied("nonexistent", forBusinessActivity: "Activity1")
         #expect(denied1 == true)
         #expect(denied2 == false)
         #expect(denied3 == false)
@@ -142,11 +142,11 @@ struct GlobalSymbolStorageTests {
     func testSymbolOverwriting() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "counter", value: 1, fromFeatureSet: "FS1", businessActivity: "Activity", executionId: "exec-test")
-        await storage.publish(name: "counter", value: 2, fromFeatureSet: "FS2", businessActivity: "Activity", executionId: "exec-test")
+        storage.publish(name: "counter", value: 1, fromFeatureSet: "FS1", businessActivity: "Activity", executionId: "exec-test")
+        storage.publish(name: "counter", value: 2, fromFeatureSet: "FS2", businessActivity: "Activity", executionId: "exec-test")
 
-        let value: Int? = await storage.resolve("counter", forBusinessActivity: "Activity")
-        let sourceFS = await storage.sourceFeatureSet(for: "counter")
+        let value: Int? = storage.resolve("counter", forBusinessActivity: "Activity")
+        let sourceFS = storage.sourceFeatureSet(for: "counter")
         #expect(value == 2)
         #expect(sourceFS == "FS2")
     }
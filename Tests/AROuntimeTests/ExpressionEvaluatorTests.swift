@@ -239,3 +239,135 @@ struct ContainsOperatorTests {
         #expect(hit == false)
     }
 }
+
+// MARK: - Pure Fast Path Tests
+
+/// Differential tests for the synchronous fast path: every case runs
+/// through the default evaluator and through one with the fast path
+/// switched off, and the results (value and type) or error messages must
+/// match. The table covers the operator behaviour exercised above plus
+/// arithmetic, comparison, access and error cases.
+@Suite("Pure Expression Fast Path Tests")
+struct PureExpressionFastPathTests {
+
+    private static let span = SourceSpan(at: SourceLocation())
+
+    private static func lit(_ value: LiteralValue) -> any AROParser.Expression {
+        LiteralExpression(value: value, span: span)
+    }
+
+    private static func ref(_ name: String, _ annotation: String? = nil) -> any AROParser.Expression {
+        VariableRefExpression(noun: QualifiedNoun(base: name, typeAnnotation: annotation, span: span), span: span)
+    }
+
+    private static func bin(_ left: any AROParser.Expression, _ op: BinaryOperator, _ right: any AROParser.Expression) -> any AROParser.Expression {
+        BinaryExpression(left: left, op: op, right: right, span: span)
+    }
+
+    private static func int(_ i: Int) -> any AROParser.Expression { lit(.integer(i)) }
+    private static func float(_ d: Double) -> any AROParser.Expression { lit(.float(d)) }
+    private static func str(_ s: String) -> any AROParser.Expression { lit(.string(s)) }
+
+    private static let cases: [(String, any AROParser.Expression)] = [
+        // Arithmetic
+        ("int add", bin(int(1), .add, int(2))),
+        ("int subtract", bin(int(7), .subtract, int(10))),
+        ("int multiply", bin(ref("n"), .multiply, int(6))),
+        ("int floor division", bin(int(7), .divide, int(2))),
+        ("division by zero", bin(int(1), .divide, int(0))),
+        ("double division", bin(float(7), .divide, float(2))),
+        ("double division by zero", bin(float(1), .divide, float(0))),
+        ("modulo", bin(int(7), .modulo, int(3))),
+        ("double modulo", bin(float(7), .modulo, float(3))),
+        ("mixed add", bin(float(1.5), .add, int(2))),
+        ("numeric string add", bin(str("2.5"), .add, int(1))),
+        ("large int add", bin(int(1 << 60), .add, int(1))),
+        ("string repetition", bin(str("ab"), .multiply, int(3))),
+        ("non-numeric subtract", bin(str("a"), .subtract, int(1))),
+        ("concat", bin(str("x"), .concat, int(1))),
+        // Comparison and logic
+        ("int less than", bin(ref("n"), .lessThan, int(8))),
+        ("large int compare", bin(int((1 << 60) + 1), .greaterThan, int(1 << 60))),
+        ("double greater equal", bin(float(2.5), .greaterEqual, float(2.5))),
+        ("int equals double", bin(int(2), .equal, float(2))),
+        ("string equality", bin(str("a"), .notEqual, str("b"))),
+        ("date compare", bin(str("2024-01-01"), .lessThan, str("2024-02-01"))),
+        ("non-numeric compare", bin(str("a"), .lessThan, int(1))),
+        ("and", bin(lit(.boolean(true)), .and, int(0))),
+        ("or", bin(str("x"), .or, lit(.boolean(false)))),
+        ("not", UnaryExpression(op: .not, operand: str(""), span: span)),
+        ("negate", UnaryExpression(op: .negate, operand: ref("n"), span: span)),
+        ("negate string", UnaryExpression(op: .negate, operand: str("x"), span: span)),
+        // Collections
+        ("string contains", bin(ref("url"), .contains, str("mastodon.social"))),
+        ("string contains empty", bin(ref("url"), .contains, str(""))),
+        ("list contains", bin(ref("roles"), .contains, str("admin"))),
+        ("list contains substring", bin(ref("roles"), .contains, str("adm"))),
+        ("map contains key", bin(ref("user"), .contains, str("name"))),
+        ("int contains", bin(ref("n"), .contains, str("7"))),
+        ("matches", bin(str("Hello"), .matches, lit(.regex(pattern: "^h", flags: "i")))),
+        ("array literal", ArrayLiteralExpression(elements: [int(1), bin(ref("n"), .add, int(1))], span: span)),
+        ("map literal", MapLiteralExpression(entries: [MapEntry(key: "k", value: ref("n"), span: span)], span: span)),
+        // Access
+        ("member", MemberAccessExpression(base: ref("user"), member: "name", span: span)),
+        ("missing member", MemberAccessExpression(base: ref("user"), member: "email", span: span)),
+        ("member on int", MemberAccessExpression(base: ref("n"), member: "name", span: span)),
+        ("subscript", SubscriptExpression(base: ref("roles"), index: int(0), span: span)),
+        ("subscript out of bounds", SubscriptExpression(base: ref("roles"), index: int(5), span: span)),
+        ("undefined variable", bin(ref("missing"), .add, int(1))),
+        ("grouped", GroupedExpression(expression: bin(int(1), .add, int(2)), span: span)),
+        ("exists", ExistenceExpression(expression: ref("missing"), span: span)),
+        ("exists failing member", ExistenceExpression(
+            expression: MemberAccessExpression(base: ref("user"), member: "email", span: span), span: span
+        )),
+        ("type check", TypeCheckExpression(expression: ref("n"), typeName: "number", hasArticle: true, span: span)),
+        ("interpolation", InterpolatedStringExpression(
+            parts: [.literal("n = "), .interpolation(bin(ref("n"), .multiply, float(0.5)))], span: span
+        ))
+    ]
+
+    private func context() -> RuntimeContext {
+        let context = RuntimeContext(featureSetName: "Test")
+        context.bind("n", value: 7)
+        context.bind("url", value: "https://mastodon.social/@user")
+        context.bind("roles", value: ["admin", "user"] as [any Sendable])
+        context.bind("user", value: ["name": "kris", "age": 40] as [String: any Sendable])
+        return context
+    }
+
+    private func outcome(_ evaluator: ExpressionEvaluator, _ expression: any AROParser.Expression) async -> String {
+        do {
+            let value = try await evaluator.evaluate(expression, context: context())
+            return "\(type(of: value)): \(value)"
+        } catch {
+            return "error: \(error)"
+        }
+    }
+
+    @Test("Fast path matches the async evaluator")
+    func testDifferential() async {
+        let fast = ExpressionEvaluator()
+        let reference = ExpressionEvaluator(usesPureFastPath: false)
+        for (name, expression) in Self.cases {
+            #expect(ExpressionEvaluator.isPure(expression), "\(name) should be pure")
+            let expected = await outcome(reference, expression)
+            let actual = await outcome(fast, expression)
+            #expect(actual == expected, "\(name)")
+        }
+    }
+
+    @Test("Specifiers make a reference impure")
+    func testImpureReferences() {
+        #expect(!ExpressionEvaluator.isPure(Self.ref("user", "name")))
+        #expect(!ExpressionEvaluator.isPure(Self.ref("order-repository", "count")))
+        #expect(!ExpressionEvaluator.isPure(Self.bin(Self.int(1), .add, Self.ref("env", "HOME"))))
+        #expect(ExpressionEvaluator.isPure(Self.bin(Self.ref("a"), .add, Self.int(1))))
+    }
+
+    @Test("Impure trees still evaluate through the async path")
+    func testImpureTreeEvaluates() async throws {
+        let expression = Self.bin(Self.ref("user", "age"), .add, Self.int(1))
+        let value = try await ExpressionEvaluator().evaluate(expression, context: context())
+        #expect(value as? Int == 41)
+    }
+}
@@ -50,14 +50,14 @@ struct GlobalSymbolStorageIntegrationTests {
         let storage = GlobalSymbolStorage()
 
         // Publish in Activity1
-        await storage.publish(name: "config", value: "value1", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
+        storage.publish(name: "config", value: "value1", fromFeatureSet: "FS1", businessActivity: "Activity1", executionId: "exec-test")
 
         // Should resolve in same activity
-        let value1: String? = await storage.resolve("config", forBusinessActivity: "Activity1")
+        let value1: String? = storage.resolve("config", forBusinessActivity: "Activity1")
         #expect(value1 == "value1")
 
         // Should NOT resolve in different activity
-        let value2: String? = await storage.resolve("config", forBusinessActivity: "Activity2")
+        let value2: String? = storage.resolve("config", forBusinessActivity: "Activity2")
         #expect(value2 == nil)
     }
 
@@ -66,11 +66,11 @@ struct GlobalSymbolStorageIntegrationTests {
         let storage = GlobalSymbolStorage()
 
         // Publish with empty business activity (framework-level)
-        await storage.publish(name: "global", value: "accessible", fromFeatureSet: "Framework", businessActivity: "", executionId: "exec-test")
+        storage.publish(name: "global", value: "accessible", fromFeatureSet: "Framework", businessActivity: "", executionId: "exec-test")
 
         // Should be accessible from any activity
-        let value1: String? = await storage.resolve("global", forBusinessActivity: "Activity1")
-        let value2: String? = await storage.resolve("global", forBusinessActivity: "Activity2")
+        let value1: String? = storage.resolve("global", forBusinessActivity: "Activity1")
+        let value2: String? = storage.resolve("global", forBusinessActivity: "Activity2")
 
         #expect(value1 == "accessible")
         #expect(value2 == "accessible")
@@ -86,13 +86,13 @@ struct PublishStatementExecutorTests {
     func testPublishToGlobalSymbols() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "exported", value: "test value", fromFeatureSet: "TestFS", businessActivity: "TestActivity", executionId: "exec-test")
+        storage.publish(name: "exported", value: "test value", fromFeatureSet: "TestFS", businessActivity: "TestActivity", executionId: "exec-test")
 
-        let value: String? = await storage.resolve("exported", forBusinessActivity: "TestActivity")
+        let value: String? = storage.resolve("exported", forBusinessActivity: "TestActivity")
         #expect(value == "test value")
 
-        let sourceFS = await storage.sourceFeatureSet(for: "exported")
-        let activity = await storage.businessActivity(for: "exported")
+        let sourceFS = storage.sourceFeatureSet(for: "exported")
+        let activity = storage.businessActivity(for: "exported")
         #expect(sourceFS == "TestFS")
         #expect(activity == "TestActivity")
     }
@@ -125,3 +125,231 @@ struct ShutdownCoordinatorTests {
     // Note: We don't test signalShutdown() on the shared coordinator because
     // it interferes with the test framework's parallel execution, causing hangs.
 }
+
+// MARK: - Parallel Statement Tests
+
+/// Counters shared by the probe service and the tests
+private final class ParallelProbeState: @unchecked Sendable {
+    private let lock = NSLock()
+    private var inFlight = 0
+    private var peak = 0
+    private var finished = 0
+    private var cancelled = 0
+    private var recorded: [String] = []
+
+    func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+        (inFlight, peak, finished, cancelled) = (0, 0, 0, 0)
+        recorded = []
+    }
+
+    func begin() {
+        lock.lock()
+        defer { lock.unlock() }
+        inFlight += 1
+        peak = max(peak, inFlight)
+    }
+
+    func end() {
+        lock.lock()
+        defer { lock.unlock() }
+        inFlight -= 1
+        finished += 1
+    }
+
+    func markCancelled() {
+        lock.lock()
+        defer { lock.unlock() }
+        cancelled += 1
+    }
+
+    func record(_ value: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        recorded.append(value)
+    }
+
+    var records: [String] {
+        lock.lock()
+        defer { lock.unlock() }
+        return recorded
+    }
+
+    var snapshot: (peak: Int, finished: Int, cancelled: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+        return (peak, finished, cancelled)
+    }
+
+    /// Poll until `condition` holds, for at most five seconds
+    func wait(until condition: ((peak: Int, finished: Int, cancelled: Int)) -> Bool) async {
+        for _ in 0..<5_000 where !condition(snapshot) {
+            try? await Task.sleep(nanoseconds: 1_000_000)
+        }
+    }
+}
+
+/// `value` returns its `value` argument once `together` calls are in
+/// flight, after `delay` milliseconds. `explode` throws once a `value`
+/// call has finished, and `stall` sleeps until it is cancelled. `record`
+/// is the one method with a side effect: it appends its `value` to the
+/// state's records after `delay` milliseconds.
+private struct ParallelProbeService: AROService {
+    static let name = "parallel-probe"
+    static let readOnlyMethods: Set<String> = ["value", "explode", "stall"]
+    static let state = ParallelProbeState()
+
+    struct Explosion: LocalizedError {
+        var errorDescription: String? { "probe exploded" }
+    }
+
+    init() {}
+
+    func call(_ method: String, args: [String: any Sendable]) async throws -> any Sendable {
+        let state = Self.state
+        switch method {
+        case "value":
+            state.begin()
+            defer { state.end() }
+            let together = args["together"] as? Int ?? 1
+            await state.wait { $0.peak >= together }
+            try await Task.sleep(nanoseconds: UInt64(args["delay"] as? Int ?? 0) * 1_000_000)
+            return args["value"] ?? ""
+        case "explode":
+            await state.wait { $0.finished >= 1 }
+            throw Explosion()
+        case "stall":
+            do {
+                try await Task.sleep(nanoseconds: 30_000_000_000)
+            } catch {
+                state.markCancelled()
+                throw error
+            }
+            return "stalled"
+        case "record":
+            state.begin()
+            defer { state.end() }
+            try await Task.sleep(nanoseconds: UInt64(args["delay"] as? Int ?? 0) * 1_000_000)
+            let value = args["value"] as? String ?? ""
+            state.record(value)
+            return value
+        default:
+            throw ServiceError.unknownMethod(method, service: Self.name)
+        }
+    }
+}
+
+@Suite("Parallel Statement Tests", .serialized)
+struct ParallelStatementTests {
+
+    private func run(_ source: String) async throws -> (Result<Response, Error>, RuntimeContext) {
+        try ExternalServiceRegistry.shared.register(ParallelProbeService())
+        ParallelProbeService.state.reset()
+
+        let result = Compiler().compile(source)
+        #expect(result.isSuccess, "\(result.diagnostics.map(\.message))")
+        let analyzed = try #require(result.analyzedProgram.featureSets.first)
+        let eventBus = EventBus()
+        let context = RuntimeContext(
+            featureSetName: analyzed.featureSet.name,
+            businessActivity: analyzed.featureSet.businessActivity,
+            eventBus: eventBus,
+            container: RuntimeContainer(eventBus: eventBus)
+        )
+        let executor = FeatureSetExecutor(
+            actionRegistry: .shared,
+            eventBus: eventBus,
+            globalSymbols: GlobalSymbolStorage(),
+            parallelizesStatements: true
+        )
+        do {
+            return (.success(try await executor.execute(analyzed, context: context)), context)
+        } catch {
+            return (.failure(error), context)
+        }
+    }
+
+    @Test("Outputs are bound by statement, whatever order the batch finishes in")
+    func resultOrdering() async throws {
+        let (result, context) = try await run("""
+        (Fan Out: Parallel) {
+            Call the <a> from the <parallel-probe: value> with { value: "A", together: 3, delay: 30 }.
+            Call the <b> from the <parallel-probe: value> with { value: "B", together: 3, delay: 15 }.
+            Call the <c> from the <parallel-probe: value> with { value: "C", together: 3, delay: 0 }.
+            Return an <OK: status> for the <fan-out>.
+        }
+        """)
+
+        _ = try result.get()
+        #expect(ParallelProbeService.state.snapshot.peak == 3)
+        #expect(context.resolveAny("a") as? String == "A")
+        #expect(context.resolveAny("b") as? String == "B")
+        #expect(context.resolveAny("c") as? String == "C")
+    }
+
+    @Test("The first failure is rethrown and cancels the rest of the batch")
+    func firstFailureRethrown() async throws {
+        let start = Date()
+        let (result, context) = try await run("""
+        (Fail Fast: Parallel) {
+            Call the <a> from the <parallel-probe: value> with { value: "A" }.
+            Call the <exploded> from the <parallel-probe: explode> with { value: "B" }.
+            Call the <stalled> from the <parallel-probe: stall> with { value: "C" }.
+            Return an <OK: status> for the <fail-fast>.
+        }
+        """)
+
+        let error = try #require(result.failure)
+        #expect("\(error)".contains("explode"), "\(error)")
+        #expect(!"\(error)".contains("stall"), "\(error)")
+        #expect(Date().timeIntervalSince(start) < 10, "the stalled call should have been cancelled")
+        #expect(ParallelProbeService.state.snapshot.cancelled == 1)
+        // Completed before the failure, so still bound
+        #expect(context.resolveAny("a") as? String == "A")
+        #expect(context.resolveAny("stalled") == nil)
+    }
+
+    @Test("A side effect between calls is a barrier")
+    func barrierStatements() async throws {
+        let (result, context) = try await run("""
+        (In Order: Parallel) {
+            Call the <a> from the <parallel-probe: value> with { value: "A", delay: 10 }.
+            Log "between" to the <console>.
+            Call the <b> from the <parallel-probe: value> with { value: "B" }.
+            Return an <OK: status> for the <in-order>.
+        }
+        """)
+
+        _ = try result.get()
+        #expect(ParallelProbeService.state.snapshot.peak == 1)
+        #expect(context.resolveAny("a") as? String == "A")
+        #expect(context.resolveAny("b") as? String == "B")
+    }
+
+    @Test("Calls to methods with side effects keep their order")
+    func sideEffectCallsKeepOrder() async throws {
+        let (result, context) = try await run("""
+        (Record: Parallel) {
+            Call the <first> from the <parallel-probe: record> with { value: "A", delay: 30 }.
+            Call the <second> from the <parallel-probe: record> with { value: "B", delay: 0 }.
+            Call the <c> from the <parallel-probe: value> with { value: "C" }.
+            Return an <OK: status> for the <record>.
+        }
+        """)
+
+        _ = try result.get()
+        #expect(ParallelProbeService.state.records == ["A", "B"])
+        #expect(ParallelProbeService.state.snapshot.peak == 1)
+        #expect(context.resolveAny("first") as? String == "A")
+        #expect(context.resolveAny("second") as? String == "B")
+        #expect(context.resolveAny("c") as? String == "C")
+    }
+}
+
+private extension Result {
+    var failure: Failure? {
+        if case .failure(let error) = self { return error }
+        return nil
+    }
+}
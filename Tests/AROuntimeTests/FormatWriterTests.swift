@@ -0,0 +1,250 @@
+// ============================================================
+// FormatWriterTests.swift
+// ARO Runtime - Streaming format writers
+// ============================================================
+//
+// Each writer's file must match FormatSerializer's output for the same
+// records byte for byte. The benchmark streams a million rows to disk
+// and reports how far peak RSS grew while doing so; it runs only with
+// ARO_BENCHMARKS set (BenchmarkGate).
+
+import XCTest
+@testable import ARORuntime
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+final class FormatWriterTests: XCTestCase {
+
+    private var directory: URL!
+
+    override func setUpWithError() throws {
+        directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("format-writer-\(UUID())")
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: directory)
+    }
+
+    private let rows: [any Sendable] = [
+        ["id": 1, "name": "Ann", "score": 9.5, "active": true] as [String: any Sendable],
+        ["id": 2, "name": "O'Brien, \"Bob\"", "score": 7.25, "active": false] as [String: any Sendable],
+        ["id": 3, "name": "multi\nline", "tags": ["a", "b"] as [any Sendable]] as [String: any Sendable],
+        ["id": 4, "name": "nested", "address": ["city": "Berlin", "zip": "10115"] as [String: any Sendable]] as [String: any Sendable],
+    ]
+
+    /// Write `records` with the streaming writer and return the file
+    private func written(
+        _ records: [any Sendable],
+        format: FileFormat,
+        file: String,
+        options: [String: any Sendable] = [:],
+        append: Bool = false
+    ) async throws -> String {
+        let path = directory.appendingPathComponent(file).path
+        try await FormatSerializer.write(
+            AROStream.from(records), to: path, format: format,
+            variableName: "items", options: options, append: append
+        )
+        return try String(contentsOfFile: path, encoding: .utf8)
+    }
+
+    private func serialized(_ records: [any Sendable], format: FileFormat, options: [String: any Sendable] = [:]) -> String {
+        FormatSerializer.serialize(records, format: format, variableName: "items", options: options)
+    }
+
+    // MARK: - Byte-for-byte Equivalence
+
+    func testCSVMatchesSerializer() async throws {
+        let output = try await written(rows, format: .csv, file: "rows.csv")
+        XCTAssertEqual(output, serialized(rows, format: .csv))
+    }
+
+    func testCSVOptionsMatchSerializer() async throws {
+        let options: [String: any Sendable] = ["delimiter": ";", "header": false, "quote": "'"]
+        let output = try await written(rows, format: .csv, file: "rows.csv", options: options)
+        XCTAssertEqual(output, serialized(rows, format: .csv, options: options))
+    }
+
+    func testTSVMatchesSerializer() async throws {
+        let output = try await written(rows, format: .tsv, file: "rows.tsv")
+        XCTAssertEqual(output, serialized(rows, format: .tsv))
+    }
+
+    func testSingleColumnCSVMatchesSerializer() async throws {
+        let values: [any Sendable] = ["plain", "with,comma", 42, 2.5]
+        let output = try await written(values, format: .csv, file: "values.csv")
+        XCTAssertEqual(output, serialized(values, format: .csv))
+    }
+
+    func testJSONLMatchesSerializer() async throws {
+        let output = try await written(rows, format: .jsonl, file: "rows.jsonl")
+        XCTAssertEqual(output, serialized(rows, format: .jsonl))
+    }
+
+    func testJSONArrayMatchesSerializer() async throws {
+        let output = try await written(rows, format: .json, file: "rows.json")
+        XCTAssertEqual(output, serialized(rows, format: .json))
+    }
+
+    func testJSONArrayOfScalarsMatchesSerializer() async throws {
+        let values: [any Sendable] = ["a/b", 1, 2.5, true]
+        let output = try await written(values, format: .json, file: "values.json")
+        XCTAssertEqual(output, serialized(values, format: .json))
+    }
+
+    func testSQLWithoutBatchingMatchesSerializer() async throws {
+        let output = try await written(rows, format: .sql, file: "rows.sql", options: ["batch": 1])
+        XCTAssertEqual(output, serialized(rows, format: .sql))
+    }
+
+    func testLogMatchesSerializerAfterTimestamp() async throws {
+        let output = try await written(rows, format: .log, file: "rows.log")
+        let expected = serialized(rows, format: .log)
+        func messages(_ text: String) -> [String] {
+            text.components(separatedBy: "\n").map { line in
+                line.range(of: ": ").map { String(line[$0.upperBound...]) } ?? line
+            }
+        }
+        XCTAssertEqual(messages(output), messages(expected))
+    }
+
+    func testEmptyStreamsMatchSerializer() async throws {
+        for (format, file) in [(FileFormat.csv, "e.csv"), (.jsonl, "e.jsonl"), (.json, "e.json"), (.sql, "e.sql")] {
+            let output = try await written([], format: format, file: file)
+            XCTAssertEqual(output, serialized([], format: format), "\(format)")
+        }
+    }
+
+    // MARK: - Writer Behavior
+
+    func testSQLBatchesRowsWithSameColumns() async throws {
+        let records: [any Sendable] = [
+            ["id": 1, "name": "a"] as [String: any Sendable],
+            ["id": 2, "name": "b"] as [String: any Sendable],
+            ["id": 3, "name": "c"] as [String: any Sendable],
+            ["id": 4] as [String: any Sendable],
+            "skipped",
+        ]
+        let output = try await written(records, format: .sql, file: "batch.sql", options: ["batch": 2])
+        XCTAssertEqual(output, """
+        INSERT INTO items (id, name) VALUES (1, 'a'), (2, 'b');
+        INSERT INTO items (id, name) VALUES (3, 'c');
+        INSERT INTO items (id) VALUES (4);
+        """)
+    }
+
+    func testAppendContinuesExistingFile() async throws {
+        let first: [any Sendable] = Array(rows.prefix(2))
+        let second: [any Sendable] = Array(rows.suffix(2))
+        _ = try await written(first, format: .csv, file: "append.csv", append: true)
+        let output = try await written(second, format: .csv, file: "append.csv", append: true)
+        XCTAssertEqual(output, serialized(first, format: .csv) + "\n" + serialized(second, format: .csv, options: ["header": false]))
+
+        _ = try await written(first, format: .jsonl, file: "append.jsonl", append: true)
+        let lines = try await written(second, format: .jsonl, file: "append.jsonl", append: true)
+        XCTAssertEqual(lines, serialized(rows, format: .jsonl))
+    }
+
+    func testFailedStreamLeavesPreviousFile() async throws {
+        struct Boom: Error {}
+        let path = directory.appendingPathComponent("keep.jsonl").path
+        try "previous".write(toFile: path, atomically: true, encoding: .utf8)
+
+        let failing = AROStream<any Sendable> {
+            AsyncThrowingStream { continuation in
+                continuation.yield(["id": 1] as [String: any Sendable])
+                continuation.finish(throwing: Boom())
+            }
+        }
+        do {
+            try await FormatSerializer.write(failing, to: path, format: .jsonl, variableName: "items")
+            XCTFail("expected the stream error")
+        } catch is Boom {}
+
+        XCTAssertEqual(try String(contentsOfFile: path, encoding: .utf8), "previous")
+        let leftovers = try FileManager.default.contentsOfDirectory(atPath: directory.path)
+        XCTAssertEqual(leftovers, ["keep.jsonl"])
+    }
+
+    func testFormatsWithoutWriter() {
+        XCTAssertTrue(FormatSerializer.canStream(.json))
+        XCTAssertFalse(FormatSerializer.canStream(.json, continuing: true))
+        XCTAssertFalse(FormatSerializer.canStream(.yaml))
+        XCTAssertFalse(FormatSerializer.canStream(.xml))
+    }
+
+    // MARK: - Benchmark
+
+    /// Peak resident set size of the process in bytes
+    private static func peakResidentBytes() -> Int {
+        var usage = rusage()
+        #if os(Linux)
+        getrusage(Int32(0), &usage)  // 0 = RUSAGE_SELF
+        return Int(usage.ru_maxrss) * 1024
+        #else
+        getrusage(RUSAGE_SELF, &usage)
+        return Int(usage.ru_maxrss)
+        #endif
+    }
+
+    /// Yields generated rows on demand, so the source holds one row
+    private final class RowSource: @unchecked Sendable {
+        let count: Int
+        var next = 0
+
+        init(count: Int) {
+            self.count = count
+        }
+
+        func stream() -> AROStream<any Sendable> {
+            AROStream {
+                AsyncThrowingStream<any Sendable, Error>(unfolding: {
+                    guard self.next < self.count else { return nil }
+                    let i = self.next
+                    self.next += 1
+                    return [
+                        "id": i, "name": "user-\(i)", "email": "user\(i)@example.com",
+                        "score": Double(i % 1000) / 8, "active": i % 2 == 0,
+                    ] as [String: any Sendable]
+                })
+            }
+        }
+    }
+
+    func testBenchmarkStreamMillionRowsPeakRSS() throws {
+        try BenchmarkGate.require()
+        let rowCount = 1_000_000
+        for format in [FileFormat.csv, .jsonl, .sql] {
+            let path = directory.appendingPathComponent("million.\(format.rawValue)").path
+            let before = Self.peakResidentBytes()
+            let start = Date()
+
+            let done = expectation(description: "\(format) written")
+            Task {
+                do {
+                    try await FormatSerializer.write(RowSource(count: rowCount).stream(), to: path,
+                                                     format: format, variableName: "users")
+                } catch {
+                    XCTFail("\(format): \(error)")
+                }
+                done.fulfill()
+            }
+            wait(for: [done], timeout: 600)
+
+            let elapsed = Date().timeIntervalSince(start)
+            let size = (try? FileManager.default.attributesOfItem(atPath: path)[.size] as? Int) ?? 0
+            let growth = Self.peakResidentBytes() - before
+            print("\(format.rawValue): \(size >> 20) MB in \(String(format: "%.2f", elapsed)) s, peak RSS +\(growth >> 20) MB")
+
+            // Serializing to one String would need at least the file size
+            XCTAssertGreaterThan(size, 0)
+            XCTAssertLessThan(growth, size / 2, "\(format) peak RSS grew with the output")
+            try? FileManager.default.removeItem(atPath: path)
+        }
+    }
+}
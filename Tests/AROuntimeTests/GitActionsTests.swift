@@ -352,4 +352,103 @@ struct GitStageCommitTests {
     }
 }
 
+// MARK: - Repository Pool Tests
+
+/// Runs `git` in `repo` for out-of-process changes.
+private func runGit(_ args: String..., in repo: URL) throws {
+    let p = Process()
+    p.executableURL = URL(fileURLWithPath: "/usr/bin/git")
+    p.arguments = Array(args)
+    p.currentDirectoryURL = repo
+    p.standardOutput = FileHandle.nullDevice
+    p.standardError = FileHandle.nullDevice
+    try p.run()
+    p.waitUntilExit()
+    try #require(p.terminationStatus == 0, "git \(args.joined(separator: " ")) exited with \(p.terminationStatus)")
+}
+
+@Suite("Git Repository Pool Tests")
+struct GitRepositoryPoolTests {
+
+    @Test("Concurrent status and log calls across several repositories")
+    func testConcurrentStatusAndLog() async throws {
+        let git = GitService.shared
+        let repos = try (1...4).map { try makeTempRepo(commitCount: $0) }
+        defer { repos.forEach { try? FileManager.default.removeItem(at: $0) } }
+
+        let results = try await withThrowingTaskGroup(of: (Int, Int, Bool).self) { group in
+            for _ in 0..<20 {
+                for (index, repo) in repos.enumerated() {
+                    group.addTask {
+                        let entries = try git.log(limit: 10, in: repo)
+                        let status = try git.status(in: repo)
+                        return (index, entries.count, status.clean)
+                    }
+                }
+            }
+            var collected: [(Int, Int, Bool)] = []
+            for try await result in group {
+                collected.append(result)
+            }
+            return collected
+        }
+
+        #expect(results.count == 80)
+        for (index, count, clean) in results {
+            #expect(count == index + 1)
+            #expect(clean)
+        }
+    }
+
+    @Test("A handle is reused until HEAD changes on disk")
+    func testHandleReuseAndInvalidation() throws {
+        let pool = GitRepositoryPool(capacity: 4)
+        let repo = try makeTempRepo()
+        defer { try? FileManager.default.removeItem(at: repo) }
+
+        for _ in 0..<5 {
+            _ = try pool.withRepository(at: repo) { _ in true }
+        }
+        #expect(pool.openCount == 1)
+
+        try runGit("checkout", "-q", "-b", "feature", in: repo)
+        _ = try pool.withRepository(at: repo) { _ in true }
+        #expect(pool.openCount == 2)
+        _ = try pool.withRepository(at: repo) { _ in true }
+        #expect(pool.openCount == 2)
+    }
+
+    @Test("Least recently used idle handles are evicted")
+    func testLRUEviction() throws {
+        let pool = GitRepositoryPool(capacity: 2)
+        let repos = try (0..<3).map { _ in try makeTempRepo() }
+        defer { repos.forEach { try? FileManager.default.removeItem(at: $0) } }
+        let paths = repos.map { $0.standardizedFileURL.path }
+
+        for repo in [repos[0], repos[1], repos[0], repos[2]] {
+            _ = try pool.withRepository(at: repo) { _ in true }
+        }
+        #expect(pool.cachedPaths == [paths[0], paths[2]])
+
+        _ = try pool.withRepository(at: repos[1]) { _ in true }
+        #expect(pool.cachedPaths == [paths[2], paths[1]])
+        #expect(pool.openCount == 4)
+    }
+
+    @Test("A failed open is not cached as a handle")
+    func testNonRepositoryIsRetried() throws {
+        let pool = GitRepositoryPool(capacity: 2)
+        let dir = FileManager.default.temporaryDirectory
+            .appendingPathComponent("aro-git-test-\(UUID().uuidString)")
+        try FileManager.default.createDirectory(at: dir, withIntermediateDirectories: true)
+        defer { try? FileManager.default.removeItem(at: dir) }
+
+        #expect(throws: GitServiceError.self) {
+            try pool.withRepository(at: dir) { _ in () }
+        }
+        try runGit("init", "-q", in: dir)
+        #expect(try pool.withRepository(at: dir) { _ in true })
+    }
+}
+
 #endif // !os(Windows)
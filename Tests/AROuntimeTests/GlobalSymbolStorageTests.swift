@@ -12,27 +12,27 @@ final class GlobalSymbolEvictionTests: XCTestCase {
 
     func testPublishAndResolve() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(
+        storage.publish(
             name: "greeting", value: "hello",
             fromFeatureSet: "Test", businessActivity: "Test Activity", executionId: "exec-1"
         )
-        let value: String? = await storage.resolve("greeting", forBusinessActivity: "Test Activity")
+        let value: String? = storage.resolve("greeting", forBusinessActivity: "Test Activity")
         XCTAssertEqual(value, "hello")
     }
 
     func testResolveUnknownSymbolReturnsNil() async {
         let storage = GlobalSymbolStorage()
-        let value: String? = await storage.resolve("missing", forBusinessActivity: "any")
+        let value: String? = storage.resolve("missing", forBusinessActivity: "any")
         XCTAssertNil(value)
     }
 
     func testCountReflectsPublishedSymbols() async {
         let storage = GlobalSymbolStorage()
-        let count0 = await storage.count
+        let count0 = storage.count
         XCTAssertEqual(count0, 0)
-        await storage.publish(name: "a", value: "1", fromFeatureSet: "F", businessActivity: "", executionId: "e1")
-        await storage.publish(name: "b", value: "2", fromFeatureSet: "F", businessActivity: "", executionId: "e1")
-        let count2 = await storage.count
+        storage.publish(name: "a", value: "1", fromFeatureSet: "F", businessActivity: "", executionId: "e1")
+        storage.publish(name: "b", value: "2", fromFeatureSet: "F", businessActivity: "", executionId: "e1")
+        let count2 = storage.count
         XCTAssertEqual(count2, 2)
     }
 
@@ -40,38 +40,38 @@ final class GlobalSymbolEvictionTests: XCTestCase {
 
     func testEvictRemovesSymbolsForExecution() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(
+        storage.publish(
             name: "result", value: "data",
             fromFeatureSet: "Handler", businessActivity: "My Activity", executionId: "exec-abc"
         )
-        let before = await storage.count
+        let before = storage.count
         XCTAssertEqual(before, 1)
 
-        await storage.evict(executionId: "exec-abc")
+        storage.evict(executionId: "exec-abc")
 
-        let after = await storage.count
+        let after = storage.count
         XCTAssertEqual(after, 0)
-        let value: String? = await storage.resolve("result", forBusinessActivity: "My Activity")
+        let value: String? = storage.resolve("result", forBusinessActivity: "My Activity")
         XCTAssertNil(value, "Evicted symbol must not be resolvable")
     }
 
     func testEvictUnknownExecutionIsNoop() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(name: "x", value: 42, fromFeatureSet: "F", businessActivity: "", executionId: "exec-1")
-        await storage.evict(executionId: "exec-nonexistent")  // must not crash
-        let count = await storage.count
+        storage.publish(name: "x", value: 42, fromFeatureSet: "F", businessActivity: "", executionId: "exec-1")
+        storage.evict(executionId: "exec-nonexistent")  // must not crash
+        let count = storage.count
         XCTAssertEqual(count, 1)
     }
 
     func testEvictOnlyTargetedExecution() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(name: "sym-a", value: "A", fromFeatureSet: "F", businessActivity: "Act", executionId: "exec-1")
-        await storage.publish(name: "sym-b", value: "B", fromFeatureSet: "F", businessActivity: "Act", executionId: "exec-2")
+        storage.publish(name: "sym-a", value: "A", fromFeatureSet: "F", businessActivity: "Act", executionId: "exec-1")
+        storage.publish(name: "sym-b", value: "B", fromFeatureSet: "F", businessActivity: "Act", executionId: "exec-2")
 
-        await storage.evict(executionId: "exec-1")
+        storage.evict(executionId: "exec-1")
 
-        let valA = await storage.resolveAny("sym-a", forBusinessActivity: "Act")
-        let valB = await storage.resolveAny("sym-b", forBusinessActivity: "Act")
+        let valA = storage.resolveAny("sym-a", forBusinessActivity: "Act")
+        let valB = storage.resolveAny("sym-b", forBusinessActivity: "Act")
         XCTAssertNil(valA, "exec-1 symbol must be removed")
         XCTAssertNotNil(valB, "exec-2 symbol must survive")
     }
@@ -79,26 +79,26 @@ final class GlobalSymbolEvictionTests: XCTestCase {
     func testEvictMultipleSymbolsForSameExecution() async {
         let storage = GlobalSymbolStorage()
         for i in 1...5 {
-            await storage.publish(
+            storage.publish(
                 name: "sym-\(i)", value: i,
                 fromFeatureSet: "F", businessActivity: "", executionId: "exec-bulk"
             )
         }
-        let before = await storage.count
+        let before = storage.count
         XCTAssertEqual(before, 5)
 
-        await storage.evict(executionId: "exec-bulk")
+        storage.evict(executionId: "exec-bulk")
 
-        let after = await storage.count
+        let after = storage.count
         XCTAssertEqual(after, 0)
     }
 
     func testEvictTwiceIsNoop() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(name: "x", value: "v", fromFeatureSet: "F", businessActivity: "", executionId: "exec-1")
-        await storage.evict(executionId: "exec-1")
-        await storage.evict(executionId: "exec-1")  // must not crash
-        let count = await storage.count
+        storage.publish(name: "x", value: "v", fromFeatureSet: "F", businessActivity: "", executionId: "exec-1")
+        storage.evict(executionId: "exec-1")
+        storage.evict(executionId: "exec-1")  // must not crash
+        let count = storage.count
         XCTAssertEqual(count, 0)
     }
 
@@ -108,39 +108,39 @@ final class GlobalSymbolEvictionTests: XCTestCase {
         let storage = GlobalSymbolStorage()
 
         // exec-1 publishes "shared"
-        await storage.publish(
+        storage.publish(
             name: "shared", value: "v1",
             fromFeatureSet: "F", businessActivity: "A", executionId: "exec-1"
         )
         // exec-2 overwrites "shared" before exec-1 evicts
-        await storage.publish(
+        storage.publish(
             name: "shared", value: "v2",
             fromFeatureSet: "F", businessActivity: "A", executionId: "exec-2"
         )
 
         // exec-1 finishes and evicts — must NOT remove exec-2's entry
-        await storage.evict(executionId: "exec-1")
+        storage.evict(executionId: "exec-1")
 
-        let value: String? = await storage.resolve("shared", forBusinessActivity: "A")
+        let value: String? = storage.resolve("shared", forBusinessActivity: "A")
         XCTAssertEqual(value, "v2", "Newer invocation's symbol must survive stale eviction")
-        let count = await storage.count
+        let count = storage.count
         XCTAssertEqual(count, 1)
     }
 
     func testOwnershipTransferToNewExecution() async {
         let storage = GlobalSymbolStorage()
 
-        await storage.publish(name: "key", value: "old", fromFeatureSet: "F", businessActivity: "", executionId: "exec-A")
-        await storage.publish(name: "key", value: "new", fromFeatureSet: "F", businessActivity: "", executionId: "exec-B")
+        storage.publish(name: "key", value: "old", fromFeatureSet: "F", businessActivity: "", executionId: "exec-A")
+        storage.publish(name: "key", value: "new", fromFeatureSet: "F", businessActivity: "", executionId: "exec-B")
 
         // Evicting exec-A must not touch exec-B's entry
-        await storage.evict(executionId: "exec-A")
-        let count1 = await storage.count
+        storage.evict(executionId: "exec-A")
+        let count1 = storage.count
         XCTAssertEqual(count1, 1)
 
         // Evicting exec-B removes it
-        await storage.evict(executionId: "exec-B")
-        let count2 = await storage.count
+        storage.evict(executionId: "exec-B")
+        let count2 = storage.count
         XCTAssertEqual(count2, 0)
     }
 
@@ -148,21 +148,40 @@ final class GlobalSymbolEvictionTests: XCTestCase {
 
     func testAllSymbolsReturnsPublishedEntries() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(name: "alpha", value: "a", fromFeatureSet: "F1", businessActivity: "Act1", executionId: "e1")
-        await storage.publish(name: "beta",  value: "b", fromFeatureSet: "F2", businessActivity: "Act2", executionId: "e2")
+        storage.publish(name: "alpha", value: "a", fromFeatureSet: "F1", businessActivity: "Act1", executionId: "e1")
+        storage.publish(name: "beta",  value: "b", fromFeatureSet: "F2", businessActivity: "Act2", executionId: "e2")
 
-        let all = await storage.allSymbols()
+        let all = storage.allSymbols()
         XCTAssertEqual(all.count, 2)
         XCTAssertEqual(all["alpha"]?.featureSet, "F1")
         XCTAssertEqual(all["alpha"]?.executionId, "e1")
         XCTAssertEqual(all["beta"]?.businessActivity, "Act2")
     }
 
+    func testAllSymbolsIteratesTheSnapshotWithoutCopying() {
+        let storage = GlobalSymbolStorage()
+        for i in 0..<200 {
+            storage.publish(name: "sym-\(i)", value: i, fromFeatureSet: "F", businessActivity: "", executionId: "e1")
+        }
+
+        // Eager binding iterates allSymbols(); it must be the live snapshot,
+        // not a table merged for the caller
+        let all = storage.allSymbols()
+        XCTAssertTrue(all === storage.snapshot())
+
+        var seen: [String: Int] = [:]
+        for (name, entry) in all {
+            seen[name] = entry.value as? Int
+        }
+        XCTAssertEqual(seen.count, 200)
+        XCTAssertEqual(seen["sym-137"], 137)
+    }
+
     func testAllSymbolsEmptyAfterEviction() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(name: "x", value: 1, fromFeatureSet: "F", businessActivity: "", executionId: "e1")
-        await storage.evict(executionId: "e1")
-        let all = await storage.allSymbols()
+        storage.publish(name: "x", value: 1, fromFeatureSet: "F", businessActivity: "", executionId: "e1")
+        storage.evict(executionId: "e1")
+        let all = storage.allSymbols()
         XCTAssertTrue(all.isEmpty)
     }
 
@@ -170,14 +189,77 @@ final class GlobalSymbolEvictionTests: XCTestCase {
 
     func testBusinessActivityScopingStillWorks() async {
         let storage = GlobalSymbolStorage()
-        await storage.publish(
+        storage.publish(
             name: "secret", value: "hidden",
             fromFeatureSet: "F", businessActivity: "Activity-A", executionId: "e1"
         )
-        let fromA: String? = await storage.resolve("secret", forBusinessActivity: "Activity-A")
-        let fromB: String? = await storage.resolve("secret", forBusinessActivity: "Activity-B")
+        let fromA: String? = storage.resolve("secret", forBusinessActivity: "Activity-A")
+        let fromB: String? = storage.resolve("secret", forBusinessActivity: "Activity-B")
 
         XCTAssertEqual(fromA, "hidden")
         XCTAssertNil(fromB, "Symbol must not be accessible from a different business activity")
     }
+
+    // MARK: - Snapshots
+
+    func testSnapshotIsStableAcrossLaterWrites() {
+        let storage = GlobalSymbolStorage()
+        storage.publish(name: "config", value: "v1", fromFeatureSet: "F", businessActivity: "", executionId: "e1")
+        let before = storage.snapshot()
+
+        storage.publish(name: "config", value: "v2", fromFeatureSet: "F", businessActivity: "", executionId: "e2")
+        storage.evict(executionId: "e-none")
+        let after = storage.snapshot()
+
+        XCTAssertEqual(before.resolveAny("config", forBusinessActivity: "any") as? String, "v1")
+        XCTAssertEqual(after.resolveAny("config", forBusinessActivity: "any") as? String, "v2")
+        XCTAssertEqual(after.version, before.version + 1, "A no-op eviction must not cut a new version")
+    }
+
+    func testManySymbolsAcrossShards() {
+        let storage = GlobalSymbolStorage()
+        for i in 0..<2_000 {
+            storage.publish(
+                name: "sym-\(i)", value: i,
+                fromFeatureSet: "F", businessActivity: "", executionId: "exec-\(i % 2)"
+            )
+        }
+        // Overwriting an existing name must not change the count
+        storage.publish(name: "sym-0", value: -1, fromFeatureSet: "F", businessActivity: "", executionId: "exec-0")
+        XCTAssertEqual(storage.count, 2_000)
+
+        storage.evict(executionId: "exec-1")
+        let snapshot = storage.snapshot()
+        XCTAssertEqual(snapshot.count, 1_000)
+        XCTAssertEqual(Array(snapshot).count, 1_000)
+        XCTAssertEqual(snapshot.resolveAny("sym-0", forBusinessActivity: "") as? Int, -1)
+        for i in stride(from: 1, to: 2_000, by: 97) {
+            let expected: Int? = i.isMultiple(of: 2) ? i : nil
+            XCTAssertEqual(snapshot.resolveAny("sym-\(i)", forBusinessActivity: "") as? Int, expected, "sym-\(i)")
+        }
+    }
+
+    func testConcurrentReadersSeeCompleteVersions() async {
+        let storage = GlobalSymbolStorage()
+        storage.publish(name: "n", value: 0, fromFeatureSet: "F", businessActivity: "", executionId: "start")
+
+        await withTaskGroup(of: Void.self) { group in
+            group.addTask {
+                for i in 1...500 {
+                    storage.publish(name: "n", value: i, fromFeatureSet: "F", businessActivity: "", executionId: "start")
+                }
+            }
+            for _ in 0..<4 {
+                group.addTask {
+                    var last = 0
+                    for _ in 0..<500 {
+                        let value = storage.resolveAny("n", forBusinessActivity: "") as? Int ?? -1
+                        XCTAssertGreaterThanOrEqual(value, last)
+                        last = value
+                    }
+                }
+            }
+        }
+        XCTAssertEqual(storage.resolveAny("n", forBusinessActivity: "") as? Int, 500)
+    }
 }
@@ -0,0 +1,218 @@
+// ============================================================
+// HTTPResponseCacheTests.swift
+// ARO Runtime - Outbound HTTP cache and request coalescing tests
+// ============================================================
+
+import Foundation
+import Testing
+@testable import ARORuntime
+
+/// Manually advanced clock for freshness tests
+private final class TestClock: @unchecked Sendable {
+    private let lock = NSLock()
+    private var current = Date(timeIntervalSince1970: 1_800_000_000)
+
+    var now: Date {
+        lock.lock(); defer { lock.unlock() }
+        return current
+    }
+
+    func advance(_ seconds: TimeInterval) {
+        lock.lock(); defer { lock.unlock() }
+        current = current.addingTimeInterval(seconds)
+    }
+}
+
+/// Stub upstream that records every request it receives
+private final class StubUpstream: @unchecked Sendable {
+    private let lock = NSLock()
+    private(set) var requests: [[String: String]] = []
+    var respond: @Sendable ([String: String]) -> HTTPClientResponse
+    var delayNanos: UInt64 = 0
+
+    init(_ respond: @escaping @Sendable ([String: String]) -> HTTPClientResponse) {
+        self.respond = respond
+    }
+
+    var callCount: Int {
+        lock.lock(); defer { lock.unlock() }
+        return requests.count
+    }
+
+    func fetch(_ headers: [String: String]) async throws -> HTTPClientResponse {
+        lock.lock()
+        requests.append(headers)
+        lock.unlock()
+        if delayNanos > 0 {
+            try await Task.sleep(nanoseconds: delayNanos)
+        }
+        return respond(headers)
+    }
+}
+
+@Suite("HTTP Response Cache Tests")
+struct HTTPResponseCacheTests {
+
+    private func makePipeline(clock: TestClock, coalesce: Bool = true) -> HTTPClientPipeline {
+        HTTPClientPipeline(
+            tuning: HTTPClientTuning(cacheMaxEntries: 4, coalesceRequests: coalesce),
+            now: { clock.now }
+        )
+    }
+
+    private func get(_ pipeline: HTTPClientPipeline, _ upstream: StubUpstream,
+                     url: String = "https://api.example.com/items",
+                     headers: [String: String] = [:]) async throws -> HTTPClientResponse {
+        try await pipeline.perform(method: "GET", url: url, headers: headers, body: nil) { sent in
+            try await upstream.fetch(sent)
+        }
+    }
+
+    @Test("Fresh responses are served from cache until max-age expires")
+    func testMaxAgeFreshness() async throws {
+        let clock = TestClock()
+        let pipeline = makePipeline(clock: clock)
+        let upstream = StubUpstream { _ in
+            HTTPClientResponse(statusCode: 200, headers: ["Cache-Control": "max-age=60"], body: Data("v1".utf8))
+        }
+
+        _ = try await get(pipeline, upstream)
+        clock.advance(30)
+        let cached = try await get(pipeline, upstream)
+        #expect(upstream.callCount == 1)
+        #expect(cached.bodyString == "v1")
+
+        clock.advance(31)
+        _ = try await get(pipeline, upstream)
+        #expect(upstream.callCount == 2)
+    }
+
+    @Test("Stale entries revalidate with ETag and reuse the body on 304")
+    func testConditionalRevalidation() async throws {
+        let clock = TestClock()
+        let pipeline = makePipeline(clock: clock)
+        let upstream = StubUpstream { headers in
+            if headers["If-None-Match"] == "\"abc\"" {
+                return HTTPClientResponse(statusCode: 304, headers: ["Cache-Control": "max-age=10"])
+            }
+            return HTTPClientResponse(statusCode: 200, headers: ["ETag": "\"abc\"", "Cache-Control": "no-cache"], body: Data("body".utf8))
+        }
+
+        _ = try await get(pipeline, upstream)
+        let revalidated = try await get(pipeline, upstream)
+        #expect(upstream.callCount == 2)
+        #expect(upstream.requests[1]["If-None-Match"] == "\"abc\"")
+        #expect(revalidated.statusCode == 200)
+        #expect(revalidated.bodyString == "body")
+
+        // The 304 carried max-age=10, replacing no-cache
+        _ = try await get(pipeline, upstream)
+        #expect(upstream.callCount == 2)
+    }
+
+    @Test("no-store, private and authorized responses are not cached")
+    func testUncacheableResponses() async throws {
+        let clock = TestClock()
+        let pipeline = makePipeline(clock: clock)
+
+        for cacheControl in ["no-store", "private, max-age=60"] {
+            let upstream = StubUpstream { _ in
+                HTTPClientResponse(statusCode: 200, headers: ["Cache-Control": cacheControl], body: Data())
+            }
+            _ = try await get(pipeline, upstream)
+            _ = try await get(pipeline, upstream)
+            #expect(upstream.callCount == 2)
+        }
+
+        let authorized = StubUpstream { _ in
+            HTTPClientResponse(statusCode: 200, headers: ["Cache-Control": "max-age=60"], body: Data())
+        }
+        _ = try await get(pipeline, authorized, headers: ["Authorization": "Bearer t"])
+        _ = try await get(pipeline, authorized, headers: ["Authorization": "Bearer t"])
+        #expect(authorized.callCount == 2)
+    }
+
+    @Test("Vary keeps responses apart per request header value")
+    func testVary() async throws {
+        let clock = TestClock()
+        let pipeline = makePipeline(clock: clock)
+        let upstream = StubUpstream { headers in
+            HTTPClientResponse(
+                statusCode: 200,
+                headers: ["Cache-Control": "max-age=60", "Vary": "Accept-Language"],
+                body: Data((headers["Accept-Language"] ?? "none").utf8)
+            )
+        }
+
+        _ = try await get(pipeline, upstream, headers: ["Accept-Language": "de"])
+        let german = try await get(pipeline, upstream, headers: ["Accept-Language": "de"])
+        let english = try await get(pipeline, upstream, headers: ["Accept-Language": "en"])
+        #expect(german.bodyString == "de")
+        #expect(english.bodyString == "en")
+        #expect(upstream.callCount == 2)
+    }
+
+    @Test("Unsafe methods invalidate the cached entry")
+    func testUnsafeMethodInvalidates() async throws {
+        let clock = TestClock()
+        let pipeline = makePipeline(clock: clock)
+        let upstream = StubUpstream { _ in
+            HTTPClientResponse(statusCode: 200, headers: ["Cache-Control": "max-age=60"], body: Data())
+        }
+
+        _ = try await get(pipeline, upstream)
+        _ = try await pipeline.perform(method: "POST", url: "https://api.example.com/items", headers: [:], body: Data("{}".utf8)) { sent in
+            try await upstream.fetch(sent)
+        }
+        _ = try await get(pipeline, upstream)
+        #expect(upstream.callCount == 3)
+    }
+
+    @Test("Identical concurrent GETs are coalesced into one upstream call")
+    func testSingleFlight() async throws {
+        let clock = TestClock()
+        let pipeline = makePipeline(clock: clock)
+        let upstream = StubUpstream { _ in
+            HTTPClientResponse(statusCode: 200, headers: ["Cache-Control": "no-store"], body: Data("shared".utf8))
+        }
+        upstream.delayNanos = 50_000_000
+
+        let bodies = try await withThrowingTaskGroup(of: String?.self) { group in
+            for _ in 0..<100 {
+                group.addTask { try await get(pipeline, upstream).bodyString }
+            }
+            var collected: [String?] = []
+            for try await body in group { collected.append(body) }
+            return collected
+        }
+
+        #expect(bodies.count == 100)
+        #expect(bodies.allSatisfy { $0 == "shared" })
+        #expect(upstream.callCount == 1)
+        #expect(pipeline.coalescer.inFlightCount == 0)
+    }
+
+    @Test("The cache evicts least recently used entries beyond its capacity")
+    func testEviction() async throws {
+        let clock = TestClock()
+        let pipeline = makePipeline(clock: clock, coalesce: false)
+        let upstream = StubUpstream { _ in
+            HTTPClientResponse(statusCode: 200, headers: ["Cache-Control": "max-age=600"], body: Data())
+        }
+
+        for i in 0..<10 {
+            _ = try await get(pipeline, upstream, url: "https://api.example.com/\(i)")
+        }
+        #expect(pipeline.cache.count <= 4)
+    }
+
+    @Test("Cache-Control parsing")
+    func testCacheControlParsing() {
+        let control = CacheControl("public, max-age=120, s-maxage=\"30\", must-revalidate")
+        #expect(control.isPublic)
+        #expect(control.maxAge == 120)
+        #expect(control.sharedMaxAge == 30)
+        #expect(control.mustRevalidate)
+        #expect(!control.noStore)
+    }
+}
@@ -0,0 +1,78 @@
+// ============================================================
+// JSONStreamParserBenchmarkTests.swift
+// ARO Runtime - JSONL streaming throughput
+// ============================================================
+//
+// Streams a generated JSONL file (64 MB by default, ARO_BENCHMARK_MB to
+// change it) through the byte-level scanner, serially and with one
+// parsing thread per core. The file is generated once for the class and
+// removed afterwards. Runs only with ARO_BENCHMARKS set (BenchmarkGate).
+
+import XCTest
+@testable import ARORuntime
+
+final class JSONStreamParserBenchmarkTests: XCTestCase {
+
+    // Written once in class setUp before any test runs, then only read
+    nonisolated(unsafe) private static var fileURL: URL?
+    nonisolated(unsafe) private static var lineCount = 0
+
+    override class func setUp() {
+        super.setUp()
+        guard BenchmarkGate.isEnabled else { return }
+        let targetBytes = BenchmarkGate.bytes(defaultMegabytes: 64)
+        let url = FileManager.default.temporaryDirectory
+            .appendingPathComponent("jsonl-benchmark-\(UUID()).jsonl")
+        guard FileManager.default.createFile(atPath: url.path, contents: nil),
+              let handle = try? FileHandle(forWritingTo: url) else {
+            return
+        }
+        defer { try? handle.close() }
+
+        var written = 0
+        var lines = 0
+        var chunk = ""
+        while written < targetBytes {
+            chunk.removeAll(keepingCapacity: true)
+            for _ in 0..<10_000 {
+                chunk += #"{"id": \#(lines), "name": "user-\#(lines)", "email": "user\#(lines)@example.com", "#
+                chunk += #""score": \#(Double(lines % 1000) / 8), "active": \#(lines % 2 == 0), "#
+                chunk += #""tags": ["alpha", "beta"], "address": {"city": "Berlin", "zip": "10115"}}"#
+                chunk += "\n"
+                lines += 1
+            }
+            let data = Data(chunk.utf8)
+            handle.write(data)
+            written += data.count
+        }
+        fileURL = url
+        lineCount = lines
+    }
+
+    override class func tearDown() {
+        if let url = fileURL {
+            try? FileManager.default.removeItem(at: url)
+        }
+        fileURL = nil
+        super.tearDown()
+    }
+
+    private func streamRows(parallelism: Int) throws {
+        try BenchmarkGate.require()
+        let url = try XCTUnwrap(Self.fileURL, "benchmark file was not created")
+        let config = JSONStreamParser.Config(jsonlMode: true, skipMalformed: false, parallelism: parallelism)
+        measure {
+            var rows = 0
+            XCTAssertNoThrow(try JSONLineScanner.scan(path: url.path, config: config) { _ in rows += 1 })
+            XCTAssertEqual(rows, Self.lineCount)
+        }
+    }
+
+    func testBenchmarkStreamSerial() throws {
+        try streamRows(parallelism: 1)
+    }
+
+    func testBenchmarkStreamParallel() throws {
+        try streamRows(parallelism: ProcessInfo.processInfo.activeProcessorCount)
+    }
+}
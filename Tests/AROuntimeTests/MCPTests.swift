@@ -933,4 +933,213 @@ struct MCPTests {
             #expect(result.content.first?.text?.contains("directory") == true)
         }
     }
+
+    // MARK: - Concurrent Dispatch Tests
+
+    @Suite("MCP Concurrent Dispatch")
+    struct MCPConcurrentDispatchTests {
+
+        /// Transport fed line by line by the test; `nil` is end of input
+        actor InMemoryTransport: MCPTransport {
+            private var pending: [String?] = []
+            private var reader: CheckedContinuation<String?, Never>?
+            private(set) var sent: [String] = []
+            private var watchers: [(count: Int, continuation: CheckedContinuation<[String], Never>)] = []
+
+            func start() async throws {}
+            func stop() async {}
+
+            func send(_ message: String) async throws {
+                sent.append(message)
+                let ready = watchers.filter { $0.count <= sent.count }
+                watchers.removeAll { $0.count <= sent.count }
+                for watcher in ready {
+                    watcher.continuation.resume(returning: sent)
+                }
+            }
+
+            func receive() async throws -> String? {
+                if !pending.isEmpty {
+                    return pending.removeFirst()
+                }
+                return await withCheckedContinuation { reader = $0 }
+            }
+
+            func push(_ line: String?) {
+                if let reader {
+                    self.reader = nil
+                    reader.resume(returning: line)
+                } else {
+                    pending.append(line)
+                }
+            }
+
+            /// Wait until at least `count` messages were sent
+            func messages(atLeast count: Int) async -> [String] {
+                if sent.count >= count {
+                    return sent
+                }
+                return await withCheckedContinuation { watchers.append((count, $0)) }
+            }
+        }
+
+        /// Records tool activity and peak concurrency
+        actor ToolProbe {
+            private(set) var active = 0
+            private(set) var peak = 0
+            private(set) var cancelledCalls: [String] = []
+
+            func enter() {
+                active += 1
+                peak = max(peak, active)
+            }
+
+            func leave(_ tag: String, cancelled: Bool) {
+                active -= 1
+                if cancelled {
+                    cancelledCalls.append(tag)
+                }
+            }
+        }
+
+        /// `slow` sleeps 30 s unless cancelled, `pause` sleeps 20 ms,
+        /// anything else answers at once. Replies echo the `tag` argument.
+        private static func tools(_ probe: ToolProbe) -> MCPServer.ToolHandler {
+            { name, arguments in
+                let tag = arguments?["tag"]?.stringValue ?? name
+                await probe.enter()
+                switch name {
+                case "slow":
+                    try? await Task.sleep(nanoseconds: 30_000_000_000)
+                case "pause":
+                    try? await Task.sleep(nanoseconds: 20_000_000)
+                default:
+                    break
+                }
+                await probe.leave(tag, cancelled: Task.isCancelled)
+                return MCPToolCallResult(content: [.text(tag)], isError: false)
+            }
+        }
+
+        private static func call(_ id: Int, _ tool: String, tag: String? = nil) -> String {
+            """
+            {"jsonrpc":"2.0","id":\(id),"method":"tools/call","params":{"name":"\(tool)","arguments":{"tag":"\(tag ?? tool)"}}}
+            """
+        }
+
+        private static func cancel(_ id: Int) -> String {
+            """
+            {"jsonrpc":"2.0","method":"notifications/cancelled","params":{"requestId":\(id),"reason":"test"}}
+            """
+        }
+
+        private static func decode(_ message: String) throws -> JSONValue {
+            try JSONDecoder().decode(JSONValue.self, from: Data(message.utf8))
+        }
+
+        private static func ids(_ messages: [String]) throws -> [Int?] {
+            try messages.map { try decode($0)["id"]?.intValue }
+        }
+
+        @Test("Fast calls answer while a slow call runs, and cancellation stops it")
+        func fastCallsOvertakeSlowCall() async throws {
+            let transport = InMemoryTransport()
+            let probe = ToolProbe()
+            let server = MCPServer(transport: transport, toolHandler: Self.tools(probe))
+            let run = Task { await server.run() }
+
+            await transport.push(Self.call(1, "slow"))
+            await transport.push(Self.call(2, "fast", tag: "two"))
+            await transport.push(#"{"jsonrpc":"2.0","id":3,"method":"ping"}"#)
+            await transport.push(Self.call(4, "fast", tag: "four"))
+
+            let early = await transport.messages(atLeast: 3)
+            #expect(try Set(Self.ids(early)) == [2, 3, 4])
+
+            await transport.push(Self.cancel(1))
+            await transport.push(nil)
+            await run.value
+
+            // The cancelled call ended early and was never answered
+            let sent = await transport.sent
+            #expect(sent.count == 3)
+            #expect(await probe.cancelledCalls == ["slow"])
+        }
+
+        @Test("In-flight requests never exceed the limit")
+        func inFlightLimitIsRespected() async throws {
+            let transport = InMemoryTransport()
+            let probe = ToolProbe()
+            let server = MCPServer(transport: transport, maxInFlight: 2, toolHandler: Self.tools(probe))
+            let run = Task { await server.run() }
+
+            for id in 1...8 {
+                await transport.push(Self.call(id, "pause", tag: "p\(id)"))
+            }
+            await transport.push(nil)
+            await run.value
+
+            let sent = await transport.sent
+            #expect(try Set(Self.ids(sent)) == Set(1...8))
+            #expect(await probe.peak == 2)
+        }
+
+        @Test("Cancelling a queued request drops it without running it")
+        func cancelQueuedRequest() async throws {
+            let transport = InMemoryTransport()
+            let probe = ToolProbe()
+            let server = MCPServer(transport: transport, maxInFlight: 1, toolHandler: Self.tools(probe))
+            let run = Task { await server.run() }
+
+            await transport.push(Self.call(1, "slow"))
+            await transport.push(Self.call(2, "fast", tag: "queued"))
+            await transport.push(Self.cancel(2))
+            await transport.push(Self.cancel(1))
+            await transport.push(Self.call(3, "fast", tag: "after"))
+            await transport.push(nil)
+            await run.value
+
+            let sent = await transport.sent
+            #expect(try Self.ids(sent) == [3])
+            #expect(try Self.decode(sent[0])["result"]?["content"]?[0]?["text"]?.stringValue == "after")
+            #expect(await probe.cancelledCalls == ["slow"])
+        }
+
+        @Test("A batch is answered with one array in request order")
+        func batchRequests() async throws {
+            let transport = InMemoryTransport()
+            let probe = ToolProbe()
+            let server = MCPServer(transport: transport, toolHandler: Self.tools(probe))
+            let run = Task { await server.run() }
+
+            await transport.push("""
+                [\(Self.call(1, "pause", tag: "first")), \
+                {"jsonrpc":"2.0","method":"notifications/initialized"}, \
+                {"jsonrpc":"2.0","id":9}, \
+                {"jsonrpc":"2.0","id":2,"method":"ping"}, \
+                \(Self.call(3, "fast", tag: "third"))]
+                """)
+            await transport.push(#"[{"jsonrpc":"2.0","method":"notifications/initialized"}]"#)
+            await transport.push("[]")
+            await transport.push("[not json")
+            await transport.push(nil)
+            await run.value
+
+            // The notification-only batch gets no reply; the empty batch
+            // and the bad line get one error each
+            let sent = await transport.sent
+            #expect(sent.count == 3)
+            let replies = try sent.map(Self.decode)
+            let errors = replies.filter { $0.arrayValue == nil }
+            #expect(errors.map { $0["error"]?["code"]?.intValue } == [
+                JSONRPCError.invalidRequest.code, JSONRPCError.parseError.code,
+            ])
+
+            let batch = try #require(replies.compactMap(\.arrayValue).first)
+            #expect(batch.map { $0["id"]?.intValue } == [1, nil, 2, 3])
+            #expect(batch[0]["result"]?["content"]?[0]?["text"]?.stringValue == "first")
+            #expect(batch[1]["error"]?["code"]?.intValue == JSONRPCError.invalidRequest.code)
+            #expect(batch[3]["result"]?["content"]?[0]?["text"]?.stringValue == "third")
+        }
+    }
 }
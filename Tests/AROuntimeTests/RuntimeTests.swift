@@ -291,6 +291,76 @@ struct EventBusTests {
         try? await Task.sleep(nanoseconds: 10_000_000) // 10ms
         #expect(await bus.subscriptionCount == 0)
     }
+
+    @Test("A stream counts as an observer from creation until it terminates")
+    func testStreamObserverBalance() async {
+        let bus = EventBus()
+        let stream = await bus.stream()
+        #expect(bus.hasObservers(for: FeatureSetStartedEvent.self))
+
+        let reader = Task { for await _ in stream {} }
+        reader.cancel()
+        await reader.value
+        // Give the termination Task time to unregister the stream
+        try? await Task.sleep(nanoseconds: 10_000_000) // 10ms
+        #expect(!bus.hasObservers(for: FeatureSetStartedEvent.self))
+
+        _ = await bus.stream()
+        bus.unsubscribeAll()
+        try? await Task.sleep(nanoseconds: 10_000_000) // 10ms
+        #expect(!bus.hasObservers(for: FeatureSetStartedEvent.self))
+        #expect(await bus.subscriptionCount == 0)
+    }
+
+    @Test("Unobserved events are not constructed")
+    func testPublishIfObserved() async {
+        let bus = EventBus()
+        var built = 0
+        func makeEvent() -> FeatureSetStartedEvent {
+            built += 1
+            return FeatureSetStartedEvent(featureSetName: "fs", executionId: "e1")
+        }
+
+        bus.publish(ifObserved: makeEvent())
+        #expect(built == 0)
+        #expect(!bus.hasObservers(for: FeatureSetStartedEvent.self))
+
+        bus.subscribe(to: "*") { _ in }
+        #expect(bus.hasObservers(for: FeatureSetStartedEvent.self))
+        bus.publish(ifObserved: makeEvent())
+        #expect(built == 1)
+    }
+
+    @Test("Domain event subscribers share one payload instance")
+    func testDomainEventSharesPayload() {
+        let event = DomainEvent(eventType: "UserCreated", payload: ["user": "alice", "id": 7])
+        let copy = event
+
+        #expect(copy.sharedPayload === event.sharedPayload)
+        #expect(MemoryLayout<DomainEvent>.size == MemoryLayout<Int>.size)
+        #expect(event.payload["user"] as? String == "alice")
+        #expect(Set(event.sharedPayload.bindings.map(\.qualifiedName)) == ["event:user", "event:id"])
+        #expect(Set(Mirror(reflecting: event).children.compactMap(\.label)) == ["domainEventType", "timestamp", "payload"])
+    }
+
+    @Test("Handlers of one event share a read-only payload frame")
+    func testHandlerFrameIsShared() {
+        let base = RuntimeContext(featureSetName: "Application-Start")
+        let event = DomainEvent(eventType: "UserCreated", payload: ["user": "alice"])
+        var built = 0
+        let first = event.handlerFrames.frame(over: base) { built += 1; return event.sharedPayload }
+        let second = event.handlerFrames.frame(over: base) { built += 1; return event.sharedPayload }
+        #expect(first === second)
+        #expect(built == 1)
+
+        let handlerA = RuntimeContext(featureSetName: "A", parent: first)
+        let handlerB = RuntimeContext(featureSetName: "B", parent: second)
+        handlerA.bind("event:user", value: "shadow")
+        #expect(handlerA.resolve("event:user") == "shadow")
+        #expect(handlerB.resolve("event:user") == "alice")
+        #expect(!handlerB.existsLocally("event"))
+        #expect(handlerB.exists("event"))
+    }
 }
 
 // MARK: - Action Descriptor Tests
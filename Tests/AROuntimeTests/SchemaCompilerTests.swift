@@ -0,0 +1,302 @@
+// ============================================================
+// SchemaCompilerTests.swift
+// ARO Runtime - OpenAPI schemas compiled to validator programs
+// ============================================================
+//
+// The compiled program must agree with the SchemaBinding tree walkers,
+// so most tests run both and compare. The two `measure` tests are the
+// benchmark: the same nested request bodies through each path.
+
+import XCTest
+@testable import ARORuntime
+
+final class SchemaCompilerTests: XCTestCase {
+
+    // MARK: - Fixtures
+
+    private func components(_ schemas: [String: Schema]) -> Components {
+        Components(
+            schemas: schemas.mapValues { SchemaRef($0) },
+            responses: nil,
+            parameters: nil,
+            requestBodies: nil,
+            headers: nil,
+            securitySchemes: nil
+        )
+    }
+
+    /// Order → [LineItem] → Product, with an address and a status enum
+    private func orderComponents() -> Components {
+        let product = Schema(
+            type: "object",
+            properties: [
+                "sku": SchemaRef(Schema(type: "string")),
+                "price": SchemaRef(Schema(type: "number")),
+                "tags": SchemaRef(Schema(type: "array", items: SchemaRef(Schema(type: "string"))))
+            ],
+            required: ["sku", "price"]
+        )
+        let lineItem = Schema(
+            type: "object",
+            properties: [
+                "product": SchemaRef(Schema(ref: "#/components/schemas/Product")),
+                "quantity": SchemaRef(Schema(type: "integer")),
+                "gift": SchemaRef(Schema(type: "boolean", defaultValue: .bool(false)))
+            ],
+            required: ["product", "quantity"]
+        )
+        let address = Schema(
+            type: "object",
+            properties: [
+                "street": SchemaRef(Schema(type: "string")),
+                "country": SchemaRef(Schema(type: "string", enumValues: [.string("DE"), .string("FR"), .string("US")]))
+            ],
+            required: ["street", "country"],
+            additionalProperties: .allowed(false)
+        )
+        let order = Schema(
+            type: "object",
+            properties: [
+                "id": SchemaRef(Schema(type: "string")),
+                "status": SchemaRef(Schema(type: "string", enumValues: [.string("open"), .string("paid"), .string("shipped")])),
+                "items": SchemaRef(Schema(type: "array", items: SchemaRef(Schema(ref: "#/components/schemas/LineItem")))),
+                "shipping": SchemaRef(Schema(ref: "#/components/schemas/Address"))
+            ],
+            required: ["id", "status", "items", "shipping"]
+        )
+        return components(["Product": product, "LineItem": lineItem, "Address": address, "Order": order])
+    }
+
+    private func orderBody(items: Int) -> [String: Any] {
+        [
+            "id": "order-1",
+            "status": "paid",
+            "items": (0..<items).map { i -> [String: Any] in
+                [
+                    "product": ["sku": "sku-\(i)", "price": 9.5, "tags": ["a", "b"]] as [String: Any],
+                    "quantity": i + 1
+                ]
+            },
+            "shipping": ["street": "Main St 1", "country": "DE"]
+        ]
+    }
+
+    private func compiledOrder(_ comps: Components) throws -> CompiledSchema {
+        try XCTUnwrap(SchemaCompiler(components: comps).build().component(named: "Order"))
+    }
+
+    private func assertSameJSON(_ lhs: Any, _ rhs: Any, file: StaticString = #filePath, line: UInt = #line) throws {
+        let options: JSONSerialization.WritingOptions = [.sortedKeys]
+        XCTAssertEqual(
+            try JSONSerialization.data(withJSONObject: lhs, options: options),
+            try JSONSerialization.data(withJSONObject: rhs, options: options),
+            file: file,
+            line: line
+        )
+    }
+
+    // MARK: - Agreement with the tree walker
+
+    func testNestedBodyParsesLikeTreeWalker() throws {
+        let comps = orderComponents()
+        let schema = try XCTUnwrap(comps.schemas?["Order"]?.value)
+        let body = orderBody(items: 3)
+
+        let expected = try SchemaBinding.parseValue(json: body, schema: schema, components: comps)
+        let actual = try compiledOrder(comps).parseValue(body)
+        try assertSameJSON(actual, expected)
+
+        // Defaults are injected and integers widened, as in the tree walker
+        let items = try XCTUnwrap((actual as? [String: Any])?["items"] as? [[String: Any]])
+        XCTAssertEqual(items[0]["gift"] as? Bool, false)
+        XCTAssertEqual(items[0]["quantity"] as? Double, 1)
+    }
+
+    func testFirstMissingRequiredFieldIsReportedInDeclarationOrder() throws {
+        let comps = orderComponents()
+        var body = orderBody(items: 1)
+        body["id"] = nil
+        body["status"] = nil
+
+        XCTAssertThrowsError(try compiledOrder(comps).parseValue(body)) { error in
+            XCTAssertEqual(error as? SchemaBindingError, .missingRequired("id"))
+        }
+    }
+
+    func testNestedErrorsMatchTreeWalker() throws {
+        let comps = orderComponents()
+        let schema = try XCTUnwrap(comps.schemas?["Order"]?.value)
+        let compiled = try compiledOrder(comps)
+
+        var badEnum = orderBody(items: 1)
+        badEnum["shipping"] = ["street": "x", "country": "XX"]
+        var extraKey = orderBody(items: 1)
+        extraKey["shipping"] = ["street": "x", "country": "FR", "zip": "1"]
+        var badItem = orderBody(items: 1)
+        badItem["items"] = [["product": ["sku": "s"], "quantity": 1] as [String: Any]]
+
+        for body in [badEnum, extraKey, badItem] {
+            var expected: SchemaBindingError?
+            XCTAssertThrowsError(try SchemaBinding.parseValue(json: body, schema: schema, components: comps)) {
+                expected = $0 as? SchemaBindingError
+            }
+            XCTAssertThrowsError(try compiled.parseValue(body)) {
+                XCTAssertEqual($0 as? SchemaBindingError, expected)
+            }
+        }
+    }
+
+    func testValidateKeepsIntegersAndAddsPropertyContext() throws {
+        let comps = orderComponents()
+        let lineItem = try XCTUnwrap(SchemaCompiler(components: comps).build().component(named: "LineItem"))
+
+        let product: [String: any Sendable] = ["sku": "s", "price": 1.0]
+        let valid = try lineItem.validate(["product": product, "quantity": 2] as [String: any Sendable], schemaName: "LineItem")
+        XCTAssertEqual((valid as? [String: any Sendable])?["quantity"] as? Int, 2)
+
+        XCTAssertThrowsError(
+            try lineItem.validate(["product": product, "quantity": "two"] as [String: any Sendable], schemaName: "LineItem")
+        ) { error in
+            guard case .invalidPropertyType(_, let property, let expected, _) = error as? SchemaValidationError else {
+                return XCTFail("Expected invalidPropertyType, got \(error)")
+            }
+            XCTAssertEqual(property, "quantity")
+            XCTAssertEqual(expected, "integer")
+        }
+    }
+
+    func testEnumSetMatchesIntegersAsDoubles() throws {
+        let schema = Schema(type: "number", enumValues: [.int(1), .int(2), .double(2.5)])
+        let compiled = CompiledSchema(schema, components: nil)
+
+        XCTAssertEqual(try compiled.parseValue(2) as? Double, 2)
+        XCTAssertEqual(try compiled.parseValue(2.5) as? Double, 2.5)
+        XCTAssertThrowsError(try compiled.parseValue(3)) { error in
+            XCTAssertEqual(error as? SchemaBindingError, .enumViolation(value: "3.0", allowed: "1, 2, 2.5"))
+        }
+    }
+
+    // MARK: - References and cycles
+
+    func testRecursiveSchemaResolvesToIndexCycle() throws {
+        let node = Schema(
+            type: "object",
+            properties: [
+                "name": SchemaRef(Schema(type: "string")),
+                "children": SchemaRef(Schema(type: "array", items: SchemaRef(Schema(ref: "#/components/schemas/Node"))))
+            ],
+            required: ["name"]
+        )
+        let program = SchemaCompiler(components: components(["Node": node])).build()
+        let compiled = try XCTUnwrap(program.component(named: "Node"))
+
+        let tree: [String: Any] = ["name": "root", "children": [["name": "leaf", "children": [Any]()] as [String: Any]]]
+        XCTAssertNoThrow(try compiled.parseValue(tree))
+        let orphan: [String: Any] = ["name": "root", "children": [["children": [Any]()]]]
+        XCTAssertThrowsError(try compiled.parseValue(orphan))
+        XCTAssertTrue(program.cycles.isEmpty)
+    }
+
+    func testRefLoopIsReportedAndFailsInsteadOfRecursing() throws {
+        let program = SchemaCompiler(components: components([
+            "A": Schema(ref: "#/components/schemas/B"),
+            "B": Schema(ref: "#/components/schemas/A")
+        ])).build()
+
+        XCTAssertEqual(program.cycles.count, 1)
+        let compiled = try XCTUnwrap(program.component(named: "A"))
+        XCTAssertThrowsError(try compiled.parseValue("x")) { error in
+            guard case .invalidReference(let ref) = error as? SchemaBindingError else {
+                return XCTFail("Expected invalidReference, got \(error)")
+            }
+            XCTAssertTrue(ref.hasPrefix("circular $ref"))
+        }
+    }
+
+    func testCompositionLoopThroughDiscriminatorFails() throws {
+        // Pet selects Cat by discriminator; Cat is allOf [Pet, ...]
+        let pet = Schema(
+            oneOf: [SchemaRef(Schema(ref: "#/components/schemas/Cat"))],
+            discriminator: Discriminator(propertyName: "kind", mapping: ["cat": "#/components/schemas/Cat"])
+        )
+        let cat = Schema(allOf: [
+            SchemaRef(Schema(ref: "#/components/schemas/Pet")),
+            SchemaRef(Schema(type: "object", properties: ["kind": SchemaRef(Schema(type: "string"))]))
+        ])
+        let program = SchemaCompiler(components: components(["Pet": pet, "Cat": cat])).build()
+        let compiled = try XCTUnwrap(program.component(named: "Pet"))
+
+        XCTAssertThrowsError(try compiled.parseValue(["kind": "cat"])) { error in
+            guard case .compositionFailed = error as? SchemaBindingError else {
+                return XCTFail("Expected compositionFailed, got \(error)")
+            }
+        }
+    }
+
+    func testUnresolvableRefFailsWhenReached() throws {
+        let schema = Schema(type: "object", properties: [
+            "owner": SchemaRef(Schema(ref: "#/components/schemas/Missing"))
+        ])
+        let compiled = CompiledSchema(schema, components: nil)
+
+        XCTAssertNoThrow(try compiled.parseValue([String: Any]()))
+        XCTAssertThrowsError(try compiled.parseValue(["owner": "x"])) { error in
+            XCTAssertEqual(error as? SchemaBindingError, .invalidReference("#/components/schemas/Missing"))
+        }
+    }
+
+    // MARK: - Routes
+
+    func testRouteMatchCarriesCompiledResponseSchemas() throws {
+        let operation = Operation(
+            operationId: "getOrder",
+            responses: ["200": OpenAPIResponse(
+                description: "ok",
+                headers: nil,
+                content: ["application/json": MediaType(schema: SchemaRef(Schema(ref: "#/components/schemas/Order")))],
+                ref: nil
+            )]
+        )
+        let spec = OpenAPISpec(
+            openapi: "3.0.3",
+            info: OpenAPIInfo(title: "Orders", version: "1.0.0"),
+            paths: ["/orders/{id}": PathItem(
+                get: operation, post: nil, put: nil, patch: nil, delete: nil,
+                head: nil, options: nil, trace: nil, parameters: nil
+            )],
+            components: orderComponents()
+        )
+        let match = try XCTUnwrap(OpenAPIRouteRegistry(spec: spec).match(method: "GET", path: "/orders/1"))
+        XCTAssertNotNil(match.responseSchemas["200"])
+
+        XCTAssertNil(SchemaBinding.validateResponseBody(
+            orderBody(items: 2), forStatusCode: 200, operation: match.operation, compiled: match.responseSchemas
+        ))
+        XCTAssertNotNil(SchemaBinding.validateResponseBody(
+            ["id": "order-1"], forStatusCode: 200, operation: match.operation, compiled: match.responseSchemas
+        ))
+    }
+
+    // MARK: - Benchmark
+
+    func testBenchmarkTreeWalkerNestedBodies() throws {
+        let comps = orderComponents()
+        let schema = try XCTUnwrap(comps.schemas?["Order"]?.value)
+        let bodies = (0..<50).map { _ in orderBody(items: 20) }
+        measure {
+            for body in bodies {
+                _ = try? SchemaBinding.parseValue(json: body, schema: schema, components: comps)
+            }
+        }
+    }
+
+    func testBenchmarkCompiledNestedBodies() throws {
+        let compiled = try compiledOrder(orderComponents())
+        let bodies = (0..<50).map { _ in orderBody(items: 20) }
+        measure {
+            for body in bodies {
+                _ = try? compiled.parseValue(body)
+            }
+        }
+    }
+}
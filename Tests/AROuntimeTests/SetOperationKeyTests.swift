@@ -0,0 +1,245 @@
+// ============================================================
+// SetOperationKeyTests.swift
+// ARO Runtime - Keys for Compute set operations
+// ============================================================
+//
+// The property tests run the set operations on random nested values and
+// compare them with the previous implementation (LegacySetOperations,
+// below, keyed by `hashKey` exactly as it was), comparing results by
+// type with TypedValue. The generator includes values that only render
+// alike ("1" and 1, "[a,b]" and ["a", "b"]), which must still match
+// each other. The `measure` tests are the
+// benchmark, 1M records per input; they run only with ARO_BENCHMARKS set
+// (BenchmarkGate).
+
+import XCTest
+@testable import ARORuntime
+
+final class SetOperationKeyTests: XCTestCase {
+
+    // MARK: - Generator
+
+    /// SplitMix64, seeded so failures reproduce
+    private struct Generator {
+        var state: UInt64
+
+        mutating func next(_ bound: Int) -> Int {
+            state &+= 0x9E37_79B9_7F4A_7C15
+            var z = state
+            z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+            z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+            return Int((z ^ (z >> 31)) % UInt64(bound))
+        }
+
+        /// Includes strings that render like other values, and
+        /// precomposed and decomposed "é", which compare equal
+        private static let strings = [
+            "alpha", "beta", "\u{E9}t\u{E9}", "e\u{301}te\u{301}",
+            "", "1", "true", "0.5", "nan", "-0.0", "[1,2]", "[]", "a,b", "{a:1}", "1,2",
+        ]
+        private static let doubles: [Double] = [0.5, -0.0, 0.0, 1.0, .nan, 2.25]
+
+        mutating func value(depth: Int = 0) -> any Sendable {
+            switch next(depth < 2 ? 7 : 5) {
+            case 0: return next(4)
+            case 1: return Self.doubles[next(Self.doubles.count)]
+            case 2, 3: return Self.strings[next(Self.strings.count)]
+            case 4: return next(2) == 0
+            case 5: return (0..<next(3)).map { _ in value(depth: depth + 1) } as [any Sendable]
+            default:
+                var object: [String: any Sendable] = [:]
+                for key in ["a", "b", "c"] where next(2) == 0 {
+                    object[key] = value(depth: depth + 1)
+                }
+                return object
+            }
+        }
+
+        mutating func list() -> [any Sendable] {
+            (0..<next(24)).map { _ in value() }
+        }
+    }
+
+    /// Results must hold the same elements, type included, in order
+    private func assertSameElements(
+        _ result: any Sendable,
+        _ expected: [any Sendable],
+        file: StaticString = #filePath,
+        line: UInt = #line
+    ) throws {
+        let actual = try XCTUnwrap(result as? [any Sendable], file: file, line: line)
+        XCTAssertEqual(actual.map(TypedValue.init), expected.map(TypedValue.init), file: file, line: line)
+    }
+
+    // MARK: - Properties
+
+    func testSetOperationsMatchLegacyImplementation() throws {
+        let compute = ComputeAction()
+        var generator = Generator(state: 0xA20_0042)
+        for _ in 0..<500 {
+            let a = generator.list()
+            let b = generator.list()
+            try assertSameElements(compute.computeIntersect(a, with: b), LegacySetOperations.intersect(a, b))
+            try assertSameElements(compute.computeDifference(a, minus: b), LegacySetOperations.difference(a, b))
+            try assertSameElements(compute.computeUnion(a, with: b), LegacySetOperations.union(a, b))
+        }
+    }
+
+    func testKeysMatchExactlyWhenLegacyKeysMatch() {
+        var generator = Generator(state: 7)
+        for _ in 0..<2_000 {
+            let x = generator.value()
+            let y = generator.value()
+            let same = LegacySetOperations.hashKey(for: x) == LegacySetOperations.hashKey(for: y)
+            XCTAssertEqual(SetOperationKey(x) == SetOperationKey(y), same, "\(x) vs \(y)")
+            if same {
+                XCTAssertEqual(SetOperationKey(x).hashValue, SetOperationKey(y).hashValue)
+            }
+        }
+    }
+
+    func testDictionaryKeyOrderDoesNotMatter() {
+        let first: [String: any Sendable] = ["id": 1, "tags": ["x", "y"] as [any Sendable], "score": 2.5]
+        var second: [String: any Sendable] = [:]
+        for key in first.keys.sorted().reversed() {
+            second[key] = first[key]
+        }
+        XCTAssertEqual(SetOperationKey(first), SetOperationKey(second))
+        XCTAssertNotEqual(SetOperationKey(first), SetOperationKey(["id": 1, "tags": ["y", "x"] as [any Sendable], "score": 2.5] as [String: any Sendable]))
+    }
+
+    func testValuesRenderedAlikeStillMatch() throws {
+        let compute = ComputeAction()
+        let lhs: [any Sendable] = ["1", "true", ["a,b"] as [any Sendable], "[x,y]"]
+        let rhs: [any Sendable] = [1, true, ["a", "b"] as [any Sendable], ["x", "y"] as [any Sendable]]
+
+        try assertSameElements(compute.computeIntersect(lhs, with: rhs), lhs)
+        try assertSameElements(compute.computeDifference(lhs, minus: rhs), [])
+        try assertSameElements(compute.computeUnion(lhs, with: rhs), lhs)
+    }
+
+    func testHashesFollowTheRenderingAcrossShapes() {
+        let pairs: [(any Sendable, any Sendable)] = [
+            (-42, "-42"),
+            (Int.min, String(Int.min)),
+            (["a:1,b": 2] as [String: any Sendable], ["a": 1, "b": 2] as [String: any Sendable]),
+            ("{a:1,b:2}", ["b": 2, "a": 1] as [String: any Sendable]),
+            (["e\u{301}", 1] as [any Sendable], "[\u{E9},1]"),
+        ]
+        for (x, y) in pairs {
+            XCTAssertEqual(SetOperationKey(x), SetOperationKey(y), "\(x) vs \(y)")
+            XCTAssertEqual(SetOperationKey(x).hashValue, SetOperationKey(y).hashValue, "\(x) vs \(y)")
+        }
+        XCTAssertNotEqual(SetOperationKey(0.0), SetOperationKey(-0.0))
+        XCTAssertNotEqual(SetOperationKey(["a": 1] as [String: any Sendable]), SetOperationKey(["a": "1 "] as [String: any Sendable]))
+    }
+
+    // MARK: - Benchmark
+
+    private static func records(_ range: Range<Int>) -> [any Sendable] {
+        range.map { i -> any Sendable in
+            ["id": i, "name": "user-\(i)", "active": i % 2 == 0] as [String: any Sendable]
+        }
+    }
+
+    func testBenchmarkIntersectMillionRecords() throws {
+        try BenchmarkGate.require()
+        let a = Self.records(0..<1_000_000)
+        let b = Self.records(500_000..<1_500_000)
+        measure {
+            let result = try? ComputeAction().computeIntersect(a, with: b)
+            XCTAssertEqual((result as? [any Sendable])?.count, 500_000)
+        }
+    }
+
+    func testBenchmarkDifferenceMillionRecords() throws {
+        try BenchmarkGate.require()
+        let a = Self.records(0..<1_000_000)
+        let b = Self.records(500_000..<1_500_000)
+        measure {
+            let result = try? ComputeAction().computeDifference(a, minus: b)
+            XCTAssertEqual((result as? [any Sendable])?.count, 500_000)
+        }
+    }
+
+    func testBenchmarkUnionMillionRecords() throws {
+        try BenchmarkGate.require()
+        let a = Self.records(0..<1_000_000)
+        let b = Self.records(500_000..<1_500_000)
+        measure {
+            let result = try? ComputeAction().computeUnion(a, with: b)
+            XCTAssertEqual((result as? [any Sendable])?.count, 1_500_000)
+        }
+    }
+}
+
+// MARK: - Legacy Implementation
+
+/// The list set operations as they were before `SetOperationKey`, keyed
+/// by `hashKey`, copied unchanged from ComputeAction
+private enum LegacySetOperations {
+    static func hashKey(for value: any Sendable) -> String {
+        if let dict = value as? [String: any Sendable] {
+            // Sort keys for consistent hashing
+            let sorted = dict.keys.sorted().map { key -> String in
+                let v = dict[key]!
+                return "\(key):\(hashKey(for: v))"
+            }
+            return "{\(sorted.joined(separator: ","))}"
+        }
+        if let arr = value as? [any Sendable] {
+            return "[\(arr.map { hashKey(for: $0) }.joined(separator: ","))]"
+        }
+        return String(describing: value)
+    }
+
+    static func intersect(_ a: [any Sendable], _ b: [any Sendable]) -> [any Sendable] {
+        var bCounts: [String: Int] = [:]
+        for item in b {
+            let key = hashKey(for: item)
+            bCounts[key, default: 0] += 1
+        }
+
+        var result: [any Sendable] = []
+        for item in a {
+            let key = hashKey(for: item)
+            if let count = bCounts[key], count > 0 {
+                result.append(item)
+                bCounts[key] = count - 1
+            }
+        }
+        return result
+    }
+
+    static func difference(_ a: [any Sendable], _ b: [any Sendable]) -> [any Sendable] {
+        var bCounts: [String: Int] = [:]
+        for item in b {
+            let key = hashKey(for: item)
+            bCounts[key, default: 0] += 1
+        }
+
+        var result: [any Sendable] = []
+        for item in a {
+            let key = hashKey(for: item)
+            if let count = bCounts[key], count > 0 {
+                bCounts[key] = count - 1
+            } else {
+                result.append(item)
+            }
+        }
+        return result
+    }
+
+    static func union(_ a: [any Sendable], _ b: [any Sendable]) -> [any Sendable] {
+        var result = a
+        var seen = Set(a.map { hashKey(for: $0) })
+        for item in b {
+            let key = hashKey(for: item)
+            if !seen.contains(key) {
+                seen.insert(key)
+                result.append(item)
+            }
+        }
+        return result
+    }
+}
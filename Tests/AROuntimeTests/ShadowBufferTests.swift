@@ -0,0 +1,146 @@
+// ============================================================
+// ShadowBufferTests.swift
+// ARO Runtime - Shadow buffer frame encoding tests (ARO-0053)
+// ============================================================
+
+import Foundation
+import Testing
+@testable import ARORuntime
+
+/// Collects frames handed to a ShadowBuffer sink
+private final class FrameCapture {
+    var frames: [String] = []
+
+    var sink: ShadowBuffer.FrameSink {
+        { [unowned self] raw in
+            self.frames.append(String(decoding: raw, as: UTF8.self))
+        }
+    }
+}
+
+@Suite("Shadow Buffer Tests")
+struct ShadowBufferTests {
+
+    @Test("A full redraw is flushed with a single write")
+    func testSingleWritePerFrame() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 60, cols: 200, sink: capture.sink)
+
+        for row in 0..<60 {
+            buffer.setText(row: row, col: 0, text: String(repeating: "x", count: 200), fgColor: .green)
+        }
+        buffer.render()
+
+        #expect(capture.frames.count == 1)
+    }
+
+    @Test("Rendering without changes does not write")
+    func testCleanRenderSkipsWrite() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 5, cols: 10, sink: capture.sink)
+
+        buffer.render()
+        buffer.setText(row: 0, col: 0, text: "hi")
+        buffer.render()
+        // Same content again: dirty spans are recorded but no cell differs
+        buffer.setCell(row: 0, col: 0, char: "h")
+        buffer.render()
+
+        #expect(capture.frames.count == 1)
+    }
+
+    @Test("Sequential cells share one cursor move")
+    func testSequentialCellsEncoding() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 5, cols: 10, synchronizedOutput: false, sink: capture.sink)
+
+        buffer.setText(row: 1, col: 2, text: "abc")
+        buffer.render()
+
+        #expect(capture.frames == ["\u{1B}[2;3Habc\u{1B}[0m"])
+    }
+
+    @Test("Small gaps on a row use cursor-forward, rows use absolute moves")
+    func testCursorMovement() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 5, cols: 20, synchronizedOutput: false, sink: capture.sink)
+
+        buffer.setCell(row: 0, col: 0, char: "a")
+        buffer.setCell(row: 0, col: 3, char: "b")
+        buffer.setCell(row: 2, col: 0, char: "c")
+        buffer.render()
+
+        #expect(capture.frames == ["\u{1B}[1;1Ha\u{1B}[2Cb\u{1B}[3;1Hc\u{1B}[0m"])
+    }
+
+    @Test("Style changes emit minimal SGR sequences")
+    func testStyleTransitions() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 1, cols: 10, synchronizedOutput: false, sink: capture.sink)
+
+        buffer.setCell(row: 0, col: 0, char: "a", fgColor: .red)
+        buffer.setCell(row: 0, col: 1, char: "b", fgColor: .red)
+        buffer.setCell(row: 0, col: 2, char: "c")
+        buffer.setCell(row: 0, col: 3, char: "d", bold: true)
+        buffer.setCell(row: 0, col: 4, char: "e", fgColor: .blue)
+        buffer.render()
+
+        #expect(capture.frames == [
+            "\u{1B}[1;1H\u{1B}[38;5;1mab\u{1B}[39mc\u{1B}[1md\u{1B}[0;38;5;4me\u{1B}[0m"
+        ])
+    }
+
+    @Test("Frames are wrapped in synchronized-update markers when enabled")
+    func testSynchronizedOutput() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 2, cols: 2, sink: capture.sink)
+
+        buffer.setCell(row: 0, col: 0, char: "é")
+        buffer.render()
+
+        #expect(capture.frames == ["\u{1B}[?2026h\u{1B}[1;1Hé\u{1B}[0m\u{1B}[?2026l"])
+    }
+
+    @Test("Only changed cells are re-emitted and forceRefresh redraws everything")
+    func testIncrementalAndForcedRedraw() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 1, cols: 3, synchronizedOutput: false, sink: capture.sink)
+
+        buffer.setText(row: 0, col: 0, text: "abc")
+        buffer.render()
+        buffer.setText(row: 0, col: 0, text: "aXc")
+        buffer.render()
+        buffer.forceRefresh()
+
+        #expect(capture.frames == [
+            "\u{1B}[1;1Habc\u{1B}[0m",
+            "\u{1B}[1;2HX\u{1B}[0m",
+            "\u{1B}[1;1HaXc\u{1B}[0m",
+        ])
+    }
+
+    @Test("Resizing preserves content that fits")
+    func testResizePreservesContent() {
+        let capture = FrameCapture()
+        let buffer = ShadowBuffer(rows: 3, cols: 3, sink: capture.sink)
+        buffer.setText(row: 2, col: 0, text: "xyz", fgColor: .cyan)
+
+        let resized = buffer.resizedBuffer(rows: 4, cols: 2)
+
+        let dims = resized.getDimensions()
+        #expect(dims.rows == 4)
+        #expect(dims.cols == 2)
+        #expect(resized.cell(row: 2, col: 1) == ScreenCell(char: "y", fgColor: .cyan))
+        #expect(resized.cell(row: 2, col: 2) == nil)
+    }
+
+    @Test("FrameEncoder encodes decimals directly")
+    func testDecimalEncoding() {
+        var encoder = FrameEncoder()
+        for value in [0, 7, 10, 199, 1000] {
+            encoder.append(decimal: value)
+            encoder.append(byte: UInt8(ascii: ","))
+        }
+        #expect(String(decoding: encoder.bytes, as: UTF8.self) == "0,7,10,199,1000,")
+    }
+}
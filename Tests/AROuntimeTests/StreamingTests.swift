@@ -721,4 +721,122 @@ struct JSONStreamParserTests {
         #expect(result.count == 1)
         #expect(result[0]["id"] as? Int == 1)
     }
+
+    // MARK: - Byte-Level Scanner
+
+    private func writeTemp(_ contents: String) throws -> URL {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("test-\(UUID()).jsonl")
+        try contents.write(to: url, atomically: true, encoding: .utf8)
+        return url
+    }
+
+    @Test("Malformed lines are skipped by default")
+    func testMalformedLinesSkipped() async throws {
+        let testFile = try writeTemp(#"""
+        {"id": 1}
+        {"id": 2,}
+        {"id": 03}
+        {"id": "unterminated}
+        [1, 2]
+        {"id": tru}
+        {"id": 4} trailing
+        {"id": "tab\#tinside"}
+        {"id": 1.}
+        {id: 5}
+        {"id": 6}
+        """#)
+        defer { try? FileManager.default.removeItem(at: testFile) }
+
+        let result = try await JSONStreamParser.stream(path: testFile.path).collect()
+        #expect(result.map { $0["id"] as? Int } == [1, 6])
+    }
+
+    @Test("Malformed line throws with its line number when not skipping")
+    func testMalformedLineThrows() async throws {
+        let testFile = try writeTemp("""
+        {"id": 1}
+        # comment lines count too
+        {"id": 2, "tags": ["a" "b"]}
+        {"id": 3}
+        """)
+        defer { try? FileManager.default.removeItem(at: testFile) }
+
+        let config = JSONStreamParser.Config(jsonlMode: true, skipMalformed: false)
+        do {
+            _ = try await JSONStreamParser.stream(path: testFile.path, config: config).collect()
+            Issue.record("expected a malformed line error")
+        } catch let error as JSONStreamError {
+            guard case .malformedJSON(let detail) = error else {
+                Issue.record("unexpected error \(error)")
+                return
+            }
+            #expect(detail.hasPrefix("line 3:"))
+        }
+    }
+
+    @Test("Overlong lines are skipped or rejected")
+    func testOverlongLines() async throws {
+        let long = String(repeating: "x", count: 100)
+        let testFile = try writeTemp("{\"id\": 1}\n{\"id\": 2, \"pad\": \"\(long)\"}\n{\"id\": 3}\n")
+        defer { try? FileManager.default.removeItem(at: testFile) }
+
+        let skipping = JSONStreamParser.Config(jsonlMode: true, maxLineLength: 64)
+        let rows = try await JSONStreamParser.stream(path: testFile.path, config: skipping).collect()
+        #expect(rows.map { $0["id"] as? Int } == [1, 3])
+
+        let strict = JSONStreamParser.Config(jsonlMode: true, skipMalformed: false, maxLineLength: 64)
+        await #expect(throws: JSONStreamError.self) {
+            _ = try await JSONStreamParser.stream(path: testFile.path, config: strict).collect()
+        }
+    }
+
+    @Test("Values are built with the runtime's types")
+    func testValueTypes() async throws {
+        let testFile = try writeTemp(#"""
+        {"s": "q\"b\\s\/\u00e9\ud83d\ude00\n", "i": -12, "d": 1.5e2, "big": 12345678901234567890, "n": null, "t": true, "f": false, "a": [1, [2.5], {}], "o": {"k": "v"}}
+        """# + "\r\n")
+        defer { try? FileManager.default.removeItem(at: testFile) }
+
+        let rows = try await JSONStreamParser.stream(path: testFile.path).collect()
+        let row = try #require(rows.first)
+        #expect(row["s"] as? String == "q\"b\\s/\u{E9}\u{1F600}\n")
+        #expect(row["i"] as? Int == -12)
+        #expect(row["d"] as? Double == 150)
+        #expect(row["big"] as? Double == 12345678901234567890)
+        #expect(row["n"] as? String == "null")
+        #expect(row["t"] as? Bool == true)
+        #expect(row["f"] as? Bool == false)
+        let array = try #require(row["a"] as? [any Sendable])
+        #expect(array[0] as? Int == 1)
+        #expect((array[1] as? [any Sendable])?.first as? Double == 2.5)
+        #expect((array[2] as? [String: any Sendable])?.isEmpty == true)
+        #expect((row["o"] as? [String: any Sendable])?["k"] as? String == "v")
+    }
+
+    @Test("Lines longer than the read buffer are reassembled")
+    func testLineLargerThanBuffer() async throws {
+        let big = String(repeating: "y", count: 3 * JSONLineScanner.chunkSize)
+        let testFile = try writeTemp("{\"id\": 1}\n{\"id\": 2, \"big\": \"\(big)\"}\n{\"id\": 3}")
+        defer { try? FileManager.default.removeItem(at: testFile) }
+
+        let rows = try await JSONStreamParser.stream(path: testFile.path).collect()
+        #expect(rows.map { $0["id"] as? Int } == [1, 2, 3])
+        #expect((rows[1]["big"] as? String)?.count == big.count)
+    }
+
+    @Test("Parallel parsing keeps file order")
+    func testParallelParsingKeepsOrder() async throws {
+        var lines: [String] = []
+        for id in 0..<20_000 {
+            lines.append(id % 997 == 0 ? "{\"id\": \(id), broken" : "{\"id\": \(id), \"name\": \"user-\(id)\"}")
+        }
+        let testFile = try writeTemp(lines.joined(separator: "\n"))
+        defer { try? FileManager.default.removeItem(at: testFile) }
+
+        let config = JSONStreamParser.Config(jsonlMode: true, parallelism: 4)
+        let rows = try await JSONStreamParser.stream(path: testFile.path, config: config).collect()
+        let expected = (0..<20_000).filter { $0 % 997 != 0 }
+        #expect(rows.map { $0["id"] as? Int } == expected)
+        #expect(rows.last?["name"] as? String == "user-19999")
+    }
 }
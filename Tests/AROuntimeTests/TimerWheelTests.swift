@@ -0,0 +1,254 @@
+// ============================================================
+// TimerWheelTests.swift
+// ARO Runtime - Hierarchical timing wheel
+// ============================================================
+//
+// Most tests drive the wheel with a virtual clock and no driver thread,
+// so every firing time is exact. The `measure` test is the benchmark:
+// 100k timers scheduled, half cancelled, the rest fired.
+
+import XCTest
+@testable import ARORuntime
+
+final class TimerWheelTests: XCTestCase {
+
+    private static let ms: UInt64 = 1_000_000
+
+    /// Clock that only moves when the test says so
+    private final class VirtualClock: TimerClock, @unchecked Sendable {
+        private let lock = NSLock()
+        private var current: UInt64 = 0
+
+        func now() -> UInt64 {
+            lock.withLock { current }
+        }
+
+        func set(milliseconds: UInt64) {
+            lock.withLock { current = milliseconds * TimerWheelTests.ms }
+        }
+    }
+
+    /// Thread-safe record of what fired and when
+    private final class Firings: @unchecked Sendable {
+        private let lock = NSLock()
+        private var values: [String] = []
+
+        func record(_ value: String) {
+            lock.withLock { values.append(value) }
+        }
+
+        var all: [String] {
+            lock.withLock { values }
+        }
+
+        func count(of value: String) -> Int {
+            lock.withLock { values.filter { $0 == value }.count }
+        }
+    }
+
+    private func makeWheel(_ clock: VirtualClock) -> TimerWheel {
+        TimerWheel(clock: clock, tickNanoseconds: Self.ms, startsDriver: false)
+    }
+
+    /// Step the clock one millisecond at a time, advancing after each step
+    private func step(_ wheel: TimerWheel, _ clock: VirtualClock, through milliseconds: ClosedRange<UInt64>) {
+        for t in milliseconds {
+            clock.set(milliseconds: t)
+            wheel.advance()
+        }
+    }
+
+    // MARK: - Deadlines
+
+    func testOneShotFiresAtItsDeadline() {
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+
+        wheel.schedule(after: 5 * Self.ms) { firings.record("once") }
+        XCTAssertEqual(wheel.count, 1)
+
+        clock.set(milliseconds: 4)
+        wheel.advance()
+        XCTAssertEqual(firings.all, [])
+
+        clock.set(milliseconds: 5)
+        wheel.advance()
+        XCTAssertEqual(firings.all, ["once"])
+        XCTAssertEqual(wheel.count, 0)
+
+        clock.set(milliseconds: 50)
+        wheel.advance()
+        XCTAssertEqual(firings.all, ["once"])
+    }
+
+    func testCascadedTimersFireExactlyOnTime() {
+        // Deadlines on both sides of the level boundaries (64, 64² ticks)
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+        let deadlines: [UInt64] = [3, 63, 64, 65, 4095, 4096, 4097, 70_000, 300_000]
+
+        for deadline in deadlines.shuffled() {
+            wheel.schedule(after: deadline * Self.ms) {
+                firings.record("\(deadline)@\(clock.now() / TimerWheelTests.ms)")
+            }
+        }
+        step(wheel, clock, through: 1...300_000)
+
+        XCTAssertEqual(firings.all, deadlines.map { "\($0)@\($0)" })
+        XCTAssertEqual(wheel.count, 0)
+    }
+
+    func testLargeJumpFiresEverythingDueInOneAdvance() {
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+
+        for deadline: UInt64 in [1, 500, 90_000] {
+            wheel.schedule(after: deadline * Self.ms) { firings.record("\(deadline)") }
+        }
+        clock.set(milliseconds: 100_000)
+        wheel.advance()
+
+        XCTAssertEqual(firings.all, ["1", "500", "90000"])
+    }
+
+    // MARK: - Cancellation
+
+    func testCancelRemovesTimerAndStaleHandlesAreIgnored() {
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+
+        let first = wheel.schedule(after: 10 * Self.ms) { firings.record("first") }
+        XCTAssertTrue(wheel.cancel(first))
+        XCTAssertFalse(wheel.cancel(first))
+        XCTAssertEqual(wheel.count, 0)
+
+        // Reuses the freed entry; the old handle must not cancel it
+        let second = wheel.schedule(after: 10 * Self.ms) { firings.record("second") }
+        XCTAssertNotEqual(first, second)
+        XCTAssertFalse(wheel.cancel(first))
+
+        step(wheel, clock, through: 1...20)
+        XCTAssertEqual(firings.all, ["second"])
+        XCTAssertFalse(wheel.cancel(second))
+    }
+
+    func testCancelInMiddleOfSlotKeepsNeighbours() {
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+
+        let handles = (0..<5).map { index in
+            wheel.schedule(after: 7 * Self.ms) { firings.record("\(index)") }
+        }
+        XCTAssertTrue(wheel.cancel(handles[2]))
+        XCTAssertTrue(wheel.cancel(handles[4]))
+
+        step(wheel, clock, through: 1...7)
+        XCTAssertEqual(Set(firings.all), ["0", "1", "3"])
+    }
+
+    func testActionsMayScheduleAndCancelReentrantly() {
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+
+        let victim = wheel.schedule(after: 20 * Self.ms) { firings.record("victim") }
+        wheel.schedule(after: 5 * Self.ms) {
+            wheel.cancel(victim)
+            wheel.schedule(after: 5 * TimerWheelTests.ms) { firings.record("follow-up") }
+        }
+
+        step(wheel, clock, through: 1...30)
+        XCTAssertEqual(firings.all, ["follow-up"])
+    }
+
+    // MARK: - Periodic Timers
+
+    func testPeriodicTimerKeepsPhaseUnderIrregularAdvances() {
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+
+        wheel.schedule(after: 10 * Self.ms, every: 10 * Self.ms) { firings.record("tick") }
+
+        // Advances every 7 ms: each period still ends at a multiple of 10
+        var t: UInt64 = 0
+        while t < 105 {
+            t += 7
+            clock.set(milliseconds: t)
+            wheel.advance()
+        }
+        XCTAssertEqual(firings.count(of: "tick"), 10)
+        XCTAssertEqual(wheel.count, 1)
+    }
+
+    func testCatchUpPolicies() {
+        let clock = VirtualClock()
+        let wheel = makeWheel(clock)
+        let firings = Firings()
+
+        let policies: [(String, TimerCatchUp)] = [("skip", .skip), ("once", .fireOnce), ("all", .fireAll)]
+        for (name, policy) in policies {
+            wheel.schedule(after: 10 * Self.ms, every: 10 * Self.ms, catchUp: policy) {
+                firings.record(name)
+            }
+        }
+
+        // Periods ending at 10...50 ms all elapsed before the first advance
+        clock.set(milliseconds: 55)
+        wheel.advance()
+        XCTAssertEqual(firings.count(of: "skip"), 0)
+        XCTAssertEqual(firings.count(of: "once"), 1)
+        XCTAssertEqual(firings.count(of: "all"), 5)
+
+        // Every policy is back in phase for the period ending at 60 ms
+        clock.set(milliseconds: 60)
+        wheel.advance()
+        XCTAssertEqual(firings.count(of: "skip"), 1)
+        XCTAssertEqual(firings.count(of: "once"), 2)
+        XCTAssertEqual(firings.count(of: "all"), 6)
+    }
+
+    // MARK: - Driver
+
+    func testDriverThreadFiresOnMonotonicClock() {
+        let wheel = TimerWheel(clock: MonotonicTimerClock(), tickNanoseconds: Self.ms)
+        defer { wheel.shutdown() }
+
+        let fired = expectation(description: "timer fired")
+        let ticks = expectation(description: "periodic ticks")
+        ticks.expectedFulfillmentCount = 3
+        wheel.schedule(after: 20 * Self.ms) { fired.fulfill() }
+        let periodic = wheel.schedule(after: 5 * Self.ms, every: 5 * Self.ms) { ticks.fulfill() }
+
+        wait(for: [fired, ticks], timeout: 5)
+        XCTAssertTrue(wheel.cancel(periodic))
+    }
+
+    // MARK: - Benchmark
+
+    func testBenchmarkHundredThousandTimers() {
+        let delays: [UInt64] = (0..<100_000).map { _ in UInt64.random(in: 1...600_000) }
+        measure {
+            let clock = VirtualClock()
+            let wheel = makeWheel(clock)
+            let firings = Firings()
+
+            let handles = delays.map { delay in
+                wheel.schedule(after: delay * Self.ms) { firings.record("") }
+            }
+            for (index, handle) in handles.enumerated() where index.isMultiple(of: 2) {
+                wheel.cancel(handle)
+            }
+            let remaining = wheel.count
+
+            clock.set(milliseconds: 600_000)
+            wheel.advance()
+            XCTAssertEqual(firings.all.count, remaining)
+        }
+    }
+}
@@ -0,0 +1,63 @@
+// ============================================================
+// TypedValue.swift
+// ARO Runtime Tests - Compare runtime values by type and structure
+// ============================================================
+//
+// Format and set-operation tests compare results with expected values
+// through this wrapper. Unlike `SetOperationKey`, equality is by type
+// and value: the string "1" and the integer 1 differ, and so do the
+// lists ["a,b"] and ["a", "b"]. Doubles compare by bit pattern with
+// NaNs folded together. Other types fall back to their description.
+
+import Foundation
+
+/// A runtime value compared by type and structure in assertions.
+struct TypedValue: Equatable, CustomStringConvertible, @unchecked Sendable {
+    let value: any Sendable
+
+    init(_ value: any Sendable) {
+        self.value = value
+    }
+
+    var description: String { String(describing: value) }
+
+    static func == (lhs: TypedValue, rhs: TypedValue) -> Bool {
+        isEqual(lhs.value, rhs.value)
+    }
+
+    private static func isEqual(_ lhs: any Sendable, _ rhs: any Sendable) -> Bool {
+        if let a = lhs as? Int {
+            return (rhs as? Int) == a
+        }
+        if let a = lhs as? Double {
+            return (rhs as? Double).map { bits(of: $0) == bits(of: a) } ?? false
+        }
+        if let a = lhs as? String {
+            return (rhs as? String) == a
+        }
+        if let a = lhs as? Bool {
+            return (rhs as? Bool) == a
+        }
+        if let a = lhs as? [any Sendable] {
+            guard let b = rhs as? [any Sendable], a.count == b.count else { return false }
+            return zip(a, b).allSatisfy { isEqual($0, $1) }
+        }
+        if let a = lhs as? [String: any Sendable] {
+            guard let b = rhs as? [String: any Sendable], a.count == b.count else { return false }
+            return a.allSatisfy { key, x in b[key].map { isEqual(x, $0) } ?? false }
+        }
+        guard isOther(rhs) else { return false }
+        return String(describing: lhs) == String(describing: rhs)
+    }
+
+    /// True when `value` takes the description fallback
+    private static func isOther(_ value: any Sendable) -> Bool {
+        !(value is Int || value is Double || value is String || value is Bool
+            || value is [any Sendable] || value is [String: any Sendable])
+    }
+
+    /// Bit pattern with every NaN mapped to one value
+    private static func bits(of double: Double) -> UInt64 {
+        double.isNaN ? Double.nan.bitPattern : double.bitPattern
+    }
+}
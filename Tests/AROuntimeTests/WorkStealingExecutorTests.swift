@@ -0,0 +1,96 @@
+// ============================================================
+// WorkStealingExecutorTests.swift
+// ARO Runtime - Bounded work-stealing AROFuture executor
+// ============================================================
+//
+// The work-stealing executor has a fixed worker count, so these tests
+// check the two properties that replace the elastic queue's extra
+// threads: force() runs a not-yet-started body inline, and a worker
+// that forces a running future keeps draining jobs instead of parking.
+
+import XCTest
+@testable import ARORuntime
+
+final class WorkStealingExecutorTests: XCTestCase {
+
+    func testManyFuturesStayOnFixedWorkers() async throws {
+        let pool = WorkStealingExecutor(workerCount: 2)
+        defer { pool.shutdown() }
+
+        let futures: [AROFuture] = (0..<200).map { i in
+            AROFuture(bindingName: "n\(i)", pool: pool) { @Sendable in
+                await Task.yield()
+                return Thread.current.name ?? "" as String
+            }
+        }
+        var threadNames = Set<String>()
+        for future in futures {
+            if let name = try await future.value() as? String {
+                threadNames.insert(name)
+            }
+        }
+
+        XCTAssertFalse(threadNames.isEmpty)
+        XCTAssertTrue(threadNames.allSatisfy { $0.hasPrefix("aro.action-worker.") })
+        XCTAssertLessThanOrEqual(threadNames.count, 2)
+    }
+
+    func testForcingUnstartedFutureRunsInline() throws {
+        // No workers are free: the only one is blocked until the forced
+        // future has produced its value, so the value must come from the
+        // forcing thread.
+        let pool = WorkStealingExecutor(workerCount: 1)
+        defer { pool.shutdown() }
+        let release = DispatchSemaphore(value: 0)
+        let blocker = AROFuture(bindingName: "blocker", pool: pool) { @Sendable in
+            release.wait()
+            return 0 as Int
+        }
+
+        let future = AROFuture(bindingName: "inline", pool: pool) { @Sendable in
+            try await Task.sleep(nanoseconds: 1_000_000)
+            return Thread.current.name ?? "forcer" as String
+        }
+        let name = try future.force() as? String
+        release.signal()
+
+        XCTAssertFalse(name?.hasPrefix("aro.action-worker.") ?? true)
+        XCTAssertEqual(try blocker.force() as? Int, 0)
+        XCTAssertTrue(future.isResolved)
+    }
+
+    func testCascadingForceOnSingleWorkerDoesNotDeadlock() async throws {
+        let pool = WorkStealingExecutor(workerCount: 1)
+        defer { pool.shutdown() }
+
+        let outer = AROFuture(bindingName: "outer", pool: pool) { @Sendable in
+            let inners: [AROFuture] = (0..<8).map { i in
+                AROFuture(bindingName: "inner-\(i)", pool: pool) { @Sendable in
+                    try await Task.sleep(nanoseconds: 5_000_000)
+                    return i * 2 as Int
+                }
+            }
+            var sum = 0
+            for inner in inners {
+                sum += try inner.force() as? Int ?? 0
+            }
+            return sum as Int
+        }
+        let total = try await outer.value() as? Int
+        XCTAssertEqual(total, 56)
+    }
+
+    func testErrorsPropagateThroughInlineForce() {
+        struct Boom: Error {}
+        let pool = WorkStealingExecutor(workerCount: 1)
+        defer { pool.shutdown() }
+
+        let future = AROFuture(bindingName: "failing", pool: pool) { @Sendable in
+            throw Boom()
+        }
+        XCTAssertThrowsError(try future.force()) { error in
+            XCTAssertTrue(error is Boom)
+        }
+        XCTAssertThrowsError(try future.force())
+    }
+}
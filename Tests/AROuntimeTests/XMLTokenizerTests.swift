@@ -0,0 +1,323 @@
+// ============================================================
+// XMLTokenizerTests.swift
+// ARO Runtime - Single-pass XML deserializer and record stream
+// ============================================================
+//
+// The corpus pairs small documents with the value they deserialize
+// to; values are compared by structure and type with TypedValue.
+// Malformed documents must fail with the position of the problem.
+// The benchmarks run only with ARO_BENCHMARKS set (BenchmarkGate).
+
+import XCTest
+@testable import ARORuntime
+
+final class XMLTokenizerTests: XCTestCase {
+
+    private func parse(_ xml: String) throws -> any Sendable {
+        try XMLTreeBuilder.parse(xml)
+    }
+
+    private func assertParses(_ xml: String, to expected: any Sendable, file: StaticString = #filePath, line: UInt = #line) {
+        do {
+            let value = try parse(xml)
+            XCTAssertEqual(TypedValue(value), TypedValue(expected), "\(xml)\n→ \(value)", file: file, line: line)
+        } catch {
+            XCTFail("\(xml)\n→ \(error)", file: file, line: line)
+        }
+    }
+
+    private func syntaxError(_ xml: String) -> XMLSyntaxError? {
+        do {
+            _ = try parse(xml)
+            return nil
+        } catch {
+            return error as? XMLSyntaxError
+        }
+    }
+
+    // MARK: - Conformance Corpus
+
+    func testElementsAndScalars() {
+        assertParses("<a>5</a>", to: 5)
+        assertParses("<a>2.5</a>", to: 2.5)
+        assertParses("<a>true</a>", to: true)
+        assertParses("<a>  hello world \n</a>", to: "hello world")
+        assertParses("<a></a>", to: "")
+        assertParses("<a/>", to: "")
+        assertParses("<user><id>1</id><name>Alice</name></user>",
+                     to: ["id": 1, "name": "Alice"] as [String: any Sendable])
+        assertParses("""
+            <?xml version="1.0" encoding="UTF-8"?>
+            <!-- leading comment -->
+            <config>
+              <server>
+                <host>localhost</host>
+                <port>8080</port>
+              </server>
+            </config>
+            <!-- trailing comment -->
+            """,
+            to: ["server": ["host": "localhost", "port": 8080] as [String: any Sendable]] as [String: any Sendable])
+    }
+
+    func testRepeatedSiblingsCollectInOrder() {
+        assertParses("<r><x>1</x><y>a</y><x>2</x><x>3</x></r>",
+                     to: ["x": [1, 2, 3] as [any Sendable], "y": "a"] as [String: any Sendable])
+        // Repeated elements that are themselves lists stay separate
+        assertParses("<r><g><item>1</item><item>2</item></g><g><item>3</item></g></r>",
+                     to: ["g": [[1, 2] as [any Sendable], [3] as [any Sendable]] as [any Sendable]] as [String: any Sendable])
+        // Same tag name nested inside itself
+        assertParses("<r><n><n>inner</n></n><n>outer</n></r>",
+                     to: ["n": [["n": "inner"] as [String: any Sendable], "outer"] as [any Sendable]] as [String: any Sendable])
+    }
+
+    func testItemElementsFormAList() {
+        assertParses("<users><item><name>A</name></item><item><name>B</name></item></users>",
+                     to: [["name": "A"] as [String: any Sendable], ["name": "B"] as [String: any Sendable]] as [any Sendable])
+        assertParses("<list><item>only</item></list>", to: ["only"] as [any Sendable])
+    }
+
+    func testAttributes() {
+        assertParses(#"<user id="7" role='admin'><name>Ann</name></user>"#,
+                     to: ["@id": 7, "@role": "admin", "name": "Ann"] as [String: any Sendable])
+        assertParses(#"<price currency="EUR">9.5</price>"#,
+                     to: ["@currency": "EUR", "#text": 9.5] as [String: any Sendable])
+        assertParses(#"<e empty="" spaced="a&#10;b\#tc"/>"#,
+                     to: ["@empty": "", "@spaced": "a\nb c"] as [String: any Sendable])
+        assertParses(#"<e q="say &quot;hi&quot; &amp; go" a = "1" />"#,
+                     to: ["@q": "say \"hi\" & go", "@a": 1] as [String: any Sendable])
+    }
+
+    func testEntitiesAndCharacterReferences() {
+        assertParses("<a>&lt;b&gt; &amp; &apos;c&apos; &quot;d&quot;</a>", to: "<b> & 'c' \"d\"")
+        assertParses("<a>&#233;&#xE9;&#x1F600;</a>", to: "\u{E9}\u{E9}\u{1F600}")
+        assertParses("<a>AT&T &unknown; &#xZZ;</a>", to: "AT&T &unknown; &#xZZ;")
+        assertParses("<a>&#52;&#50;</a>", to: 42)
+    }
+
+    func testCDATA() {
+        assertParses("<a><![CDATA[<not> & markup]]></a>", to: "<not> & markup")
+        assertParses("<a><![CDATA[42]]></a>", to: "42")
+        assertParses("<a>\n  <![CDATA[  padded  ]]>\n</a>", to: "  padded  ")
+        assertParses("<a>x <![CDATA[<y>]]> z</a>", to: "x <y> z")
+        assertParses("<a><![CDATA[]]]]><![CDATA[>]]></a>", to: "]]>")
+    }
+
+    func testNamespaces() {
+        assertParses("""
+            <feed xmlns="http://www.w3.org/2005/Atom" xmlns:m="urn:meta">
+              <title>News</title>
+              <m:count>2</m:count>
+              <entry m:id="1" xml:lang="en"><title>A</title></entry>
+            </feed>
+            """,
+            to: [
+                "title": "News",
+                "count": 2,
+                "entry": ["@id": 1, "@lang": "en", "title": "A"] as [String: any Sendable],
+            ] as [String: any Sendable])
+
+        var content = "<a xmlns='urn:default' xmlns:p='urn:p'><p:b q='1'/><c xmlns=''/></a>"
+        let names: [XMLName] = content.withUTF8 { buffer in
+            var tokenizer = XMLTokenizer(buffer)
+            var names: [XMLName] = []
+            while let event = try? tokenizer.next() {
+                if case .startElement(let name, let attributes) = event {
+                    names.append(name)
+                    names.append(contentsOf: attributes.map { $0.name })
+                }
+            }
+            return names
+        }
+        XCTAssertEqual(names, [
+            XMLName(localName: "a", namespace: "urn:default"),
+            XMLName(localName: "b", namespace: "urn:p"),
+            XMLName(localName: "q", namespace: nil),
+            XMLName(localName: "c", namespace: nil),
+        ])
+    }
+
+    func testMixedContentKeepsText() {
+        assertParses("<p>Hello <b>world</b></p>", to: ["#text": "Hello", "b": "world"] as [String: any Sendable])
+    }
+
+    func testDoctypeAndProcessingInstructions() {
+        assertParses("""
+            \u{FEFF}<?xml version="1.0"?>
+            <!DOCTYPE note [
+              <!ELEMENT note (to)>
+              <!ENTITY sig "a > b">
+            ]>
+            <note><?render fast?><to>Tove</to></note>
+            """,
+            to: ["to": "Tove"] as [String: any Sendable])
+    }
+
+    // MARK: - Malformed Documents
+
+    func testMalformedDocumentsReportPosition() {
+        let cases: [(String, String, Int, Int)] = [
+            ("<a><b></a>", "expected </b>, found </a>", 1, 7),
+            ("<a>\n  <b>\n</a>", "expected </b>, found </a>", 3, 1),
+            ("<a>", "unclosed element <a>", 1, 4),
+            ("<a></a><b/>", "content after the root element", 1, 8),
+            ("<a></a>text", "content after the root element", 1, 8),
+            ("text<a/>", "text before the root element", 1, 1),
+            ("", "no root element", 1, 1),
+            ("<a x='1' x='2'/>", "duplicate attribute 'x'", 1, 10),
+            ("<a x=1/>", "expected a quoted attribute value", 1, 6),
+            ("<a x='<'/>", "'<' in attribute value", 1, 7),
+            ("<a x='1'y='2'/>", "expected whitespace before attribute", 1, 9),
+            ("<a><!-- open</a>", "unterminated comment", 1, 4),
+            ("<a><![CDATA[x</a>", "unterminated CDATA section", 1, 4),
+            ("<p:a/>", "unbound namespace prefix 'p'", 1, 2),
+            ("<1a/>", "expected a name", 1, 2),
+        ]
+        for (xml, message, line, column) in cases {
+            let error = syntaxError(xml)
+            XCTAssertEqual(error, XMLSyntaxError(message: message, line: line, column: column), xml)
+        }
+    }
+
+    func testDeserializerFallsBackToContent() {
+        let broken = "<a><b></a>"
+        XCTAssertEqual(FormatDeserializer.deserialize(broken, format: .xml) as? String, broken)
+    }
+
+    func testSerializerRoundTrip() {
+        let value: [String: any Sendable] = [
+            "id": 1,
+            "name": "A & B <c>",
+            "tags": ["x", "y"] as [any Sendable],
+            "address": ["city": "Berlin"] as [String: any Sendable],
+        ]
+        let xml = FormatSerializer.serialize(value, format: .xml, variableName: "user")
+        let parsed = FormatDeserializer.deserialize(xml, format: .xml)
+        XCTAssertEqual(TypedValue(parsed), TypedValue(value))
+    }
+
+    func testDeepNestingIsLinear() throws {
+        let depth = 10_000
+        let xml = String(repeating: "<n>", count: depth) + "leaf" + String(repeating: "</n>", count: depth)
+        var value = try parse(xml)
+        var levels = 1
+        while let map = value as? [String: any Sendable], let inner = map["n"] {
+            value = inner
+            levels += 1
+        }
+        XCTAssertEqual(levels, depth)
+        XCTAssertEqual(value as? String, "leaf")
+    }
+
+    // MARK: - Streaming
+
+    private func writeTemp(_ contents: String) throws -> URL {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("test-\(UUID()).xml")
+        try contents.write(to: url, atomically: true, encoding: .utf8)
+        return url
+    }
+
+    func testStreamsChildrenOfTheRoot() async throws {
+        let url = try writeTemp("""
+            <users>
+              <user id="1"><name>Ann</name></user>
+              <user id="2"><name>Bob</name><tags><item>a</item></tags></user>
+              <admin>Eve</admin>
+            </users>
+            """)
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let records = try await XMLStreamParser.stream(path: url.path).collect()
+        XCTAssertEqual(records.count, 3)
+        XCTAssertEqual(TypedValue(records[0]), TypedValue(["@id": 1, "name": "Ann"] as [String: any Sendable]))
+        XCTAssertEqual(TypedValue(records[1]), TypedValue([
+            "@id": 2, "name": "Bob", "tags": ["a"] as [any Sendable],
+        ] as [String: any Sendable]))
+        XCTAssertEqual(records[2]["#text"] as? String, "Eve")
+    }
+
+    func testStreamsNamedRecordsAtAnyDepth() async throws {
+        let url = try writeTemp("""
+            <export>
+              <meta><row>skipped? no</row></meta>
+              <data>
+                <row><v>1</v></row>
+                <row><v>2</v><row><v>nested</v></row></row>
+              </data>
+            </export>
+            """)
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        let records = try await AROStream.fromXML(path: url.path, recordElement: "row").collect()
+        XCTAssertEqual(records.count, 3)
+        XCTAssertEqual(records[0]["#text"] as? String, "skipped? no")
+        XCTAssertEqual(records[1]["v"] as? Int, 1)
+        XCTAssertEqual((records[2]["row"] as? [String: any Sendable])?["v"] as? String, "nested")
+    }
+
+    func testStreamReportsMalformedXML() async throws {
+        let url = try writeTemp("<rows><row>1</row><row>2</rows>")
+        defer { try? FileManager.default.removeItem(at: url) }
+
+        var received = 0
+        do {
+            for try await _ in XMLStreamParser.stream(path: url.path).stream {
+                received += 1
+            }
+            XCTFail("expected a syntax error")
+        } catch let error as XMLSyntaxError {
+            XCTAssertEqual(error.message, "expected </row>, found </rows>")
+        }
+        XCTAssertEqual(received, 1)
+    }
+
+    // MARK: - Benchmark
+
+    /// `<record>` elements with attributes, entities and CDATA: 100 MB,
+    /// or ARO_BENCHMARK_MB
+    private static let largeDocument: (bytes: [UInt8], records: Int) = {
+        let targetBytes = BenchmarkGate.bytes(defaultMegabytes: 100)
+        var xml = "<?xml version=\"1.0\"?>\n<records xmlns:x=\"urn:x\">\n"
+        var bytes = Array(xml.utf8)
+        bytes.reserveCapacity(targetBytes)
+        var i = 0
+        while bytes.count < targetBytes {
+            xml = """
+                  <record id="\(i)" x:kind="user">
+                    <name>User &amp; \(i)</name>
+                    <email>user\(i)@example.com</email>
+                    <score>\(Double(i % 1000) / 8)</score>
+                    <note><![CDATA[<b>bold</b> \(i)]]></note>
+                    <tags><item>alpha</item><item>beta</item></tags>
+                  </record>
+
+                """
+            bytes.append(contentsOf: xml.utf8)
+            i += 1
+        }
+        bytes.append(contentsOf: "</records>\n".utf8)
+        return (bytes, i)
+    }()
+
+    func testBenchmarkStreamLargeDocument() throws {
+        try BenchmarkGate.require()
+        let document = Self.largeDocument
+        measure {
+            var records = 0
+            document.bytes.withUnsafeBufferPointer { buffer in
+                XCTAssertNoThrow(try XMLStreamParser.scan(buffer, config: .init()) { _ in records += 1 })
+            }
+            XCTAssertEqual(records, document.records)
+        }
+    }
+
+    func testBenchmarkDeserializeLargeDocument() throws {
+        try BenchmarkGate.require()
+        let document = Self.largeDocument
+        let content = String(decoding: document.bytes, as: UTF8.self)
+        measure {
+            let value = FormatDeserializer.deserialize(content, format: .xml) as? [String: any Sendable]
+            XCTAssertEqual((value?["record"] as? [any Sendable])?.count, document.records)
+        }
+    }
+}
@@ -0,0 +1,625 @@
+// ============================================================
+// YAMLParserTests.swift
+// ARO Runtime - Iterative YAML parser
+// ============================================================
+//
+// Differential tests run the example fixtures and a scalar corpus
+// through both the iterative parser and a copy of the recursive parser
+// it replaced (LegacyYAML, below) and require identical values. The
+// fixtures are limited to those the old parser understood; features it
+// lacked (flow collections, anchors, multiple documents, comments after
+// values) are covered by direct tests. The benchmark runs only with
+// ARO_BENCHMARKS set (BenchmarkGate).
+
+import XCTest
+@testable import ARORuntime
+
+final class YAMLParserTests: XCTestCase {
+
+    private static func repoRoot(file: StaticString = #filePath) -> URL {
+        URL(fileURLWithPath: "\(file)")
+            .deletingLastPathComponent()
+            .deletingLastPathComponent()
+            .deletingLastPathComponent()
+    }
+
+    private func assertParses(_ yaml: String, to expected: any Sendable, file: StaticString = #filePath, line: UInt = #line) {
+        let value = YAMLParser.parse(yaml)
+        XCTAssertEqual(TypedValue(value), TypedValue(expected), "\(yaml)\n→ \(value)", file: file, line: line)
+    }
+
+    // MARK: - Differential
+
+    /// Example files written in the subset the recursive parser handled
+    private static let legacyFixtures = [
+        "Examples/AuditLogDemo/Plugins/plugin-aro-auditlog/plugin.yaml",
+        "Examples/AuditLogDemo/aro.yaml",
+        "Examples/CSVProcessor/aro.yaml",
+        "Examples/CustomPlugin/Plugins/GreetingService/plugin.yaml",
+        "Examples/CustomPlugin/aro.yaml",
+        "Examples/ExternalService/plugins/CounterPlugin/plugin.yaml",
+        "Examples/GreetingPlugin/aro.yaml",
+        "Examples/HashPluginDemo/Plugins/plugin-c-hash/plugin.yaml",
+        "Examples/HashPluginDemo/aro.yaml",
+        "Examples/MarkdownRenderer/Plugins/plugin-python-markdown/plugin.yaml",
+        "Examples/MarkdownRenderer/aro.yaml",
+        "Examples/QualifierPlugin/Plugins/plugin-swift-collection/plugin.yaml",
+        "Examples/QualifierPluginC/Plugins/plugin-c-collection/plugin.yaml",
+        "Examples/QualifierPluginPython/Plugins/plugin-python-collection/plugin.yaml",
+        "Examples/StoreFileDemo/products.store",
+        "Examples/ZipService/plugins/ZipPlugin/plugin.yaml",
+    ]
+
+    func testFixturesMatchLegacyParser() throws {
+        let root = Self.repoRoot()
+        var compared = 0
+        for path in Self.legacyFixtures {
+            let url = root.appendingPathComponent(path)
+            guard let content = try? String(contentsOf: url, encoding: .utf8) else { continue }
+            XCTAssertEqual(
+                TypedValue(YAMLParser.parse(content)),
+                TypedValue(LegacyYAML.deserialize(content)),
+                path
+            )
+            compared += 1
+        }
+        XCTAssertGreaterThan(compared, 10, "example fixtures not found under \(root.path)")
+    }
+
+    func testScalarsMatchLegacyParser() {
+        let corpus = [
+            "true", "True", "TRUE", "false", "False", "FALSE",
+            "null", "~", "", "42", "-7", "+5", "0", "3.14", "-0.5", "1e3",
+            "0x10", "1.0.0", "\"42\"", "'true'", "\"quoted\\n\\t\\\"x\\\"\"",
+            "'it''s'", "plain text", "\"\"", "''", "café", "a: b",
+        ]
+        for text in corpus {
+            XCTAssertEqual(
+                TypedValue(YAMLParser.scalar(text)),
+                TypedValue(LegacyYAML.parseYAMLScalar(text)),
+                text
+            )
+        }
+    }
+
+    func testNestedStructureMatchesLegacyParser() {
+        let yaml = """
+        name: demo
+        version: 1.2
+        server:
+          host: localhost
+          port: 8080
+          tls:
+            enabled: false
+        users:
+          - name: Ann
+            roles:
+              - admin
+              - dev
+          - name: Bob
+            roles:
+              - dev
+        notes: |
+          first line
+          second line
+        summary: >-
+          folded
+          text
+        """
+        XCTAssertEqual(TypedValue(YAMLParser.parse(yaml)), TypedValue(LegacyYAML.deserialize(yaml)))
+    }
+
+    // MARK: - Features
+
+    func testFlowCollections() {
+        assertParses("tags: [a, b, 3]", to: ["tags": ["a", "b", 3] as [any Sendable]] as [String: any Sendable])
+        assertParses("point: {x: 1, y: 2.5}", to: ["point": ["x": 1, "y": 2.5] as [String: any Sendable]] as [String: any Sendable])
+        assertParses("empty: []\nnone: {}", to: [
+            "empty": [] as [any Sendable],
+            "none": [:] as [String: any Sendable],
+        ] as [String: any Sendable])
+        assertParses("k: [1, {a: b, c: [true, \"x, y\"]}]", to: [
+            "k": [1, ["a": "b", "c": [true, "x, y"] as [any Sendable]] as [String: any Sendable]] as [any Sendable],
+        ] as [String: any Sendable])
+        assertParses("ports: [\n  80,\n  443\n]\nhost: example", to: [
+            "ports": [80, 443] as [any Sendable],
+            "host": "example",
+        ] as [String: any Sendable])
+    }
+
+    func testAnchorsAliasesAndMerge() {
+        let yaml = """
+        defaults: &defaults
+          adapter: postgres
+          pool: 5
+        development:
+          <<: *defaults
+          pool: 10
+        name: &n primary
+        copy: *n
+        """
+        assertParses(yaml, to: [
+            "defaults": ["adapter": "postgres", "pool": 5] as [String: any Sendable],
+            "development": ["adapter": "postgres", "pool": 10] as [String: any Sendable],
+            "name": "primary",
+            "copy": "primary",
+        ] as [String: any Sendable])
+    }
+
+    func testMultipleDocuments() {
+        assertParses("---\na: 1\n---\nb: 2\n...\n", to: [
+            ["a": 1] as [String: any Sendable],
+            ["b": 2] as [String: any Sendable],
+        ] as [any Sendable])
+        assertParses("---\na: 1\n", to: ["a": 1] as [String: any Sendable])
+        assertParses("", to: "")
+    }
+
+    func testCommentsAreIgnored() {
+        let yaml = """
+        # leading comment
+        port: 8080 # inline
+        url: "http://x/#anchor" # quoted hash stays
+        path: a#b
+          # indented comment
+        list:
+          - one # first
+          - two
+        """
+        assertParses(yaml, to: [
+            "port": 8080,
+            "url": "http://x/#anchor",
+            "path": "a#b",
+            "list": ["one", "two"] as [any Sendable],
+        ] as [String: any Sendable])
+    }
+
+    func testSequenceAtKeyIndent() {
+        let yaml = """
+        targets:
+        - name: A
+          path: a
+        - name: B
+        build: true
+        """
+        assertParses(yaml, to: [
+            "targets": [
+                ["name": "A", "path": "a"] as [String: any Sendable],
+                ["name": "B"] as [String: any Sendable],
+            ] as [any Sendable],
+            "build": true,
+        ] as [String: any Sendable])
+    }
+
+    func testEmptyValueDoesNotSwallowSiblings() {
+        assertParses("a:\nb: 1", to: ["a": "", "b": 1] as [String: any Sendable])
+    }
+
+    func testQuotedKeysAndColonsInValues() {
+        assertParses("'200': ok\n\"a b\": 1\nurl: http://host:80/x", to: [
+            "200": "ok",
+            "a b": 1,
+            "url": "http://host:80/x",
+        ] as [String: any Sendable])
+    }
+
+    func testBareDashItems() {
+        let yaml = """
+        -
+          name: A
+        - - x
+          - y
+        - plain
+        """
+        assertParses(yaml, to: [
+            ["name": "A"] as [String: any Sendable],
+            ["x", "y"] as [any Sendable],
+            "plain",
+        ] as [any Sendable])
+    }
+
+    func testCRLFLineEndings() {
+        assertParses("a: 1\r\nb:\r\n  - x\r\n  - y\r\n", to: [
+            "a": 1,
+            "b": ["x", "y"] as [any Sendable],
+        ] as [String: any Sendable])
+    }
+
+    func testDeepDocumentDoesNotRecurse() {
+        var yaml = "items:\n"
+        for i in 0..<100_000 {
+            yaml += "  - id: \(i)\n    name: item-\(i)\n"
+        }
+        let value = YAMLParser.parse(yaml) as? [String: any Sendable]
+        let items = value?["items"] as? [any Sendable]
+        XCTAssertEqual(items?.count, 100_000)
+        XCTAssertEqual(TypedValue(items?.last ?? ""), TypedValue(["id": 99_999, "name": "item-99999"] as [String: any Sendable]))
+    }
+
+    // MARK: - Benchmark
+
+    func testBenchmarkLoadLargeStoreFile() throws {
+        try BenchmarkGate.require()
+        let targetBytes = BenchmarkGate.bytes(defaultMegabytes: 50)
+        let directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("yaml-benchmark-\(UUID())")
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        var yaml = ""
+        var rows = 0
+        while yaml.utf8.count < targetBytes {
+            yaml += "- id: \(rows)\n  name: \"Product \(rows)\"\n  price: \(Double(rows % 1000) / 4)\n"
+            yaml += "  active: \(rows % 2 == 0)\n  tags: [alpha, beta]\n  description: >\n"
+            yaml += "    A folded description\n    over two lines\n"
+            rows += 1
+        }
+        let url = directory.appendingPathComponent("products.store")
+        try yaml.write(to: url, atomically: true, encoding: .utf8)
+
+        measure {
+            let descriptor = try? StoreFileLoader().parseStoreFile(at: url)
+            XCTAssertEqual(descriptor?.entries.count, rows)
+        }
+    }
+}
+
+// MARK: - Legacy Parser
+
+/// The recursive line-based parser `YAMLParser` replaced, kept verbatim
+/// as the reference for the differential tests
+private enum LegacyYAML {
+    static func deserialize(_ content: String) -> any Sendable {
+        let lines = content.split(separator: "\n", omittingEmptySubsequences: false).map { String($0) }
+        return parseYAMLLines(lines, startIndex: 0, indent: 0).value
+    }
+
+    static func parseYAMLLines(
+        _ lines: [String],
+        startIndex: Int,
+        indent: Int
+    ) -> (value: any Sendable, endIndex: Int) {
+        guard startIndex < lines.count else {
+            return ("", startIndex)
+        }
+
+        let line = lines[startIndex]
+        let trimmedLine = line.trimmingCharacters(in: .whitespaces)
+
+        // Skip empty lines and comments
+        if trimmedLine.isEmpty || trimmedLine.hasPrefix("#") {
+            return parseYAMLLines(lines, startIndex: startIndex + 1, indent: indent)
+        }
+
+        // Check for array item
+        if trimmedLine.hasPrefix("- ") {
+            return parseYAMLArray(lines, startIndex: startIndex, indent: indent)
+        }
+
+        // Check for key-value pair
+        if trimmedLine.contains(":") {
+            return parseYAMLObject(lines, startIndex: startIndex, indent: indent)
+        }
+
+        // Simple value
+        return (parseYAMLScalar(trimmedLine), startIndex + 1)
+    }
+
+    static func parseYAMLArray(
+        _ lines: [String],
+        startIndex: Int,
+        indent: Int
+    ) -> (value: [any Sendable], endIndex: Int) {
+        var result: [any Sendable] = []
+        var index = startIndex
+
+        while index < lines.count {
+            let line = lines[index]
+            let currentIndent = line.prefix(while: { $0 == " " }).count
+
+            if currentIndent < indent && !line.trimmingCharacters(in: .whitespaces).isEmpty {
+                break
+            }
+
+            let trimmedLine = line.trimmingCharacters(in: .whitespaces)
+            if trimmedLine.isEmpty || trimmedLine.hasPrefix("#") {
+                index += 1
+                continue
+            }
+
+            if !trimmedLine.hasPrefix("- ") {
+                break
+            }
+
+            // Parse array item
+            let itemContent = String(trimmedLine.dropFirst(2))
+            if itemContent.contains(": ") {
+                // Object in array: first key-value is on the "- " line,
+                // continuation keys are indented on subsequent lines.
+                // Build a synthetic line array where the first key is at
+                // the continuation indent so parseYAMLObject sees them all.
+                let dashIndent = currentIndent
+                let continuationIndent = dashIndent + 2
+                let prefix = String(repeating: " ", count: continuationIndent)
+                var objectLines = [prefix + itemContent]
+
+                // Collect continuation lines that belong to this object.
+                // A line is part of the same object iff it is strictly more
+                // indented than the dash that opened the item. Lines at the
+                // same indent that start with `- ` are the next array item
+                // and stop the collection; deeper `- ` lines belong to a
+                // nested array under one of the object's keys.
+                var peek = index + 1
+                while peek < lines.count {
+                    let pLine = lines[peek]
+                    let pTrimmed = pLine.trimmingCharacters(in: .whitespaces)
+                    if pTrimmed.isEmpty || pTrimmed.hasPrefix("#") {
+                        objectLines.append(pLine)
+                        peek += 1
+                        continue
+                    }
+                    let pIndent = pLine.prefix(while: { $0 == " " }).count
+                    if pIndent > dashIndent {
+                        objectLines.append(pLine)
+                        peek += 1
+                    } else {
+                        break
+                    }
+                }
+
+                let (obj, _) = parseYAMLObject(
+                    objectLines,
+                    startIndex: 0,
+                    indent: continuationIndent
+                )
+                result.append(obj)
+                index = peek
+            } else if itemContent.isEmpty {
+                // Multi-line value after dash
+                index += 1
+            } else {
+                result.append(parseYAMLScalar(itemContent))
+                index += 1
+            }
+        }
+
+        return (result, index)
+    }
+
+    static func parseYAMLObject(
+        _ lines: [String],
+        startIndex: Int,
+        indent: Int
+    ) -> (value: [String: any Sendable], endIndex: Int) {
+        var result: [String: any Sendable] = [:]
+        var index = startIndex
+
+        while index < lines.count {
+            let line = lines[index]
+            let currentIndent = line.prefix(while: { $0 == " " }).count
+
+            if currentIndent < indent && !line.trimmingCharacters(in: .whitespaces).isEmpty {
+                break
+            }
+
+            let trimmedLine = line.trimmingCharacters(in: .whitespaces)
+            if trimmedLine.isEmpty || trimmedLine.hasPrefix("#") {
+                index += 1
+                continue
+            }
+
+            if trimmedLine.hasPrefix("- ") {
+                break
+            }
+
+            guard let colonIndex = trimmedLine.firstIndex(of: ":") else {
+                index += 1
+                continue
+            }
+
+            let key = String(trimmedLine[..<colonIndex])
+            let afterColon = String(trimmedLine[trimmedLine.index(after: colonIndex)...])
+                .trimmingCharacters(in: .whitespaces)
+
+            // Block scalar indicators: `|`, `|-`, `|+`, `>`, `>-`, `>+`
+            // (literal vs folded, with optional chomping). All variants share
+            // the same collection loop — they keep every line whose indent
+            // exceeds the key's own indent.
+            if afterColon == "|" || afterColon == "|-" || afterColon == "|+"
+                || afterColon == ">" || afterColon == ">-" || afterColon == ">+" {
+                let folded = afterColon.hasPrefix(">")
+                let chomp = afterColon.last  // "-" strip, "+" keep, nil clip
+                let (text, endIdx) = parseYAMLBlockScalar(
+                    lines,
+                    startIndex: index + 1,
+                    parentIndent: currentIndent,
+                    folded: folded,
+                    chomp: chomp == "-" ? .strip : (chomp == "+" ? .keep : .clip)
+                )
+                result[key] = text
+                index = endIdx
+                continue
+            }
+
+            if afterColon.isEmpty {
+                // Value lives on the next non-blank, non-comment line(s).
+                // Skip blank and comment lines so a stylistic blank line
+                // between `key:` and its block doesn't trick the parser
+                // into seeing an object where the user wrote an array.
+                index += 1
+                while index < lines.count {
+                    let scanTrim = lines[index].trimmingCharacters(in: .whitespaces)
+                    if scanTrim.isEmpty || scanTrim.hasPrefix("#") {
+                        index += 1
+                    } else {
+                        break
+                    }
+                }
+                if index < lines.count {
+                    let nextLine = lines[index]
+                    let nextIndent = nextLine.prefix(while: { $0 == " " }).count
+                    if nextLine.trimmingCharacters(in: .whitespaces).hasPrefix("- ") {
+                        let (arr, endIdx) = parseYAMLArray(lines, startIndex: index, indent: nextIndent)
+                        result[key] = arr
+                        index = endIdx
+                    } else {
+                        let (obj, endIdx) = parseYAMLObject(lines, startIndex: index, indent: nextIndent)
+                        result[key] = obj
+                        index = endIdx
+                    }
+                }
+            } else {
+                result[key] = parseYAMLScalar(afterColon)
+                index += 1
+            }
+        }
+
+        return (result, index)
+    }
+
+    enum YAMLChomp { case strip, clip, keep }
+
+    /// Collect a block scalar body. `parentIndent` is the indent of the key
+    /// line whose value this block is; the block ends as soon as a non-empty
+    /// line is found at parentIndent or less.
+    static func parseYAMLBlockScalar(
+        _ lines: [String],
+        startIndex: Int,
+        parentIndent: Int,
+        folded: Bool,
+        chomp: YAMLChomp
+    ) -> (value: String, endIndex: Int) {
+        var collected: [String] = []
+        var index = startIndex
+        var blockIndent: Int? = nil
+
+        while index < lines.count {
+            let line = lines[index]
+            let trimmed = line.trimmingCharacters(in: .whitespaces)
+            if trimmed.isEmpty {
+                collected.append("")
+                index += 1
+                continue
+            }
+            let pIndent = line.prefix(while: { $0 == " " }).count
+            if pIndent <= parentIndent { break }
+            if blockIndent == nil { blockIndent = pIndent }
+            let strip = min(blockIndent ?? pIndent, pIndent)
+            collected.append(String(line.dropFirst(strip)))
+            index += 1
+        }
+
+        // Trim trailing empties that were collected past the real end.
+        while index < lines.count {
+            // safety no-op; placeholder
+            break
+        }
+
+        // Drop trailing blank lines that came after the last non-blank.
+        var lastNonBlank = collected.count
+        while lastNonBlank > 0 && collected[lastNonBlank - 1].isEmpty {
+            lastNonBlank -= 1
+        }
+
+        let body: String
+        if folded {
+            // Folded: single newlines become spaces, blank lines stay as newlines.
+            var pieces: [String] = []
+            var current = ""
+            for i in 0..<lastNonBlank {
+                let line = collected[i]
+                if line.isEmpty {
+                    pieces.append(current)
+                    pieces.append("")
+                    current = ""
+                } else if current.isEmpty {
+                    current = line
+                } else {
+                    current += " " + line
+                }
+            }
+            pieces.append(current)
+            body = pieces.joined(separator: "\n")
+        } else {
+            body = collected.prefix(lastNonBlank).joined(separator: "\n")
+        }
+
+        switch chomp {
+        case .strip:
+            return (body, index)
+        case .clip:
+            return (body.isEmpty ? body : body + "\n", index)
+        case .keep:
+            // Re-append every trailing blank we trimmed.
+            let trailing = collected.count - lastNonBlank
+            return (body + String(repeating: "\n", count: trailing + (body.isEmpty ? 0 : 1)), index)
+        }
+    }
+
+    static func parseYAMLScalar(_ value: String) -> any Sendable {
+        let trimmed = value.trimmingCharacters(in: .whitespaces)
+
+        // Boolean
+        if trimmed == "true" || trimmed == "True" || trimmed == "TRUE" {
+            return true
+        }
+        if trimmed == "false" || trimmed == "False" || trimmed == "FALSE" {
+            return false
+        }
+
+        // Null
+        if trimmed == "null" || trimmed == "~" || trimmed.isEmpty {
+            return ""
+        }
+
+        // Number
+        if let intValue = Int(trimmed) {
+            return intValue
+        }
+        if let doubleValue = Double(trimmed) {
+            return doubleValue
+        }
+
+        // Double-quoted string: process YAML escape sequences
+        if trimmed.count >= 2 && trimmed.hasPrefix("\"") && trimmed.hasSuffix("\"") {
+            let body = String(trimmed.dropFirst().dropLast())
+            return unescapeDoubleQuotedYAML(body)
+        }
+
+        // Single-quoted string: only `''` -> `'` is significant
+        if trimmed.count >= 2 && trimmed.hasPrefix("'") && trimmed.hasSuffix("'") {
+            let body = String(trimmed.dropFirst().dropLast())
+            return body.replacingOccurrences(of: "''", with: "'")
+        }
+
+        return trimmed
+    }
+
+    static func unescapeDoubleQuotedYAML(_ s: String) -> String {
+        var out = ""
+        out.reserveCapacity(s.count)
+        var iter = s.makeIterator()
+        while let ch = iter.next() {
+            if ch != "\\" { out.append(ch); continue }
+            guard let esc = iter.next() else { out.append("\\"); break }
+            switch esc {
+            case "n":  out.append("\n")
+            case "t":  out.append("\t")
+            case "r":  out.append("\r")
+            case "0":  out.append("\u{0}")
+            case "\"": out.append("\"")
+            case "'":  out.append("'")
+            case "\\": out.append("\\")
+            case "/":  out.append("/")
+            case "a":  out.append("\u{07}")
+            case "b":  out.append("\u{08}")
+            case "f":  out.append("\u{0C}")
+            case "v":  out.append("\u{0B}")
+            case "e":  out.append("\u{1B}")
+            case " ":  out.append(" ")
+            default:   out.append("\\"); out.append(esc)
+            }
+        }
+        return out
+    }
+}